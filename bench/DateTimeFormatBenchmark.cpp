@@ -0,0 +1,125 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/utils/date.hpp"
+#include "matador/utils/string.hpp"
+#include "matador/utils/time.hpp"
+
+#include <string>
+
+using namespace matador;
+
+namespace {
+
+// the format the backends used before
+const char *const time_format_string = "%Y-%m-%dT%H:%M:%S.%f";
+const char *const date_format_string = "%Y-%m-%d";
+
+void format_time(std::size_t count)
+{
+  matador::time t(2015, 3, 15, 13, 56, 23, 123);
+
+  std::size_t length = 0;
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      length += to_string(t, time_format_string).size();
+    }
+  });
+  benchmark::report("time to_string (strftime)", count, millis);
+
+  char buffer[iso8601::TIME_SIZE];
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      length += to_iso8601(t, buffer);
+    }
+  });
+  benchmark::report("time to_iso8601", count, millis);
+  benchmark::do_not_optimize(&length);
+}
+
+void parse_time(std::size_t count)
+{
+  const std::string str("2015-03-15T13:56:23.123");
+
+  long seconds = 0;
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      seconds += matador::time::parse(str, time_format_string).get_timeval().tv_sec;
+    }
+  });
+  benchmark::report("time parse (strptime)", count, millis);
+
+  matador::time t;
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      from_iso8601(str.c_str(), str.size(), t);
+      seconds += t.get_timeval().tv_sec;
+    }
+  });
+  benchmark::report("time from_iso8601", count, millis);
+  benchmark::do_not_optimize(&seconds);
+}
+
+void format_date(std::size_t count)
+{
+  matador::date d(15, 3, 2015);
+
+  std::size_t length = 0;
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      length += to_string(d, date_format_string).size();
+    }
+  });
+  benchmark::report("date to_string (strftime)", count, millis);
+
+  char buffer[iso8601::DATE_SIZE];
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      length += to_iso8601(d, buffer);
+    }
+  });
+  benchmark::report("date to_iso8601", count, millis);
+  benchmark::do_not_optimize(&length);
+}
+
+void parse_date(std::size_t count)
+{
+  const std::string str("2015-03-15");
+
+  long days = 0;
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      days += date::parse(str, date_format_string).julian_date();
+    }
+  });
+  benchmark::report("date parse (strptime)", count, millis);
+
+  date d;
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      from_iso8601(str.c_str(), str.size(), d);
+      days += d.julian_date();
+    }
+  });
+  benchmark::report("date from_iso8601", count, millis);
+  benchmark::do_not_optimize(&days);
+}
+
+void date_time_format_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 1000000 / divisor;
+
+  benchmark::section("ISO 8601 date and time conversion");
+
+  format_time(count);
+  parse_time(count);
+  format_date(count);
+  parse_date(count);
+}
+
+benchmark::registrar date_time_format_registrar("date_time_format", &date_time_format_benchmark);
+
+}
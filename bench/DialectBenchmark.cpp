@@ -0,0 +1,141 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/sql/basic_dialect.hpp"
+#include "matador/sql/basic_dialect_compiler.hpp"
+#include "matador/sql/basic_dialect_linker.hpp"
+#include "matador/sql/column.hpp"
+#include "matador/sql/condition.hpp"
+#include "matador/sql/query.hpp"
+#include "matador/sql/token_structure.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace matador;
+
+namespace {
+
+struct account
+{
+  identifier<unsigned long> id;
+  std::string owner;
+  long balance = 0;
+  date opened;
+
+  template < class S >
+  void serialize(S &serializer)
+  {
+    serializer.serialize("id", id);
+    serializer.serialize("owner", owner);
+    serializer.serialize("balance", balance);
+    serializer.serialize("opened", opened);
+  }
+};
+
+class bench_dialect : public basic_dialect
+{
+public:
+  bench_dialect()
+    : basic_dialect(new detail::basic_dialect_compiler, new detail::basic_dialect_linker)
+  {}
+
+  const char* type_string(data_type) const override
+  {
+    return "INTEGER";
+  }
+
+  dialect_traits::identifier identifier_escape_type() const override
+  {
+    return dialect_traits::ESCAPE_BOTH_SAME;
+  }
+};
+
+// the statements table<T>::prepare builds for a type
+std::vector<sql> table_statements(const std::string &name)
+{
+  column id("id");
+  std::vector<sql> statements;
+  statements.push_back(query<account>(name).insert().stmt());
+  statements.push_back(query<account>(name).update().where(id == 1).stmt());
+  statements.push_back(query<account>(name).remove().where(id == 1).stmt());
+  statements.push_back(query<account>(name).select().stmt());
+  statements.push_back(query<account>(name).select().where(id == 1).stmt());
+  return statements;
+}
+
+void dialect_prepare_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 100000 / divisor;
+
+  benchmark::section("dialect prepare (table statements)");
+
+  // each table has its own statements, so
+  // every build misses the cache
+  std::vector<std::vector<sql>> tables;
+  tables.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    tables.push_back(table_statements("account_" + std::to_string(i)));
+  }
+  const std::size_t statement_count = count * tables.front().size();
+
+  std::string result;
+  {
+    bench_dialect dialect;
+    double millis = benchmark::measure([&]() {
+      for (const auto &statements : tables) {
+        for (const auto &s : statements) {
+          result = dialect.prepare(s);
+        }
+      }
+    });
+    benchmark::report("prepare, cache miss", statement_count, millis);
+  }
+  {
+    bench_dialect dialect;
+    const std::vector<sql> &statements = tables.front();
+    double millis = benchmark::measure([&]() {
+      for (std::size_t i = 0; i < count; ++i) {
+        for (const auto &s : statements) {
+          result = dialect.prepare(s);
+        }
+      }
+    });
+    benchmark::report("prepare, cache hit", statement_count, millis);
+  }
+  {
+    // direct statements are never cached, they
+    // give the build cost without the cache
+    bench_dialect dialect;
+    const std::vector<sql> &statements = tables.front();
+    double millis = benchmark::measure([&]() {
+      for (std::size_t i = 0; i < count; ++i) {
+        for (const auto &s : statements) {
+          result = dialect.direct(s);
+        }
+      }
+    });
+    benchmark::report("direct, not cached", statement_count, millis);
+  }
+  {
+    // the cache key is built on every prepare
+    const std::vector<sql> &statements = tables.front();
+    double millis = benchmark::measure([&]() {
+      for (std::size_t i = 0; i < count; ++i) {
+        for (const auto &s : statements) {
+          result = detail::token_structure::of(s);
+        }
+      }
+    });
+    benchmark::report("token structure key only", statement_count, millis);
+  }
+  benchmark::do_not_optimize(result.data());
+}
+
+benchmark::registrar dialect_prepare_registrar("dialect_prepare", &dialect_prepare_benchmark);
+
+}
@@ -0,0 +1,101 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/object/identifier_proxy_map.hpp"
+#include "matador/object/object_id_map.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+
+using namespace matador;
+
+namespace {
+
+object_proxy* fake_proxy(unsigned long id)
+{
+  // the proxies are never dereferenced
+  return reinterpret_cast<object_proxy*>(static_cast<std::uintptr_t>(id) << 4);
+}
+
+template < class M, class INSERT, class FIND, class ERASE >
+void run(const std::string &name, std::size_t count, M &map, INSERT insert, FIND find, ERASE erase)
+{
+  double millis = benchmark::measure([&]() {
+    for (unsigned long id = 1; id <= count; ++id) {
+      insert(map, id);
+    }
+  });
+  benchmark::report(name + " insert", count, millis);
+
+  object_proxy *found = nullptr;
+  millis = benchmark::measure([&]() {
+    for (unsigned long id = 1; id <= count; ++id) {
+      found = find(map, id);
+    }
+  });
+  benchmark::do_not_optimize(found);
+  benchmark::report(name + " lookup", count, millis);
+
+  millis = benchmark::measure([&]() {
+    for (unsigned long id = 1; id <= count; ++id) {
+      erase(map, id);
+    }
+  });
+  benchmark::report(name + " delete", count, millis);
+}
+
+void object_id_map_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 10000000 / divisor;
+
+  benchmark::section("object id map (dense ids)");
+
+  {
+    std::unordered_map<unsigned long, object_proxy*> map;
+    run("std::unordered_map", count, map,
+        [](std::unordered_map<unsigned long, object_proxy*> &m, unsigned long id) { m.insert(std::make_pair(id, fake_proxy(id))); },
+        [](std::unordered_map<unsigned long, object_proxy*> &m, unsigned long id) { return m.find(id)->second; },
+        [](std::unordered_map<unsigned long, object_proxy*> &m, unsigned long id) { m.erase(id); });
+  }
+  {
+    detail::object_id_map map;
+    run("object_id_map", count, map,
+        [](detail::object_id_map &m, unsigned long id) { m.insert(id, fake_proxy(id)); },
+        [](detail::object_id_map &m, unsigned long id) { return m.find(id); },
+        [](detail::object_id_map &m, unsigned long id) { m.erase(id); });
+  }
+}
+
+void identifier_key_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 10000000 / divisor;
+
+  benchmark::section("identifier key extraction");
+
+  identifier<unsigned long> id(4711);
+  const basic_identifier &basic_id = id;
+
+  std::uint64_t sum = 0;
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += detail::identifier_key::of(basic_id).value;
+    }
+  });
+  benchmark::report("key of basic_identifier", count, millis);
+
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += detail::identifier_key::of(id).value;
+    }
+  });
+  benchmark::report("key of identifier<unsigned long>", count, millis);
+  benchmark::do_not_optimize(&sum);
+}
+
+benchmark::registrar object_id_map_registrar("object_id_map", &object_id_map_benchmark);
+benchmark::registrar identifier_key_registrar("identifier_key", &identifier_key_benchmark);
+
+}
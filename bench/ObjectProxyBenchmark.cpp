@@ -0,0 +1,114 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/object/object_store.hpp"
+#include "matador/object/object_proxy.hpp"
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace matador;
+
+namespace {
+
+struct point
+{
+  identifier<unsigned long> id;
+  long x = 0;
+  long y = 0;
+
+  point() = default;
+  point(long px, long py) : x(px), y(py) {}
+
+  template < class S >
+  void serialize(S &serializer)
+  {
+    serializer.serialize("id", id);
+    serializer.serialize("x", x);
+    serializer.serialize("y", y);
+  }
+};
+
+// the heap bytes in use, zero if unknown
+std::size_t heap_in_use()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+
+void memory_per_object(std::size_t count)
+{
+  object_store store;
+  store.attach<point>("point");
+
+  std::size_t before = heap_in_use();
+  for (std::size_t i = 0; i < count; ++i) {
+    store.insert(new point((long)i, (long)i));
+  }
+  std::size_t after = heap_in_use();
+
+  if (after == 0) {
+    std::cout << "  skipped: heap usage isn't available\n";
+    return;
+  }
+  std::cout << "  " << count << " objects: " << (after - before) / count << " heap bytes per object (object "
+            << sizeof(point) << ", proxy " << sizeof(object_proxy) << ")\n";
+}
+
+void pointer_copy(std::size_t count)
+{
+  object_store store;
+  store.attach<point>("point");
+
+  object_ptr<point> p1 = store.insert(new point(1, 2));
+  object_ptr<point> p2 = store.insert(new point(3, 4));
+
+  // an odd number of holders, so each assignment
+  // moves a holder from one proxy to the other
+  const std::size_t holder_count = 1023;
+  std::vector<object_ptr<point>> holders(holder_count, p1);
+  double millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      holders[i % holder_count] = (i & 1) ? p1 : p2;
+    }
+  });
+  benchmark::report("object_ptr assignment", count, millis);
+
+  // the per proxy holder tree used before
+  std::vector<std::set<const void*>> holder_sets(2);
+  for (const auto &h : holders) {
+    holder_sets[0].insert(&h);
+  }
+  millis = benchmark::measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      const void *h = &holders[i % holder_count];
+      holder_sets[(i + 1) & 1].erase(h);
+      holder_sets[i & 1].insert(h);
+    }
+  });
+  benchmark::report("std::set erase and insert (reference)", count, millis);
+}
+
+void object_proxy_benchmark(std::size_t divisor)
+{
+  benchmark::section("object proxy memory");
+  memory_per_object(1000000 / divisor);
+
+  benchmark::section("object proxy pointer copy");
+  pointer_copy(10000000 / divisor);
+}
+
+benchmark::registrar object_proxy_registrar("object_proxy", &object_proxy_benchmark);
+
+}
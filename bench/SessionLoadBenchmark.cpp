@@ -0,0 +1,109 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/orm/persistence.hpp"
+#include "matador/orm/session.hpp"
+
+#include "matador/object/object_view.hpp"
+
+#include "matador/utils/date.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+
+using namespace matador;
+
+namespace {
+
+const char *const database = "bench_load.sqlite";
+
+// independent tables, each one is
+// read by its own worker
+template < int N >
+struct record
+{
+  identifier<unsigned long> id;
+  std::string name;
+  long value = 0;
+  date created;
+
+  record() = default;
+  record(std::string n, long v) : name(std::move(n)), value(v), created(1, 1, 2000) {}
+
+  template < class S >
+  void serialize(S &serializer)
+  {
+    serializer.serialize("id", id);
+    serializer.serialize("name", name);
+    serializer.serialize("value", value);
+    serializer.serialize("created", created);
+  }
+};
+
+template < int N >
+void insert_records(session &s, std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    s.insert(new record<N>("record " + std::to_string(i), (long)i));
+  }
+}
+
+void load(persistence &p, const std::string &name, std::size_t count, std::size_t workers)
+{
+  p.clear();
+  session s(p);
+  double millis = benchmark::measure([&]() {
+    if (workers > 0) {
+      s.load_parallel(workers);
+    } else {
+      s.load();
+    }
+  });
+  benchmark::report(name, count, millis);
+  benchmark::do_not_optimize(&s.store());
+}
+
+void session_load_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 100000 / divisor;
+
+  benchmark::section("session load (sqlite, 4 tables)");
+
+  std::remove(database);
+  try {
+    persistence p(std::string("sqlite://") + database);
+    p.attach<record<0>>("record_0");
+    p.attach<record<1>>("record_1");
+    p.attach<record<2>>("record_2");
+    p.attach<record<3>>("record_3");
+    p.create();
+
+    {
+      session s(p);
+      auto tr = s.begin();
+      insert_records<0>(s, count);
+      insert_records<1>(s, count);
+      insert_records<2>(s, count);
+      insert_records<3>(s, count);
+      tr.commit();
+    }
+
+    load(p, "sequential load", 4 * count, 0);
+    load(p, "parallel load, 2 workers", 4 * count, 2);
+    load(p, "parallel load, 4 workers", 4 * count, 4);
+
+    p.drop();
+  } catch (std::exception &ex) {
+    std::cout << "  skipped: " << ex.what() << "\n";
+  }
+  std::remove(database);
+}
+
+benchmark::registrar session_load_registrar("session_load", &session_load_benchmark);
+
+}
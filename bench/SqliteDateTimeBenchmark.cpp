@@ -0,0 +1,109 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/sql/connection.hpp"
+#include "matador/sql/query.hpp"
+
+#include "matador/db/sqlite/sqlite_dialect.hpp"
+
+#include "matador/utils/date.hpp"
+#include "matador/utils/time.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+
+using namespace matador;
+
+namespace {
+
+const char *const database = "bench_date_time.sqlite";
+
+// a timestamp heavy row
+struct event
+{
+  identifier<unsigned long> id;
+  date day;
+  matador::time created;
+  matador::time started;
+  matador::time finished;
+
+  template < class S >
+  void serialize(S &serializer)
+  {
+    serializer.serialize("id", id);
+    serializer.serialize("day", day);
+    serializer.serialize("created", created);
+    serializer.serialize("started", started);
+    serializer.serialize("finished", finished);
+  }
+};
+
+void run(const std::string &name, std::size_t count, bool binary)
+{
+  std::remove(database);
+
+  connection conn(std::string("sqlite://") + database);
+  conn.open();
+  static_cast<sqlite::sqlite_dialect*>(conn.dialect())->store_binary_date_time(binary);
+
+  query<event> q("event");
+  q.create().execute(conn);
+
+  event e;
+  e.day.set(1, 1, 2000);
+  e.created.set(2000, 1, 1, 8, 0, 0, 0);
+  e.started.set(2000, 1, 1, 9, 0, 0, 0);
+  e.finished.set(2000, 1, 1, 10, 0, 0, 0);
+
+  {
+    auto stmt = q.insert(e).prepare(conn);
+    double millis = benchmark::measure([&]() {
+      conn.begin();
+      for (std::size_t i = 1; i <= count; ++i) {
+        e.id = i;
+        e.started.set(e.started.get_timeval().tv_sec + 1, 123);
+        stmt.bind(0, &e);
+        stmt.execute();
+        stmt.reset();
+      }
+      conn.commit();
+    });
+    benchmark::report(name + " insert", count, millis);
+  }
+
+  long seconds = 0;
+  double millis = benchmark::measure([&]() {
+    auto res = q.select().execute(conn);
+    for (auto ev : res) {
+      seconds += ev->started.get_timeval().tv_sec;
+    }
+  });
+  benchmark::report(name + " scan", count, millis);
+  benchmark::do_not_optimize(&seconds);
+
+  conn.close();
+  std::remove(database);
+}
+
+void sqlite_date_time_benchmark(std::size_t divisor)
+{
+  const std::size_t count = 100000 / divisor;
+
+  benchmark::section("sqlite date and time storage (1 date, 3 times per row)");
+
+  try {
+    run("ISO 8601 text", count, false);
+    run("binary integer", count, true);
+  } catch (std::exception &ex) {
+    std::cout << "  skipped: " << ex.what() << "\n";
+  }
+}
+
+benchmark::registrar sqlite_date_time_registrar("sqlite_date_time", &sqlite_date_time_benchmark);
+
+}
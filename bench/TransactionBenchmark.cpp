@@ -0,0 +1,80 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include "matador/object/object_store.hpp"
+#include "matador/object/transaction.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace matador;
+
+namespace {
+
+struct account
+{
+  identifier<unsigned long> id;
+  std::string owner;
+  long balance = 0;
+
+  account() = default;
+  account(std::string o, long b) : owner(std::move(o)), balance(b) {}
+
+  template < class S >
+  void serialize(S &serializer)
+  {
+    serializer.serialize("id", id);
+    serializer.serialize("owner", owner);
+    serializer.serialize("balance", balance);
+  }
+};
+
+void rollback(std::size_t count)
+{
+  object_store store;
+  store.attach<account>("account");
+
+  std::vector<object_ptr<account>> accounts;
+  accounts.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    accounts.push_back(store.insert(new account("owner " + std::to_string(i), 100)));
+  }
+
+  transaction tr(store);
+  tr.begin();
+
+  // every update backs up one account
+  double millis = benchmark::measure([&]() {
+    for (auto &a : accounts) {
+      a->balance += 10;
+    }
+  });
+  benchmark::report(std::to_string(count) + " updates record", count, millis);
+
+  millis = benchmark::measure([&]() {
+    tr.rollback();
+  });
+  benchmark::report(std::to_string(count) + " updates rollback", count, millis);
+
+  long balance = 0;
+  for (auto &a : accounts) {
+    balance += a->balance;
+  }
+  benchmark::do_not_optimize(&balance);
+}
+
+void transaction_rollback_benchmark(std::size_t divisor)
+{
+  benchmark::section("transaction rollback");
+
+  for (std::size_t count : { 10000, 100000, 1000000 }) {
+    rollback(count / divisor);
+  }
+}
+
+benchmark::registrar transaction_rollback_registrar("transaction_rollback", &transaction_rollback_benchmark);
+
+}
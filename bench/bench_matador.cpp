@@ -0,0 +1,92 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace benchmark {
+
+void report(const std::string &name, std::size_t operations, double millis)
+{
+  std::cout << "  " << std::left << std::setw(48) << name
+            << std::right << std::setw(10) << operations << " ops "
+            << std::fixed << std::setprecision(2) << std::setw(12) << millis << " ms "
+            << std::setw(12) << (operations > 0 ? millis * 1000000.0 / (double)operations : 0.0) << " ns/op\n";
+}
+
+void section(const std::string &title)
+{
+  std::cout << "\n" << title << "\n";
+}
+
+registrar::registrar(const std::string &name, const t_benchmark_func &func)
+{
+  benchmarks().insert(std::make_pair(name, func));
+}
+
+std::map<std::string, t_benchmark_func>& benchmarks()
+{
+  static std::map<std::string, t_benchmark_func> benchmark_map;
+  return benchmark_map;
+}
+
+const void * volatile sink = nullptr;
+
+void do_not_optimize(const void *p)
+{
+  sink = p;
+}
+
+}
+
+void usage(const char *name)
+{
+  std::cout << "usage: " << name << " [-d divisor] [list | benchmark...]\n";
+}
+
+int main(int argc, char *argv[])
+{
+  std::size_t divisor = 1;
+  std::vector<std::string> names;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+      divisor = strtoul(argv[++i], nullptr, 10);
+      if (divisor == 0) {
+        divisor = 1;
+      }
+    } else if (strcmp(argv[i], "list") == 0) {
+      for (const auto &bm : benchmark::benchmarks()) {
+        std::cout << bm.first << "\n";
+      }
+      return EXIT_SUCCESS;
+    } else if (argv[i][0] == '-') {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    } else {
+      names.emplace_back(argv[i]);
+    }
+  }
+
+  if (names.empty()) {
+    for (const auto &bm : benchmark::benchmarks()) {
+      bm.second(divisor);
+    }
+    return EXIT_SUCCESS;
+  }
+
+  for (const auto &name : names) {
+    auto i = benchmark::benchmarks().find(name);
+    if (i == benchmark::benchmarks().end()) {
+      std::cout << "unknown benchmark " << name << "\n";
+      return EXIT_FAILURE;
+    }
+    i->second(divisor);
+  }
+  return EXIT_SUCCESS;
+}
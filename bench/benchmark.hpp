@@ -0,0 +1,66 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_BENCHMARK_HPP
+#define OOS_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace benchmark {
+
+typedef std::chrono::steady_clock clock;
+
+/**
+ * Runs the given function once and
+ * returns the elapsed time in milliseconds
+ */
+template < class F >
+double measure(F &&func)
+{
+  clock::time_point start = clock::now();
+  func();
+  return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+}
+
+/**
+ * Prints one result line with the total time
+ * and the time per operation
+ */
+void report(const std::string &name, std::size_t operations, double millis);
+
+/**
+ * Prints a section header
+ */
+void section(const std::string &title);
+
+/**
+ * A benchmark gets a divisor for its operation counts.
+ * The default of 1 runs the sizes asked for, greater
+ * values give short smoke runs.
+ */
+typedef std::function<void(std::size_t)> t_benchmark_func;
+
+/**
+ * Registers a benchmark under the given name
+ */
+struct registrar
+{
+  registrar(const std::string &name, const t_benchmark_func &func);
+};
+
+std::map<std::string, t_benchmark_func>& benchmarks();
+
+/**
+ * Keeps the compiler from optimizing
+ * away the given value
+ */
+void do_not_optimize(const void *p);
+
+}
+
+#endif //OOS_BENCHMARK_HPP
@@ -18,6 +18,9 @@ public:
   data_type string_type(const char *type) const;
 
   dialect_traits::identifier identifier_escape_type() const override;
+
+  size_t max_bind_count() const override;
+  size_t max_insert_rows() const override;
 };
 
 }
@@ -110,7 +110,9 @@ protected:
     SQLSMALLINT type = (SQLSMALLINT)mssql_statement::type2int(data_type_traits<T>::type());
     SQLRETURN ret = SQLGetData(stmt_, (SQLUSMALLINT)(result_index_++), type, &val, sizeof(T), &info);
     if (SQL_SUCCEEDED(ret)) {
-      return;
+      if (info == SQL_NULL_DATA) {
+        val = T();
+      }
     } else {
       throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
     }
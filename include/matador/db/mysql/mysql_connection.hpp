@@ -96,11 +96,42 @@ public:
 
   virtual basic_dialect* dialect() override;
 
+  /**
+   * Registers the given unbuffered result as the open
+   * cursor of the connection. Until all rows of such a
+   * result are read the server doesn't accept any other
+   * command on the connection, so there is at most one
+   * open cursor per connection.
+   *
+   * @param cursor The unbuffered result
+   */
+  void open_cursor(detail::result_impl *cursor);
+
+  /**
+   * Unregisters the given unbuffered result
+   * once its rows are read or it is destroyed.
+   *
+   * @param cursor The unbuffered result
+   */
+  void close_cursor(detail::result_impl *cursor);
+
+  /**
+   * Throws an exception if there is an
+   * open cursor on the connection.
+   *
+   * @param sql The statement to execute
+   */
+  void check_cursor(const std::string &sql) const;
+
+private:
+  detail::result_impl* execute(const std::string &stmt, bool stream);
+
 private:
   MYSQL mysql_;
   std::string db_;
   bool is_open_;
   mysql_dialect dialect_;
+  detail::result_impl *cursor_ = nullptr;
 };
 
 }
@@ -19,6 +19,8 @@ public:
   data_type string_type(const char *type) const;
 
   dialect_traits::identifier identifier_escape_type() const override;
+
+  size_t max_bind_count() const override;
 };
 
 }
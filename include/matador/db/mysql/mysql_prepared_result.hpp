@@ -27,6 +27,8 @@ class date;
 
 namespace mysql {
 
+class mysql_connection;
+
 class mysql_prepared_result : public detail::result_impl
 {
 private:
@@ -38,7 +40,28 @@ public:
   typedef std::unordered_map<std::string, std::shared_ptr<basic_identifier> > t_pk_map;
 
 public:
+  /**
+   * Creates a result of an executed statement
+   * which rows were buffered on the client.
+   *
+   * @param s The executed statement
+   * @param rs The number of result columns
+   */
   mysql_prepared_result(MYSQL_STMT *s, int rs);
+
+  /**
+   * Creates a result of an executed statement
+   * which rows are fetched from the server one
+   * by one. The result is the open cursor of
+   * the connection until all rows are fetched or
+   * it is destroyed. The count of result rows is
+   * the count of rows fetched so far.
+   *
+   * @param s The executed statement
+   * @param rs The number of result columns
+   * @param conn The connection of the statement
+   */
+  mysql_prepared_result(MYSQL_STMT *s, int rs, mysql_connection &conn);
   ~mysql_prepared_result();
 
   virtual const char* column(size_type c) const override;
@@ -95,6 +118,8 @@ private:
   void prepare_bind_column(int index, enum_field_types type, char *x, size_t s);
   void prepare_bind_column(int index, enum_field_types type, varchar_base &value);
 
+  void close_cursor();
+
 private:
   int column_index_ = 0;
   size_type affected_rows_;
@@ -109,6 +134,9 @@ private:
 
   bool prepare_binding_ = true;
 
+  bool stream_ = false;
+  mysql_connection *conn_ = nullptr;
+
   typedef std::unordered_map<std::string, std::shared_ptr<basic_identifier> > t_foreign_key_map;
   t_foreign_key_map foreign_keys_;
 };
@@ -36,6 +36,8 @@ class serializer;
 
 namespace mysql {
 
+class mysql_connection;
+
 class mysql_result : public detail::result_impl
 {
 private:
@@ -46,7 +48,24 @@ public:
   typedef detail::result_impl::size_type size_type;
 
 public:
+  /**
+   * Creates a result buffering all rows
+   * of the last query on the client.
+   *
+   * @param c The mysql connection handle
+   */
   mysql_result(MYSQL *c);
+
+  /**
+   * Creates a result reading the rows of the last
+   * query from the server while they are fetched.
+   * The result is the open cursor of the connection
+   * until all rows are read or it is destroyed. The
+   * count of result rows is the count of rows read.
+   *
+   * @param conn The mysql connection
+   */
+  explicit mysql_result(mysql_connection &conn);
   virtual ~mysql_result();
 
   virtual const char* column(size_type c) const override;
@@ -82,6 +101,9 @@ protected:
   virtual bool prepare_fetch() override;
   virtual bool finalize_fetch() override;
 
+private:
+  void close_cursor();
+
 private:
   struct result_deleter
   {
@@ -96,6 +118,8 @@ private:
   size_type fields_;
   MYSQL_ROW row_;
   MYSQL_RES *res_;
+  bool stream_ = false;
+  mysql_connection *conn_ = nullptr;
 };
 
 }
@@ -99,6 +99,7 @@ private:
   void bind_null(std::size_t index);
 
 private:
+  mysql_connection &db_;
   size_t result_size;
   size_t host_size;
   std::vector<my_bool> is_null_vector;
@@ -94,9 +94,6 @@ public:
    */
   sqlite3* handle();
 
-private:
-  static int parse_result(void* param, int column_count, char** values, char** columns);
-
 private:
   sqlite3 *sqlite_db_;
   sqlite_dialect dialect_;
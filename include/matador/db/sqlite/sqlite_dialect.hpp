@@ -7,6 +7,11 @@
 
 #include "matador/sql/basic_dialect.hpp"
 
+#include "matador/utils/time.hpp"
+
+#include <stdexcept>
+#include <string>
+
 namespace matador {
 namespace sqlite {
 
@@ -19,6 +24,115 @@ public:
   data_type string_type(const char *type) const;
 
   dialect_traits::identifier identifier_escape_type() const override;
+
+  size_t max_bind_count() const override;
+
+  std::string date_literal(const matador::date &d) const override;
+  std::string time_literal(const matador::time &t) const override;
+
+  /**
+   * Enables or disables the binary storage of date
+   * and time values. If enabled a date is stored as
+   * its julian day number and a time as microseconds
+   * since the epoch, both as integer. Otherwise they
+   * are stored as ISO 8601 text (the default).
+   *
+   * Values are read in either storage, so a column
+   * may hold both while it is converted with the
+   * statement built by convert_date_time().
+   *
+   * @param enable True to store date and time as integer
+   */
+  void store_binary_date_time(bool enable)
+  {
+    binary_date_time_ = enable;
+  }
+
+  /**
+   * Returns true if date and time
+   * values are stored as integer.
+   *
+   * @return True if date and time are stored as integer
+   */
+  bool stores_binary_date_time() const
+  {
+    return binary_date_time_;
+  }
+
+  /**
+   * Returns a statement converting the date or time
+   * values of the given column to the current storage
+   * of the dialect. Values already stored that way are
+   * left untouched.
+   *
+   * The conversion of time values from and to text
+   * uses the local time zone like matador::time does.
+   *
+   * @param table The name of the table
+   * @param column The name of the date or time column
+   * @param type The type of the column (date or time)
+   * @return The update statement
+   */
+  std::string convert_date_time(const std::string &table, const std::string &column, data_type type)
+  {
+    std::string col = prepare_identifier(column);
+    std::string value;
+    std::string from;
+    if (type == data_type::type_date && binary_date_time_) {
+      value = "CAST(julianday(" + col + ") + 0.5 AS INTEGER)";
+      from = "text";
+    } else if (type == data_type::type_date) {
+      value = "date(" + col + " - 0.5)";
+      from = "integer";
+    } else if (type == data_type::type_time && binary_date_time_) {
+      // the fraction holds as many digits as written
+      std::string fraction = "substr(" + col + ", 21)";
+      value = "CAST(strftime('%s', substr(" + col + ", 1, 19), 'utc') AS INTEGER) * 1000000 + "
+              "CAST(" + fraction + " || substr('000000', length(" + fraction + ") + 1) AS INTEGER)";
+      from = "text";
+    } else if (type == data_type::type_time) {
+      value = "strftime('%Y-%m-%dT%H:%M:%S', " + col + " / 1000000, 'unixepoch', 'localtime') || printf('.%03d', " + col + " / 1000 % 1000)";
+      from = "integer";
+    } else {
+      throw std::logic_error("sqlite: column " + column + " is neither a date nor a time");
+    }
+    return "UPDATE " + prepare_identifier(table) + " SET " + col + "=" + value + " WHERE typeof(" + col + ")='" + from + "'";
+  }
+
+  /**
+   * Returns the microseconds since the
+   * epoch of the given time.
+   *
+   * @param t The time
+   * @return The microseconds since the epoch
+   */
+  static long long epoch_micro_seconds(const matador::time &t)
+  {
+    struct timeval tv = t.get_timeval();
+    return (long long)tv.tv_sec * 1000000LL + tv.tv_usec;
+  }
+
+  /**
+   * Returns the time of the given
+   * microseconds since the epoch.
+   *
+   * @param usec The microseconds since the epoch
+   * @return The time
+   */
+  static matador::time from_epoch_micro_seconds(long long usec)
+  {
+    struct timeval tv;
+    tv.tv_sec = (time_t)(usec / 1000000LL);
+    tv.tv_usec = (long)(usec % 1000000LL);
+    if (tv.tv_usec < 0) {
+      --tv.tv_sec;
+      tv.tv_usec += 1000000L;
+    }
+    return matador::time(tv);
+  }
+
+private:
+  bool binary_date_time_ = false;
 };
 
 }
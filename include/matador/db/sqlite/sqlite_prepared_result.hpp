@@ -57,12 +57,16 @@ protected:
   virtual void serialize(const char *id, basic_identifier &x) override;
   virtual void serialize(const char *id, identifiable_holder&x, cascade_type) override;
 
-private:
+  void throw_step_error() const;
+
+protected:
+  sqlite3_stmt *stmt_;
   int ret_;
   bool first_;
+
+private:
   size_type rows;
   size_type fields_;
-  sqlite3_stmt *stmt_;
 };
 
 }
@@ -0,0 +1,51 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_SQLITE_QUERY_RESULT_HPP
+#define OOS_SQLITE_QUERY_RESULT_HPP
+
+#include "matador/db/sqlite/sqlite_prepared_result.hpp"
+
+namespace matador {
+
+namespace sqlite {
+
+/**
+ * @brief Streaming result of a direct sqlite query
+ *
+ * The result holds the sqlite statement of a directly
+ * executed query and steps through the result set
+ * row by row. Only the current row is held in memory
+ * and all columns are read with their type.
+ *
+ * While there are unread rows the statement holds
+ * a read lock on the database. Writes and schema
+ * changes of other connections fail with a busy
+ * error until all rows are read or the result is
+ * destroyed. Once an object is read the result
+ * steps to the next row at once, so the lock is
+ * released right after the last row was read.
+ *
+ * Once the result is destroyed the statement is
+ * finalized.
+ */
+class sqlite_query_result : public sqlite_prepared_result
+{
+private:
+  sqlite_query_result(const sqlite_query_result &) = delete;
+  sqlite_query_result &operator=(const sqlite_query_result &) = delete;
+
+public:
+  sqlite_query_result(sqlite3_stmt *stmt, int ret);
+  ~sqlite_query_result() override;
+
+protected:
+  bool finalize_fetch() override;
+};
+
+}
+
+}
+
+#endif //OOS_SQLITE_QUERY_RESULT_HPP
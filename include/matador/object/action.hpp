@@ -67,8 +67,7 @@ public:
   typedef void (*t_backup_func)(byte_buffer&, action*, object_serializer &serializer);
 
 public:
-  action();
-  virtual ~action();
+  virtual ~action() = default;
   
   /**
    * @brief Interface to accept the action.
@@ -81,24 +80,23 @@ public:
    * @brief Backup the object to the given byte_buffer
    *
    * @param to The byte_buffer to backup to
+   * @param serializer The serializer used to write the object
    */
-  virtual void backup(byte_buffer &to) = 0;
+  virtual void backup(byte_buffer &to, object_serializer &serializer) = 0;
 
   /**
    * @brief Restores an object from given byte_buffer into given object_store
    *
    * @param from byte_buffer to restore from
    * @param store object_store to insert in
+   * @param serializer The serializer used to read the object
    */
-  virtual void restore(byte_buffer &from, object_store *store) = 0;
+  virtual void restore(byte_buffer &from, object_store *store, object_serializer &serializer) = 0;
 
 protected:
   static void remove_proxy(object_proxy *proxy, object_store *store);
   static object_proxy* find_proxy(object_store *store, unsigned long id);
   static void insert_proxy(object_store *store, object_proxy *proxy);
-
-protected:
-  object_serializer *serializer_;
 };
 
 /// @endcond
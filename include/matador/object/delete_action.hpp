@@ -85,9 +85,9 @@ public:
 
   object_proxy* proxy() const;
 
-  virtual void backup(byte_buffer &buffer);
+  virtual void backup(byte_buffer &buffer, object_serializer &serializer);
 
-  virtual void restore(byte_buffer &buffer, object_store *store);
+  virtual void restore(byte_buffer &buffer, object_store *store, object_serializer &serializer);
 
   void mark_deleted();
 
@@ -0,0 +1,176 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_FIELD_SNAPSHOT_HPP
+#define OOS_FIELD_SNAPSHOT_HPP
+
+#ifdef _MSC_VER
+  #ifdef matador_object_EXPORTS
+    #define MATADOR_OBJECT_API __declspec(dllexport)
+    #define EXPIMP_OBJECT_TEMPLATE
+  #else
+    #define MATADOR_OBJECT_API __declspec(dllimport)
+    #define EXPIMP_OBJECT_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define MATADOR_OBJECT_API
+#endif
+
+#include "matador/utils/access.hpp"
+#include "matador/utils/byte_buffer.hpp"
+#include "matador/utils/cascade_type.hpp"
+
+#include "matador/object/object_holder_type.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace matador {
+
+template < class T, object_holder_type OHT >
+class object_pointer;
+template < class T, template <class ...> class C >
+class basic_has_many;
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+// begin and end of each field in a byte buffer
+typedef std::vector<std::pair<std::size_t, std::size_t>> t_field_range_vector;
+
+/**
+ * Forwards the fields of an object to the given
+ * object serializer and records the byte range
+ * each field was written to in the buffer.
+ */
+template < class S >
+class field_recorder
+{
+public:
+  field_recorder(S &serializer, const byte_buffer &buffer, t_field_range_vector &ranges)
+    : serializer_(serializer)
+    , buffer_(buffer)
+    , ranges_(ranges)
+  {}
+
+  template < class T >
+  void serialize(T &obj)
+  {
+    matador::access::serialize(*this, obj);
+  }
+
+  template < class T >
+  void serialize(const char *id, T &x)
+  {
+    std::size_t begin = buffer_.size();
+    serializer_.serialize(id, x);
+    ranges_.emplace_back(begin, buffer_.size());
+  }
+
+  void serialize(const char *id, char *x, size_t s)
+  {
+    std::size_t begin = buffer_.size();
+    serializer_.serialize(id, x, s);
+    ranges_.emplace_back(begin, buffer_.size());
+  }
+
+  template < class T, object_holder_type OHT >
+  void serialize(const char *id, object_pointer<T, OHT> &x, cascade_type cascade)
+  {
+    std::size_t begin = buffer_.size();
+    serializer_.serialize(id, x, cascade);
+    ranges_.emplace_back(begin, buffer_.size());
+  }
+
+  // relations to many objects aren't fields
+  template < class T, template <class ...> class C >
+  void serialize(const char *id, basic_has_many<T, C> &x, const char *owner_field, const char *item_field, cascade_type cascade)
+  {
+    serializer_.serialize(id, x, owner_field, item_field, cascade);
+  }
+
+  template < class T, template <class ...> class C >
+  void serialize(const char *id, basic_has_many<T, C> &x, cascade_type cascade)
+  {
+    serializer_.serialize(id, x, cascade);
+  }
+
+private:
+  S &serializer_;
+  const byte_buffer &buffer_;
+  t_field_range_vector &ranges_;
+};
+
+/**
+ * Keeps the byte ranges of the fields of an object
+ * within its backup to determine which fields were
+ * changed later. The bytes aren't copied, the backup
+ * buffer must outlive the snapshot.
+ *
+ * The fields are numbered in the order they are
+ * serialized. Identifiers and relations to single
+ * objects count as one field each, relations to
+ * many objects aren't fields. This is the same
+ * order in which the columns of a table are
+ * serialized.
+ */
+class MATADOR_OBJECT_API field_snapshot
+{
+public:
+  /**
+   * Serializes the given object with the given
+   * serializer into the buffer and keeps the byte
+   * ranges of its fields.
+   */
+  template < class T, class S >
+  void take(T &obj, byte_buffer &buffer, S &serializer)
+  {
+    clear();
+    buffer_ = &buffer;
+    field_recorder<S> recorder(serializer, buffer, ranges_);
+    serializer.serialize(&obj, &buffer, recorder);
+  }
+
+  /**
+   * Compares the field values of the given object with
+   * this snapshot. Each changed field is marked true
+   * in the returned list. If there is no snapshot
+   * an empty list is returned.
+   */
+  template < class T, class S >
+  std::vector<bool> changed(T &obj, S &serializer) const
+  {
+    if (empty()) {
+      return std::vector<bool>();
+    }
+    byte_buffer buffer;
+    field_snapshot current;
+    current.take(obj, buffer, serializer);
+    return diff(current);
+  }
+
+  /**
+   * Compares the field values of the given
+   * snapshot with this snapshot.
+   */
+  std::vector<bool> diff(const field_snapshot &current) const;
+
+  bool empty() const;
+  std::size_t size() const;
+  void clear();
+
+private:
+  const byte_buffer *buffer_ = nullptr;
+  t_field_range_vector ranges_;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_FIELD_SNAPSHOT_HPP
@@ -5,11 +5,31 @@
 #ifndef OOS_IDENTIFIER_PROXY_MAP_HPP
 #define OOS_IDENTIFIER_PROXY_MAP_HPP
 
+#ifdef _MSC_VER
+  #ifdef matador_object_EXPORTS
+    #define MATADOR_OBJECT_API __declspec(dllexport)
+    #define EXPIMP_OBJECT_TEMPLATE
+  #else
+    #define MATADOR_OBJECT_API __declspec(dllimport)
+    #define EXPIMP_OBJECT_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define MATADOR_OBJECT_API
+#endif
+
 #include "matador/utils/basic_identifier.hpp"
+#include "matador/utils/identifier.hpp"
 
 #include "matador/object/basic_has_many_item_holder.hpp"
 
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 namespace matador {
 class object_proxy;
@@ -41,7 +61,216 @@ public:
 };
 
 typedef std::shared_ptr<basic_identifier> identifier_ptr; /**< Shortcut to shared identifier ptr */
-typedef std::unordered_map<identifier_ptr, object_proxy*, identifier_hash<identifier_ptr>, identifier_equal> t_identifier_map;
+
+/**
+ * The raw value of an integral or string
+ * identifier used as key of the
+ * identifier_proxy_map.
+ */
+struct identifier_key
+{
+  enum key_type {
+    NONE,
+    INTEGRAL,
+    STRING
+  };
+
+  key_type type = NONE;
+  const std::type_info *value_type = nullptr; /**< The type of the identifiers value, nullptr for a raw integral value */
+  std::uint64_t value = 0; /**< The integral value or the hash of the string */
+  const std::string *str = nullptr;
+
+  /**
+   * Extracts the raw value of the given
+   * identifier. The type is NONE if the
+   * identifier is neither integral nor
+   * a string.
+   */
+  static identifier_key of(const basic_identifier &id);
+
+  /**
+   * Extracts the raw value of the given typed
+   * identifier without a virtual call.
+   */
+  template < class T >
+  static identifier_key of(const identifier<T> &id, typename std::enable_if<std::is_integral<T>::value>::type* = 0)
+  {
+    identifier_key key = of(static_cast<std::uint64_t>(id.value()));
+    key.value_type = &typeid(T);
+    return key;
+  }
+  static identifier_key of(const identifier<std::string> &id)
+  {
+    return of(id.reference());
+  }
+
+  /**
+   * Creates the key of a raw integral value.
+   * It matches integral identifiers of any
+   * type with the same value.
+   */
+  static identifier_key of(std::uint64_t value);
+  static identifier_key of(const std::string &value);
+};
+
+/**
+ * Maps the primary keys of objects to their
+ * object proxies.
+ *
+ * The map is an open addressing hash table
+ * with linear probing keyed on the raw
+ * integral or string value of the identifiers.
+ * Looking up a proxy doesn't allocate and
+ * compares the raw values instead of calling
+ * the virtual comparison of the identifiers.
+ *
+ * All identifiers of a map must be of the same
+ * type. Erased slots are marked as deleted, so
+ * erasing doesn't move other entries.
+ */
+class MATADOR_OBJECT_API identifier_proxy_map
+{
+private:
+  typedef std::pair<identifier_ptr, object_proxy*> t_entry;
+
+  enum slot_state {
+    EMPTY,
+    OCCUPIED,
+    DELETED
+  };
+
+  struct slot
+  {
+    slot_state state = EMPTY;
+    std::uint64_t key = 0;
+    t_entry entry;
+  };
+
+  typedef std::vector<slot> t_slot_vector;
+
+  template < class S, class E >
+  class basic_iterator : public std::iterator<std::forward_iterator_tag, E>
+  {
+  public:
+    basic_iterator() = default;
+    basic_iterator(S *current, S *last)
+      : current_(current), last_(last)
+    {
+      skip_empty();
+    }
+    template < class S2, class E2 >
+    basic_iterator(const basic_iterator<S2, E2> &x)
+      : current_(x.current_), last_(x.last_)
+    {}
+
+    E& operator*() const { return current_->entry; }
+    E* operator->() const { return &current_->entry; }
+
+    basic_iterator& operator++()
+    {
+      ++current_;
+      skip_empty();
+      return *this;
+    }
+    basic_iterator operator++(int)
+    {
+      basic_iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const basic_iterator &x) const { return current_ == x.current_; }
+    bool operator!=(const basic_iterator &x) const { return current_ != x.current_; }
+
+  private:
+    friend class identifier_proxy_map;
+    template < class S2, class E2 > friend class basic_iterator;
+
+    void skip_empty()
+    {
+      while (current_ != last_ && current_->state != OCCUPIED) {
+        ++current_;
+      }
+    }
+
+    S *current_ = nullptr;
+    S *last_ = nullptr;
+  };
+
+public:
+  typedef t_entry value_type;                                      /**< Shortcut to the value type */
+  typedef basic_iterator<slot, value_type> iterator;               /**< Shortcut to the iterator */
+  typedef basic_iterator<const slot, const value_type> const_iterator; /**< Shortcut to the const iterator */
+
+  /**
+   * Inserts the proxy for the given primary key.
+   * If the key already exists the existing
+   * entry is returned and false.
+   */
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  /**
+   * Inserts the proxy for the primary key
+   * with the given already extracted key.
+   */
+  std::pair<iterator, bool> insert(const identifier_key &key, const value_type &value);
+
+  iterator find(const identifier_ptr &pk);
+  const_iterator find(const identifier_ptr &pk) const;
+  iterator find(const basic_identifier &pk);
+  const_iterator find(const basic_identifier &pk) const;
+  iterator find(const identifier_key &key);
+  const_iterator find(const identifier_key &key) const;
+
+  /**
+   * Returns the proxy of the given raw
+   * integral or string primary key
+   * or nullptr if there is none.
+   */
+  object_proxy* find_proxy(std::uint64_t pk) const;
+  object_proxy* find_proxy(const std::string &pk) const;
+  object_proxy* find_proxy(const identifier_key &key) const;
+
+  std::size_t erase(const identifier_ptr &pk);
+  std::size_t erase(const basic_identifier &pk);
+
+  /**
+   * Erases the entry of the given iterator.
+   * Only iterators to the erased entry
+   * are invalidated.
+   */
+  void erase(iterator i);
+
+  void clear();
+  void reserve(std::size_t size);
+
+  std::size_t size() const;
+  bool empty() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  std::size_t find_slot(const identifier_key &key) const;
+  std::size_t home_of(std::uint64_t key) const;
+  bool is_same_type(const identifier_key &key) const;
+  bool matches(const slot &s, const identifier_key &key) const;
+  void erase_slot(std::size_t pos);
+  void rehash(std::size_t capacity);
+
+private:
+  identifier_key::key_type type_ = identifier_key::NONE;
+  const std::type_info *value_type_ = nullptr;
+
+  // capacity is zero or a power of two
+  t_slot_vector slots_;
+  std::size_t size_ = 0;
+  std::size_t deleted_ = 0;
+};
+
+typedef identifier_proxy_map t_identifier_map; /**< Shortcut to the identifier to proxy map */
 typedef std::unordered_multimap<identifier_ptr, std::shared_ptr<basic_has_many_item_holder>, identifier_hash<identifier_ptr>, identifier_equal> t_identifier_multimap;
 
 /// @endcond
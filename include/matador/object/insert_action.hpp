@@ -80,9 +80,9 @@ public:
 
   iterator erase(iterator i);
 
-  virtual void backup(byte_buffer &) { }
+  virtual void backup(byte_buffer &, object_serializer &) { }
 
-  virtual void restore(byte_buffer &, object_store *store);
+  virtual void restore(byte_buffer &, object_store *store, object_serializer &);
 
 private:
   std::string type_;
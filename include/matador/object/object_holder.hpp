@@ -257,6 +257,12 @@ public:
   /**
    * Returns the object pointer
    *
+   * If the object isn't loaded yet and lazy
+   * loading is enabled it is selected from the
+   * database on demand. So even this const access
+   * may do database I/O and throw on database
+   * errors.
+   *
    * @return The object pointer.
    */
   void* lookup_object() const;
@@ -385,6 +391,9 @@ private:
   friend struct detail::basic_relation_endpoint;
 
   object_proxy *proxy_ = nullptr;
+  // intrusive list of all holders of proxy
+  object_holder *prev_holder_ = nullptr;
+  object_holder *next_holder_ = nullptr;
   object_proxy *owner_ = nullptr; // only set if holder type is BELONGS_TO or HAS_MANY
   cascade_type cascade_ = cascade_type::NONE;
   object_holder_type type_ = object_holder_type::OBJECT_PTR;
@@ -0,0 +1,102 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_OBJECT_ID_MAP_HPP
+#define OOS_OBJECT_ID_MAP_HPP
+
+#ifdef _MSC_VER
+  #ifdef matador_object_EXPORTS
+    #define MATADOR_OBJECT_API __declspec(dllexport)
+    #define EXPIMP_OBJECT_TEMPLATE
+  #else
+    #define MATADOR_OBJECT_API __declspec(dllimport)
+    #define EXPIMP_OBJECT_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define MATADOR_OBJECT_API
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace matador {
+
+class object_proxy;
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Maps the object store ids to their object proxies.
+ *
+ * The ids are handed out by the sequencer of the
+ * object store and are therefore dense. They are
+ * used as direct index into fixed size pages of
+ * proxy pointers. Pages are allocated on first
+ * use and freed once they are empty again.
+ *
+ * Ids far beyond the range of the used pages
+ * (i.e. set from outside) are kept in an overflow
+ * hash map to bound the size of the page directory.
+ */
+class MATADOR_OBJECT_API object_id_map
+{
+public:
+  static const std::size_t PAGE_SIZE = 4096; /**< Number of ids per page */
+
+  object_id_map() = default;
+  object_id_map(const object_id_map&) = delete;
+  object_id_map& operator=(const object_id_map&) = delete;
+
+  /**
+   * Inserts the proxy with the given id. If
+   * the id already exists the existing proxy
+   * is kept. Returns the proxy of the id.
+   */
+  object_proxy* insert(unsigned long id, object_proxy *proxy);
+
+  object_proxy* find(unsigned long id) const;
+
+  /**
+   * Erases the proxy of the given id.
+   * Returns the number of erased proxies.
+   */
+  std::size_t erase(unsigned long id);
+
+  void clear();
+
+  std::size_t size() const;
+  bool empty() const;
+
+  /**
+   * Returns the number of allocated pages
+   */
+  std::size_t page_count() const;
+
+private:
+  struct page
+  {
+    object_proxy* proxies[PAGE_SIZE] = {};
+    std::size_t size = 0;
+  };
+
+  bool in_directory(std::size_t page_index) const;
+
+private:
+  std::vector<std::unique_ptr<page>> pages_;
+  std::size_t page_count_ = 0;
+  std::unordered_map<unsigned long, object_proxy*> overflow_;
+  std::size_t size_ = 0;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_OBJECT_ID_MAP_HPP
@@ -0,0 +1,210 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_OBJECT_INDEX_HPP
+#define OOS_OBJECT_INDEX_HPP
+
+#ifdef _MSC_VER
+  #ifdef matador_object_EXPORTS
+    #define MATADOR_OBJECT_API __declspec(dllexport)
+    #define EXPIMP_OBJECT_TEMPLATE
+  #else
+    #define MATADOR_OBJECT_API __declspec(dllimport)
+    #define EXPIMP_OBJECT_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define MATADOR_OBJECT_API
+#endif
+
+#include "matador/object/object_proxy.hpp"
+#include "matador/object/has_one.hpp"
+#include "matador/object/belongs_to.hpp"
+#include "matador/object/generic_access.hpp"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace matador {
+
+/**
+ * @brief The type of a secondary object index
+ */
+enum class index_type
+{
+  HASH,   /**< Hash index for equality lookups */
+  ORDERED /**< Ordered index for equality and range lookups */
+};
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Base class of all secondary indexes of a
+ * prototype node. An index maps the value of
+ * one attribute of an object to its proxy.
+ *
+ * Objects are indexed on insertion. Because an
+ * object is marked modified before it is changed,
+ * a modified object is only removed from the
+ * index and reindexed with its current value
+ * on the next lookup.
+ */
+class MATADOR_OBJECT_API basic_object_index
+{
+public:
+  basic_object_index(const std::string &field, index_type type);
+  virtual ~basic_object_index();
+
+  basic_object_index(const basic_object_index&) = delete;
+  basic_object_index& operator=(const basic_object_index&) = delete;
+
+  const std::string& field() const;
+  index_type type() const;
+
+  void insert(object_proxy *proxy);
+  void remove(object_proxy *proxy);
+  void mark_modified(object_proxy *proxy);
+  void clear();
+
+  /**
+   * Reindexes all modified objects
+   */
+  void refresh();
+
+protected:
+  virtual void insert_key(object_proxy *proxy) = 0;
+  virtual void remove_key(object_proxy *proxy) = 0;
+  virtual void clear_keys() = 0;
+
+private:
+  std::string field_;
+  index_type type_;
+
+  std::unordered_set<object_proxy*> modified_;
+};
+
+template < class V >
+class object_index : public basic_object_index
+{
+public:
+  object_index(const std::string &field, index_type type)
+    : basic_object_index(field, type)
+  {}
+
+  /**
+   * Appends all proxies with the given value
+   */
+  virtual void find(const V &value, std::vector<object_proxy*> &proxies) = 0;
+
+  /**
+   * Appends all proxies with a value between from and
+   * to ordered by value. Returns false if the index
+   * doesn't support range lookups.
+   */
+  virtual bool range(const V &from, const V &to, std::vector<object_proxy*> &proxies) = 0;
+};
+
+template < class T, class V, class M >
+class basic_typed_object_index : public object_index<V>
+{
+public:
+  basic_typed_object_index(const std::string &field, index_type type)
+    : object_index<V>(field, type)
+  {}
+
+  void find(const V &value, std::vector<object_proxy*> &proxies) override
+  {
+    this->refresh();
+    auto range = keys_.equal_range(value);
+    for (auto i = range.first; i != range.second; ++i) {
+      proxies.push_back(i->second);
+    }
+  }
+
+protected:
+  void insert_key(object_proxy *proxy) override
+  {
+    V value{};
+    if (!matador::get(*static_cast<T*>(proxy->obj()), this->field(), value)) {
+      return;
+    }
+    keys_.insert(std::make_pair(value, proxy));
+    values_.insert(std::make_pair(proxy, value));
+  }
+
+  void remove_key(object_proxy *proxy) override
+  {
+    auto i = values_.find(proxy);
+    if (i == values_.end()) {
+      return;
+    }
+    auto range = keys_.equal_range(i->second);
+    for (auto j = range.first; j != range.second; ++j) {
+      if (j->second == proxy) {
+        keys_.erase(j);
+        break;
+      }
+    }
+    values_.erase(i);
+  }
+
+  void clear_keys() override
+  {
+    keys_.clear();
+    values_.clear();
+  }
+
+protected:
+  M keys_;
+  // the indexed value of each proxy
+  std::unordered_map<object_proxy*, V> values_;
+};
+
+template < class T, class V >
+class hash_object_index : public basic_typed_object_index<T, V, std::unordered_multimap<V, object_proxy*>>
+{
+public:
+  explicit hash_object_index(const std::string &field)
+    : basic_typed_object_index<T, V, std::unordered_multimap<V, object_proxy*>>(field, index_type::HASH)
+  {}
+
+  bool range(const V &, const V &, std::vector<object_proxy*> &) override
+  {
+    return false;
+  }
+};
+
+template < class T, class V >
+class ordered_object_index : public basic_typed_object_index<T, V, std::multimap<V, object_proxy*>>
+{
+public:
+  explicit ordered_object_index(const std::string &field)
+    : basic_typed_object_index<T, V, std::multimap<V, object_proxy*>>(field, index_type::ORDERED)
+  {}
+
+  bool range(const V &from, const V &to, std::vector<object_proxy*> &proxies) override
+  {
+    this->refresh();
+    if (to < from) {
+      return true;
+    }
+    auto last = this->keys_.upper_bound(to);
+    for (auto i = this->keys_.lower_bound(from); i != last; ++i) {
+      proxies.push_back(i->second);
+    }
+    return true;
+  }
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_OBJECT_INDEX_HPP
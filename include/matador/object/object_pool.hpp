@@ -0,0 +1,162 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_OBJECT_POOL_HPP
+#define OOS_OBJECT_POOL_HPP
+
+#ifdef _MSC_VER
+  #ifdef matador_object_EXPORTS
+    #define MATADOR_OBJECT_API __declspec(dllexport)
+    #define EXPIMP_OBJECT_TEMPLATE
+  #else
+    #define MATADOR_OBJECT_API __declspec(dllimport)
+    #define EXPIMP_OBJECT_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define MATADOR_OBJECT_API
+#endif
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace matador {
+
+/**
+ * @brief Slab allocation settings of a prototype
+ *
+ * Passed to object_store::attach the objects and
+ * object proxies of the attached prototype are
+ * allocated from slab allocators of its prototype
+ * node instead of the heap. Objects of one type
+ * are placed contiguously and their memory is
+ * freed in bulk when the object store is cleared.
+ */
+struct slab_allocation
+{
+  /**
+   * Creates slab allocation settings
+   *
+   * @param per_slab Number of objects per slab
+   */
+  explicit slab_allocation(std::size_t per_slab = 1024)
+    : objects_per_slab(per_slab)
+  {}
+
+  std::size_t objects_per_slab; /**< Number of objects per slab */
+};
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * A slab allocator for elements of one size.
+ *
+ * Memory is requested in slabs holding a fixed
+ * number of elements. Freed elements are kept in
+ * a free list and reused before the current slab
+ * is consumed. The slabs are only given back in
+ * bulk on release() or destruction of the pool.
+ *
+ * The pool of an element isn't determined by
+ * its address. Whoever allocates an element keeps
+ * the pool to deallocate it later.
+ */
+class MATADOR_OBJECT_API object_pool
+{
+public:
+  object_pool(std::size_t element_size, std::size_t elements_per_slab);
+  ~object_pool();
+
+  object_pool(const object_pool&) = delete;
+  object_pool& operator=(const object_pool&) = delete;
+
+  void* allocate();
+  void deallocate(void *p);
+
+  /**
+   * Returns true if the given element
+   * lies in one of the slabs of this pool
+   */
+  bool owns(const void *p) const;
+
+  /**
+   * Frees all slabs at once. Returns false
+   * and keeps the slabs if there are still
+   * allocated elements.
+   */
+  bool release();
+
+  std::size_t size() const;
+  std::size_t slab_count() const;
+  std::size_t element_size() const;
+  std::size_t elements_per_slab() const;
+
+private:
+  void add_slab();
+  void free_slabs();
+
+private:
+  struct free_element
+  {
+    free_element *next;
+  };
+
+  std::size_t element_size_ = 0;
+  std::size_t elements_per_slab_ = 0;
+  std::size_t size_ = 0;
+
+  std::vector<char*> slabs_;
+  free_element *free_ = nullptr;
+  // unused memory of the last slab
+  char *next_ = nullptr;
+  char *end_ = nullptr;
+
+  mutable std::mutex mutex_;
+};
+
+/**
+ * Deletes the given object or, if it was
+ * allocated from the given object pool, destroys
+ * it and gives its memory back to the pool.
+ */
+template < class T >
+void delete_object(T *obj, object_pool *pool)
+{
+  if (pool == nullptr) {
+    delete obj;
+    return;
+  }
+  obj->~T();
+  pool->deallocate(obj);
+}
+
+/**
+ * Deleter of objects allocated from
+ * the given object pool or from the heap
+ * if the pool is nullptr
+ */
+template < class T >
+struct pooled_object_deleter
+{
+  explicit pooled_object_deleter(object_pool *p = nullptr)
+    : pool(p)
+  {}
+
+  void operator()(T *obj) const
+  {
+    delete_object(obj, pool);
+  }
+
+  object_pool *pool;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_OBJECT_POOL_HPP
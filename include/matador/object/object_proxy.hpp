@@ -35,6 +35,7 @@
 
 #include "matador/object/prototype_node.hpp"
 #include "matador/object/object_holder_type.hpp"
+#include "matador/object/object_exception.hpp"
 
 #include <ostream>
 #include <set>
@@ -81,8 +82,7 @@ public:
   template < class T >
   explicit object_proxy(const std::shared_ptr<basic_identifier> &pk, T *obj, prototype_node *node)
     : obj_(obj)
-    , deleter_(&destroy<T>)
-    , namer_(&type_id<T>)
+    , ops_(type_ops_of<T>())
     , ostore_(node->tree())
     , node_(node)
     , primary_key_(pk)
@@ -99,8 +99,7 @@ public:
   template < typename T >
   explicit object_proxy(T *o)
     : obj_(o)
-    , deleter_(&destroy<T>)
-    , namer_(&type_id<T>)
+    , ops_(type_ops_of<T>())
   {
     primary_key_.reset(identifier_resolver<T>::resolve(o));
   }
@@ -118,8 +117,7 @@ public:
   template < typename T >
   object_proxy(T *o, unsigned long id, object_store *os)
     : obj_(o)
-    , deleter_(&destroy<T>)
-    , namer_(&type_id<T>)
+    , ops_(type_ops_of<T>())
     , oid(id)
     , ostore_(os)
   {
@@ -130,6 +128,68 @@ public:
 
   ~object_proxy();
 
+  /**
+   * Allocates an object_proxy from the heap
+   *
+   * @param size Size of the object_proxy
+   * @return The allocated memory
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * Allocates an object_proxy from the given slab
+   * allocator or from the heap if it is nullptr
+   *
+   * @param size Size of the object_proxy
+   * @param pool The slab allocator
+   * @return The allocated memory
+   */
+  static void* operator new(std::size_t size, detail::object_pool *pool);
+
+  /**
+   * Gives the memory of an object_proxy back
+   * to its slab allocator or to the heap
+   *
+   * @param p The memory of the object_proxy
+   */
+  static void operator delete(void *p);
+
+  /**
+   * Gives the memory of an object_proxy back
+   * if its construction failed
+   *
+   * @param p The memory of the object_proxy
+   * @param pool The slab allocator
+   */
+  static void operator delete(void *p, detail::object_pool *pool);
+
+  /**
+   * Returns the size of one object_proxy
+   * element in a slab allocator. In front
+   * of each proxy its allocator is stored.
+   *
+   * @return The size of a proxy element
+   */
+  static std::size_t allocation_size();
+
+  /**
+   * Sets the slab allocator the object of
+   * the proxy was allocated from. Once the
+   * proxy is destroyed the object is given
+   * back to it. Must be set after each reset.
+   *
+   * @param pool The slab allocator or nullptr for the heap
+   */
+  void object_allocator(detail::object_pool *pool);
+
+  /**
+   * Returns the slab allocator of the object
+   * or nullptr if the object is on the heap
+   *
+   * @return The slab allocator of the object
+   */
+  detail::object_pool* object_allocator() const;
+
   /**
    * Return the classname/typeid of the object
    *
@@ -176,17 +236,35 @@ public:
    */
   prototype_node* node() const;
 
+  /**
+   * Loads the object on demand if the proxy
+   * is a placeholder holding only the primary
+   * key and the prototype node of its object.
+   * With lazy loading enabled this selects the
+   * object from the database.
+   *
+   * @return True if the proxy holds an object
+   */
+  bool load();
+
   /**
    * Release the object from proxies
    * responsibility. After release the user
    * is responsible for object.
    *
+   * Objects allocated from the slabs of a
+   * prototype node can't be released, an
+   * object_exception is thrown.
+   *
    * @tparam The type of the object
    * @return The released object
    */
   template < class T >
   T* release()
   {
+    if (object_pool_ != nullptr) {
+      throw_object_exception("object is allocated from slabs and can't be released");
+    }
     T* tmp = obj<T>();
     obj_ = nullptr;
     return tmp;
@@ -256,19 +334,24 @@ public:
 
   /**
    * Resets the object of the object_proxy
-   * with the given object.
+   * with the given object. If the object was
+   * allocated from slabs their object pool
+   * must be given to delete it later.
    *
    * @param o The new object for the object_proxy
+   * @param resolve_identifier True if the primary key is resolved
+   * @param keep_ref_count True if the reference count is kept
+   * @param pool The object pool of the object or nullptr for the heap
    */
   template < typename T >
-  void reset(T *o, bool resolve_identifier = true, bool keep_ref_count = false)
+  void reset(T *o, bool resolve_identifier = true, bool keep_ref_count = false, detail::object_pool *pool = nullptr)
   {
     if (!keep_ref_count) {
       reference_counter_ = 0;
     }
-    deleter_ = &destroy<T>;
-    namer_ = &type_id<T>;
+    ops_ = type_ops_of<T>();
     obj_ = o;
+    object_pool_ = pool;
     oid = 0;
     node_ = 0;
     if (obj_ != nullptr && resolve_identifier) {
@@ -300,6 +383,14 @@ public:
    */
   bool remove(object_holder *ptr);
 
+  /**
+   * Returns true if at least one object_holder
+   * contains this object_proxy.
+   *
+   * @return True if object_proxy is held.
+   */
+  bool has_holders() const;
+
   /**
    * @brief True if proxy is valid
    * 
@@ -357,13 +448,31 @@ private:
   friend class object_holder;
   template < class T, object_holder_type OHT > friend class object_pointer;
 
-  typedef void (*deleter)(void*);
+  typedef void (*deleter)(void*, detail::object_pool*);
   typedef const char* (*namer)();
 
+  /*
+   * The type dependent operations of an
+   * object. There is one static instance
+   * per type shared by all its proxies.
+   */
+  struct type_ops
+  {
+    deleter destroy;
+    namer name;
+  };
+
+  template < class T >
+  static const type_ops* type_ops_of()
+  {
+    static const type_ops ops { &destroy<T>, &type_id<T> };
+    return &ops;
+  }
+
   template <typename T>
-  static void destroy(void* p)
+  static void destroy(void* p, detail::object_pool *pool)
   {
-    delete (T*)p;
+    detail::delete_object((T*)p, pool);
   }
 
   template < class T >
@@ -376,8 +485,8 @@ private:
   object_proxy *next_ = nullptr;      /**< The next object_proxy in the list. */
 
   void *obj_ = nullptr;         /**< The concrete object. */
-  deleter deleter_;             /**< The object deleter function */
-  namer namer_;                 /**< The object classname function */
+  const type_ops *ops_ = nullptr; /**< The object deleter and classname functions */
+  detail::object_pool *object_pool_ = nullptr; /**< The slab allocator of the object or nullptr if it is on the heap */
   unsigned long oid = 0;        /**< The id of the concrete or expected object. */
 
   unsigned long reference_counter_ = 0;
@@ -385,10 +494,11 @@ private:
   object_store *ostore_ = nullptr;    /**< The object_store to which the object_proxy belongs. */
   prototype_node *node_ = nullptr;    /**< The prototype_node containing the type of the object. */
 
-  typedef std::set<object_holder *> ptr_set_t; /**< Shortcut to the object_holder set. */
-  ptr_set_t ptr_set_;      /**< This set contains every object_holder pointing to this object_proxy. */
+  object_holder *holders_ = nullptr; /**< The head of the intrusive list of every object_holder pointing to this object_proxy. */
   
   std::shared_ptr<basic_identifier> primary_key_ = nullptr;
+
+  unsigned long miss_generation_ = 0; /**< The miss generation of the store in which the object wasn't found on demand. */
 };
 /// @endcond
 }
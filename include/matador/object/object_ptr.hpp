@@ -180,6 +180,13 @@ public:
    * Return the pointer to the serializable of type T. If there
    * isn't a valid serializable 0 (null) is returned.
    *
+   * Within a transaction the non const access backs up the
+   * object and marks it modified before it is returned. The
+   * const access and any access outside a transaction don't
+   * notify the store. A change outside a transaction must be
+   * announced with object_store::mark_modified() to keep the
+   * secondary indexes up to date.
+   *
    * @return The pointer to the serializable of type T.
    */
   T* operator->() const {
@@ -194,9 +201,11 @@ public:
     return static_cast<T*>(lookup_object());
   }
   T* get() {
-    if (proxy_ && proxy_->obj()) {
+    if (proxy_ && proxy_->load()) {
       if (proxy_->ostore_ && proxy_->has_transaction()) {
-        proxy_->current_transaction().on_update<T>(proxy_);
+        // the object is handed out for change, so
+        // the backup is taken before the change
+        proxy_->current_transaction().on_update<T>(proxy_, true);
       }
       return (T*)proxy_->obj();
     } else {
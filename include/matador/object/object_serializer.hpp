@@ -87,6 +87,24 @@ public:
     buffer_ = nullptr;
   }
 
+  /**
+   * Serialize the given object to the given buffer
+   * through a serializer forwarding each field to
+   * this serializer
+   *
+   * @param o The object to serialize.
+   * @param buffer The byte_buffer to serialize to.
+   * @param forwarder The forwarding serializer
+   */
+  template < class T, class F >
+  void serialize(T *o, byte_buffer *buffer, F &forwarder)
+  {
+    restore = false;
+    buffer_ = buffer;
+    matador::access::serialize(forwarder, *o);
+    buffer_ = nullptr;
+  }
+
   /**
    * Serialize the given serializable to the given buffer
    *
@@ -132,10 +150,7 @@ public:
     if (restore) {
       size_t len = 0;
       buffer_->release(&len, sizeof(len));
-      char *str = new char[len];
-      buffer_->release(str, len);
-      s.assign(str, len);
-      delete [] str;
+      s.assign(buffer_->view(len), len);
     } else {
       size_t len = s.size();
 
@@ -29,6 +29,9 @@
 #include "matador/object/object_serializer.hpp"
 #include "matador/object/basic_has_many.hpp"
 #include "matador/object/transaction.hpp"
+#include "matador/object/object_index.hpp"
+#include "matador/object/object_pool.hpp"
+#include "matador/object/object_id_map.hpp"
 
 #include "matador/utils/sequencer.hpp"
 #include "matador/utils/identifier_setter.hpp"
@@ -41,6 +44,7 @@
 #include <string>
 #include <ostream>
 #include <list>
+#include <map>
 #include <iostream>
 
 #ifdef _MSC_VER
@@ -208,6 +212,46 @@ public:
     return attach<T>(type, not_abstract, nullptr, observer);
   }
 
+  /**
+   * Inserts a new concrete object prototype into the object_store. The
+   * objects and object proxies of the prototype are allocated from slab
+   * allocators of its prototype node. They are placed contiguously and
+   * their memory is freed in bulk when the object_store is cleared.
+   * If parent name is given prototype node is inserted below the found parent
+   * node.
+   *
+   * @tparam T Type of the prototype
+   * @param type Name of the prototype
+   * @param allocation The slab allocation settings
+   * @param parent Name of the parent node
+   * @return Iterator representing the inserted prototype node
+   */
+  template <class T >
+  prototype_iterator attach(const char *type, const slab_allocation &allocation, const char *parent = nullptr)
+  {
+    prototype_iterator node = attach<T>(type, not_abstract, parent);
+    node->enable_slab_allocation(sizeof(T), allocation.objects_per_slab);
+    return node;
+  }
+
+  /**
+   * Inserts a new concrete object prototype into the prototype tree
+   * below the prototype of type S. The objects and object proxies
+   * of the prototype are allocated from slab allocators of its
+   * prototype node.
+   *
+   * @tparam T         The type of the prototype node
+   * @tparam S         The type of the parent prototype node
+   * @param type       The unique name of the type.
+   * @param allocation The slab allocation settings
+   * @return           Returns new inserted prototype iterator.
+   */
+  template<class T, class S >
+  prototype_iterator attach(const char *type, const slab_allocation &allocation)
+  {
+    return attach<T>(type, allocation, typeid(S).name());
+  }
+
   /**
    * Inserts a new object prototype into the prototype tree. The prototype
    * consists of a unique type name. To know where the new
@@ -419,6 +463,45 @@ public:
     return find(typeid(T).name());
   }
 
+  /**
+   * @brief Creates a secondary index on a field of type T.
+   *
+   * Creates a secondary index for the field of the given
+   * name. A hash index supports lookups by value, an
+   * ordered index supports lookups by value and by
+   * range. The index holds all objects of type T and
+   * its derived types and is kept up to date on insert,
+   * update and remove. Objects changed outside of a
+   * transaction must be marked modified to be reindexed.
+   *
+   * If the type or the field couldn't be found or
+   * there is already an index for the field an
+   * exception is thrown.
+   *
+   * @tparam T The object type to index
+   * @tparam V The value type of the indexed field
+   * @param field The name of the field to index
+   * @param type The type of the index
+   */
+  template < class T, class V >
+  void create_index(const std::string &field, index_type type = index_type::HASH)
+  {
+    iterator node = find<T>();
+    if (node == end()) {
+      throw_object_exception("couldn't find type " << typeid(T).name());
+    }
+    T prototype;
+    V value{};
+    if (!matador::get(prototype, field, value)) {
+      throw_object_exception("couldn't find field " << field << " of type " << node->type());
+    }
+    if (type == index_type::HASH) {
+      node->add_index(new detail::hash_object_index<T, V>(field));
+    } else {
+      node->add_index(new detail::ordered_object_index<T, V>(field));
+    }
+  }
+
   /**
    * Return the first prototype node.
    *
@@ -478,6 +561,31 @@ public:
    */
   size_t size() const;
 
+  /**
+   * Returns the count of objects of type T
+   * including the objects of all derived types.
+   * If the type couldn't be found zero is returned.
+   *
+   * @tparam T The object type
+   * @return The count of objects of type T
+   */
+  template < class T >
+  size_t object_count() const
+  {
+    const_iterator node = find<T>();
+    return (node != end() ? node->subtree_size() : 0);
+  }
+
+  /**
+   * Returns the count of objects of each
+   * prototype node by the type name of
+   * the node. Objects of derived types are
+   * only counted by their own type.
+   *
+   * @return The count of objects by type name
+   */
+  std::map<std::string, size_t> object_counts() const;
+
   /**
    * Returns true if the object_store
    * conatins no elements (objects)
@@ -568,6 +676,11 @@ public:
     proxy->id(seq_.next());
     proxy->ostore_ = this;
 
+    // the inserted object may be the one a missed reference points to
+    if (notify) {
+      forget_misses();
+    }
+
     // get object
     T *object = static_cast<T*>(proxy->obj());
     if (object && proxy->has_identifier() && !proxy->pk()->is_valid()) {
@@ -589,7 +702,7 @@ public:
     }
 
     // insert element into hash map for fast lookup
-    object_map_.insert(std::make_pair(proxy->id(), proxy));
+    object_map_.insert(proxy->id(), proxy);
 
     return proxy;
   }
@@ -609,13 +722,19 @@ public:
     }
     object_inserter_.reset();
 //    auto proxy = std::make_unique<object_proxy>(o);
-    std::unique_ptr<object_proxy> proxy(new object_proxy(o));
+    iterator node = find(typeid(T).name());
+    std::unique_ptr<object_proxy> proxy(new (node != end() ? node->proxy_allocator() : nullptr) object_proxy(o));
     try {
       insert<T>(proxy.get(), true);
     } catch (object_exception &ex) {
       proxy->release<T>();
       throw ex;
     }
+    if (node != end() && node->adopt(o)) {
+      // object was created by the node, the proxy
+      // gives it back to the slabs of the node
+      proxy->object_allocator(node->object_allocator());
+    }
 
     return object_ptr<T>(proxy.release());
   }
@@ -742,7 +861,7 @@ public:
   object_proxy *create_proxy(T *o)
   {
     std::unique_ptr<object_proxy> proxy(new object_proxy(o, seq_.next(), this));
-    return object_map_.insert(std::make_pair(seq_.current(), proxy.release())).first->second;
+    return object_map_.insert(seq_.current(), proxy.release());
   }
 
   /**
@@ -766,7 +885,7 @@ public:
   object_proxy *create_proxy(T *o, unsigned long oid)
   {
     std::unique_ptr<object_proxy> proxy(new object_proxy(o, oid, this));
-    return object_map_.insert(std::make_pair(oid, proxy.release())).first->second;
+    return object_map_.insert(oid, proxy.release());
   }
 
 //  object_proxy *create_proxy(unsigned long id);
@@ -843,6 +962,16 @@ public:
    */
   bool has_transaction() const;
 
+  /**
+   * Forgets the objects which weren't found
+   * when they were loaded on demand. So the next
+   * dereference of such a reference selects the
+   * object again.
+   *
+   * This is done on each insert and rollback.
+   */
+  void forget_misses();
+
   /**
    * Marks the given object proxy as modified
    * and notifies all transactions
@@ -855,6 +984,8 @@ public:
   {
     if (!transactions_.empty()) {
       transactions_.top().on_update<T>(proxy);
+    } else if (proxy->node()) {
+      proxy->node()->mark_modified(proxy);
     }
   }
 
@@ -980,11 +1111,14 @@ private:
   // typeid to prototype node map
   t_typeid_prototype_map typeid_prototype_map_;
 
-  typedef std::unordered_map<long, object_proxy *> t_object_proxy_map;
-  t_object_proxy_map object_map_;
+  // object id to proxy map
+  detail::object_id_map object_map_;
 
   sequencer seq_;
 
+  // a proxy missed in this generation isn't loaded on demand again
+  unsigned long miss_generation_ = 1;
+
   detail::object_deleter object_deleter_;
   detail::object_inserter object_inserter_;
 
@@ -23,9 +23,11 @@
 #include "matador/object/object_ptr.hpp"
 #include "matador/object/object_exception.hpp"
 #include "matador/object/prototype_node.hpp"
+#include "matador/object/object_index.hpp"
 
 #include <sstream>
 #include <algorithm>
+#include <vector>
 
 namespace matador {
 
@@ -618,7 +620,7 @@ public:
    * @return The size of the object_view.
    */
   size_t size() const {
-    return static_cast<size_t>(std::distance(begin(), end()));
+    return static_cast<size_t>(skip_siblings_ ? node_->size() : node_->subtree_size());
   }
   
   /**
@@ -659,6 +661,94 @@ public:
     return std::find_if(begin(), end(), pred);
   }
 
+  /**
+   * @brief Finds all objects with the given field value
+   *
+   * If a secondary index was created for the field
+   * the objects are looked up by the index. Otherwise
+   * all objects of the view are compared.
+   *
+   * @tparam V The value type of the field
+   * @param field The name of the field
+   * @param value The value to look up
+   * @return All objects with the given field value
+   */
+  template < class V >
+  std::vector<object_pointer> find_by(const std::string &field, const V &value) const
+  {
+    std::vector<object_pointer> objects;
+    auto index = dynamic_cast<detail::object_index<V>*>(node_->find_index(field));
+    if (index) {
+      std::vector<object_proxy*> proxies;
+      index->find(value, proxies);
+      append(proxies, objects);
+      return objects;
+    }
+    for (auto i = begin(); i != end(); ++i) {
+      object_pointer optr(*i);
+      V v{};
+      if (matador::get(*optr.get(), field, v) && v == value) {
+        objects.push_back(optr);
+      }
+    }
+    return objects;
+  }
+
+  /**
+   * @brief Finds all objects with the given field value
+   *
+   * @param field The name of the field
+   * @param value The value to look up
+   * @return All objects with the given field value
+   */
+  std::vector<object_pointer> find_by(const std::string &field, const char *value) const
+  {
+    return find_by(field, std::string(value));
+  }
+
+  /**
+   * @brief Finds all objects with a field value in the given range
+   *
+   * Returns all objects with a field value greater or
+   * equal than from and less or equal than to ordered
+   * by the field value. If an ordered secondary index
+   * was created for the field the objects are looked
+   * up by the index. Otherwise all objects of the view
+   * are compared and sorted.
+   *
+   * @tparam V The value type of the field
+   * @param field The name of the field
+   * @param from The lower bound of the range
+   * @param to The upper bound of the range
+   * @return All objects with a field value in the range
+   */
+  template < class V >
+  std::vector<object_pointer> range(const std::string &field, const V &from, const V &to) const
+  {
+    std::vector<object_pointer> objects;
+    auto index = dynamic_cast<detail::object_index<V>*>(node_->find_index(field));
+    std::vector<object_proxy*> proxies;
+    if (index && index->range(from, to, proxies)) {
+      append(proxies, objects);
+      return objects;
+    }
+    std::vector<std::pair<V, object_pointer>> values;
+    for (auto i = begin(); i != end(); ++i) {
+      object_pointer optr(*i);
+      V v{};
+      if (matador::get(*optr.get(), field, v) && !(v < from) && !(to < v)) {
+        values.push_back(std::make_pair(v, optr));
+      }
+    }
+    std::stable_sort(values.begin(), values.end(), [](const std::pair<V, object_pointer> &a, const std::pair<V, object_pointer> &b) {
+      return a.first < b.first;
+    });
+    for (auto &value : values) {
+      objects.push_back(value.second);
+    }
+    return objects;
+  }
+
   /**
    * Return the underlaying prototype node
    *
@@ -669,6 +759,17 @@ public:
     return node_.get();
   }
 
+private:
+  void append(const std::vector<object_proxy*> &proxies, std::vector<object_pointer> &objects) const
+  {
+    for (auto proxy : proxies) {
+      if (skip_siblings_ && proxy->node() != node_.get()) {
+        continue;
+      }
+      objects.push_back(object_pointer(proxy));
+    }
+  }
+
 private:
     bool skip_siblings_;
     prototype_iterator node_;
@@ -9,6 +9,7 @@
 #include "matador/object/relation_field_endpoint.hpp"
 
 #include <memory>
+#include <new>
 #include <vector>
 #include <unordered_map>
 
@@ -68,6 +69,7 @@ public:
 
   virtual void* prototype() const = 0;
   virtual void* create() const = 0;
+  virtual void* create(void *p) const = 0;
   virtual void register_observer(basic_object_store_observer *obs) = 0;
   virtual void notify(notification_type type) = 0;
 
@@ -147,6 +149,11 @@ public:
     return new T;
   }
 
+  void* create(void *p) const override
+  {
+    return new (p) T;
+  }
+
 };
 
 template < class T >
@@ -161,6 +168,11 @@ public:
   {
     return new T(this->get()->left_column(), this->get()->right_column());
   }
+
+  void* create(void *p) const override
+  {
+    return new (p) T(this->get()->left_column(), this->get()->right_column());
+  }
 };
 
 /// @endcond
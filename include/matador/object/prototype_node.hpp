@@ -38,12 +38,16 @@
 #include "matador/object/object_store_observer.hpp"
 #include "matador/object/relation_field_endpoint.hpp"
 #include "matador/object/prototype_info.hpp"
+#include "matador/object/object_pool.hpp"
 
+#include <functional>
 #include <map>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace matador {
 
@@ -60,6 +64,7 @@ class basic_node_analyzer;
 template < class T, template < class U = T > class O >
 class node_analyzer;
 class object_inserter;
+class basic_object_index;
 }
 /// @endcond
 
@@ -92,6 +97,8 @@ public:
   typedef detail::abstract_prototype_info::t_endpoint_map::const_iterator const_endpoint_iterator;
   typedef detail::abstract_prototype_info::t_endpoint_map::iterator endpoint_iterator;
 
+  typedef std::function<bool(object_proxy*)> t_object_loader;
+
   struct relation_node_info
   {
     std::shared_ptr<basic_identifier> owner_id_;
@@ -194,6 +201,14 @@ public:
    */
   unsigned long size() const;
 
+  /**
+   * Returns the count of objects of this node
+   * and all its child nodes.
+   *
+   * @return The number of objects in the subtree.
+   */
+  unsigned long subtree_size() const;
+
   /**
    * Return the type name of this node.
    *
@@ -256,12 +271,76 @@ public:
    * is checked. If the type is invalid nullptr
    * is returned.
    *
+   * With slab allocation the object is tagged as
+   * created by this node. Inserted into the object
+   * store its proxy gives it back to the slabs.
+   *
    * @tparam T Type of object to create
    * @return A new instance or nullptr
    */
   template < class T >
   T* create() const;
 
+  /**
+   * Create the represented object like create()
+   * but without tagging it. The caller keeps the
+   * object allocator of this node to delete it.
+   *
+   * @tparam T Type of object to create
+   * @return A new instance or nullptr
+   */
+  template < class T >
+  T* construct() const;
+
+  /**
+   * Removes the tag of an object created
+   * with create() and returns true if the
+   * object was created by this node.
+   *
+   * @param obj The object to check
+   * @return True if the object was created by this node
+   */
+  bool adopt(const void *obj);
+
+  /**
+   * Enables slab allocation for the objects and
+   * the object proxies of this node. Objects
+   * created by the node and object proxies created
+   * by the object store are allocated from slabs
+   * holding the given number of elements.
+   *
+   * Throws an object_exception if the node
+   * already contains objects.
+   *
+   * @param object_size Size of the represented object
+   * @param objects_per_slab Number of elements per slab
+   */
+  void enable_slab_allocation(std::size_t object_size, std::size_t objects_per_slab);
+
+  /**
+   * Returns true if slab allocation
+   * is enabled for this node
+   *
+   * @return True if slab allocation is enabled
+   */
+  bool has_slab_allocation() const;
+
+  /**
+   * Returns the slab allocator of the objects
+   * or nullptr if slab allocation isn't enabled
+   *
+   * @return The object slab allocator
+   */
+  detail::object_pool* object_allocator() const;
+
+  /**
+   * Returns the slab allocator of the object proxies
+   * or nullptr if slab allocation isn't enabled
+   *
+   * @return The object proxy slab allocator
+   */
+  detail::object_pool* proxy_allocator() const;
+
   /**
    * Returns nodes successor node or NULL if node is last.
    * 
@@ -399,6 +478,86 @@ public:
    */
   object_proxy* find_proxy(const std::shared_ptr<basic_identifier> &pk);
 
+  /**
+   * Find the underlying proxy of the given raw integral
+   * primary key without creating an identifier.
+   * If no proxy is found nullptr is returned
+   *
+   * @param pk The integral primary key value
+   * @return The corresponding object_proxy or nullptr
+   */
+  object_proxy* find_proxy(unsigned long pk) const;
+
+  /**
+   * Find the underlying proxy of the given raw string
+   * primary key without creating an identifier.
+   * If no proxy is found nullptr is returned
+   *
+   * @param pk The string primary key value
+   * @return The corresponding object_proxy or nullptr
+   */
+  object_proxy* find_proxy(const std::string &pk) const;
+
+  /**
+   * Find the underlying proxy of the given raw primary
+   * key extracted once by the caller.
+   * If no proxy is found nullptr is returned
+   *
+   * @param key The raw primary key value
+   * @return The corresponding object_proxy or nullptr
+   */
+  object_proxy* find_proxy(const detail::identifier_key &key) const;
+
+  /**
+   * Adds a secondary index to this node. The node
+   * takes the ownership of the index. All objects
+   * of this node and its child nodes are indexed.
+   * If there is already an index for the field
+   * an exception is thrown.
+   *
+   * @param index The index to add
+   */
+  void add_index(detail::basic_object_index *index);
+
+  /**
+   * Returns the secondary index for the given
+   * field or nullptr if there is no index.
+   *
+   * @param field The name of the indexed field
+   * @return The index or nullptr
+   */
+  detail::basic_object_index* find_index(const std::string &field) const;
+
+  /**
+   * Marks the given proxy as modified in all
+   * secondary indexes of this node and its
+   * parent nodes.
+   *
+   * @param proxy The modified proxy
+   */
+  void mark_modified(object_proxy *proxy);
+
+  /**
+   * Sets the loader used to load the object of an
+   * unloaded proxy on demand. An empty loader disables
+   * loading on demand.
+   *
+   * @param loader The object loader
+   */
+  void object_loader(const t_object_loader &loader);
+
+  /**
+   * Loads the object of the given unloaded proxy
+   * with the object loader of this node. A miss
+   * is remembered and the object isn't selected
+   * again until the object store forgets its
+   * misses on the next insert or rollback.
+   *
+   * @param proxy The proxy to load the object for
+   * @return True if the object was loaded
+   */
+  bool load(object_proxy *proxy);
+
   /**
    * Register relation_field_endpoint identified by the given type index.
    *
@@ -467,6 +626,9 @@ private:
     info_->notify(detail::notification_type::DETACH);
   }
 
+  void insert_into_indexes(object_proxy *proxy);
+  void remove_from_indexes(object_proxy *proxy);
+
 private:
   friend class prototype_tree;
   friend class object_holder;
@@ -504,7 +666,8 @@ private:
   object_proxy *op_last = nullptr;   /**< The marker of the last list node of all elements. */
   
   unsigned int depth = 0;  /**< The depth of the node inside of the tree. */
-  unsigned long count = 0; /**< The total count of elements. */
+  unsigned long count = 0; /**< The count of own elements. */
+  unsigned long subtree_count = 0; /**< The count of elements of this node and all child nodes. */
 
   std::string type_;	       /**< The type name of the prototype node */
 
@@ -524,12 +687,43 @@ private:
 
   bool is_relation_node_ = false;
   relation_node_info relation_node_info_;
+
+  t_object_loader object_loader_; /**< Loads objects of unloaded proxies on demand */
+
+  typedef std::map<std::string, std::unique_ptr<detail::basic_object_index>> t_index_map;
+  t_index_map indexes_; /**< The secondary indexes by field name */
+
+  std::unique_ptr<detail::object_pool> object_allocator_; /**< The optional slab allocator of the objects */
+  std::unique_ptr<detail::object_pool> proxy_allocator_;  /**< The optional slab allocator of the object proxies */
+
+  mutable std::mutex created_mutex_;
+  mutable std::unordered_set<const void*> created_; /**< Objects created by create() and not inserted yet */
 };
 
 template<class T>
 T *prototype_node::create() const
 {
-  return static_cast<T*>(info_.get()->create());
+  T *obj = construct<T>();
+  if (obj != nullptr && object_allocator_) {
+    std::lock_guard<std::mutex> lock(created_mutex_);
+    created_.insert(obj);
+  }
+  return obj;
+}
+
+template<class T>
+T *prototype_node::construct() const
+{
+  if (!object_allocator_) {
+    return static_cast<T*>(info_.get()->create());
+  }
+  void *p = object_allocator_->allocate();
+  try {
+    return static_cast<T*>(info_.get()->create(p));
+  } catch (...) {
+    object_allocator_->deallocate(p);
+    throw;
+  }
 }
 
 template<class T>
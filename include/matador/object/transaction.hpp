@@ -174,7 +174,10 @@ public:
   /**
    * @brief Rollback transaction
    *
-   * Rollback transaction and revert all changes
+   * Rollback transaction and revert all changes.
+   * The undo log is replayed in recording order, each
+   * record is restored once from its backup bytes,
+   * so a rollback is linear in the number of records.
    */
   void rollback();
 
@@ -189,9 +192,11 @@ public:
    * Called when update took place.
    * 
    * @tparam T The type of the updated object
+   * @param proxy The proxy of the updated object
+   * @param before_change True if the object isn't changed yet
    */
   template < class T >
-  void on_update(object_proxy *proxy);
+  void on_update(object_proxy *proxy, bool before_change = false);
   /**
    * Called when deletion took place.
    * 
@@ -205,7 +210,7 @@ private:
   typedef std::unordered_map<unsigned long, t_action_vector::size_type> t_id_action_index_map;
 
   void backup(const action_ptr &a, const object_proxy *proxy);
-  void restore(const action_ptr &a);
+  void log(const action_ptr &a, byte_buffer::size_type begin);
 
   void cleanup();
 
@@ -221,14 +226,27 @@ private:
     virtual void visit(delete_action *act);
   };
 
-  struct transaction_data
+  /**
+   * An entry of the undo log. It holds the action
+   * to restore and the range of its backup bytes
+   * within the object buffer.
+   */
+  struct undo_record
   {
-    transaction_data(object_store &store, std::shared_ptr<observer> obsrvr)
-      : store_(store)
-      , inserter_(actions_)
-      , observer_(obsrvr)
-      , id_(transaction::sequencer_.next())
+    undo_record(action_ptr a, byte_buffer::size_type b, byte_buffer::size_type e)
+      : act(std::move(a)), begin(b), end(e)
     {}
+    action_ptr act;
+    byte_buffer::size_type begin;
+    byte_buffer::size_type end;
+  };
+
+  typedef std::vector<undo_record> t_undo_log;
+
+  struct transaction_data
+  {
+    transaction_data(object_store &store, std::shared_ptr<observer> obsrvr);
+    ~transaction_data();
 
     std::reference_wrapper<object_store> store_;
 
@@ -236,7 +254,12 @@ private:
     t_id_action_index_map id_action_index_map_;
 
     action_inserter inserter_;
+    // the undo records are appended in the order
+    // of the changes, their backups are appended
+    // to the object buffer
+    t_undo_log undo_log_;
     byte_buffer object_buffer_;
+    std::unique_ptr<object_serializer> serializer_;
 
     std::shared_ptr<observer> observer_;
 
@@ -263,12 +286,18 @@ void transaction::on_insert(object_proxy *proxy)
   t_id_action_index_map::iterator i = transaction_data_->id_action_index_map_.find(proxy->id());
   if (i == transaction_data_->id_action_index_map_.end()) {
     // create insert action and insert serializable
+    t_action_vector::size_type size = transaction_data_->actions_.size();
     t_action_vector::size_type index = transaction_data_->inserter_.insert<T>(proxy);
     if (index == transaction_data_->actions_.size()) {
       throw_object_exception("transaction: action for object with id " << proxy->id() << " couldn't be inserted");
     } else {
       transaction_data_->id_action_index_map_.insert(std::make_pair(proxy->id(), index));
     }
+    if (index == size) {
+      // a new insert action removes all objects
+      // inserted with it on rollback
+      log(transaction_data_->actions_.back(), transaction_data_->object_buffer_.size());
+    }
   } else {
     // ERROR: an serializable with that id already exists
     throw_object_exception("transaction: an object with id " << proxy->id() << " already exists");
@@ -276,8 +305,12 @@ void transaction::on_insert(object_proxy *proxy)
 }
 
 template < class T >
-void transaction::on_update(object_proxy *proxy)
+void transaction::on_update(object_proxy *proxy, bool before_change)
 {
+  // the indexed values of the object may change
+  if (proxy->node() != nullptr) {
+    proxy->node()->mark_modified(proxy);
+  }
   /*****************
    *
    * backup updated serializable
@@ -286,8 +319,7 @@ void transaction::on_update(object_proxy *proxy)
    *
    *****************/
   if (transaction_data_->id_action_index_map_.find(proxy->id()) == transaction_data_->id_action_index_map_.end()) {
-    std::shared_ptr<update_action> ua(new update_action(proxy, (T*)proxy->obj()));
-    backup(ua, proxy);
+    backup(std::make_shared<update_action>(proxy, (T*)proxy->obj(), before_change), proxy);
   } else {
     // An object with that id already exists
     // do nothing because the serializable is already
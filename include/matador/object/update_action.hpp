@@ -7,6 +7,7 @@
 
 #include "matador/object/action.hpp"
 #include "matador/object/delete_action.hpp"
+#include "matador/object/field_snapshot.hpp"
 
 namespace matador {
 
@@ -33,12 +34,15 @@ public:
   /**
    * Creates an update_action.
    *
-   * @param o The updated serializable.
+   * @param proxy The proxy of the updated serializable.
+   * @param obj The updated serializable.
+   * @param backup_before_change True if the serializable is backed up before it is changed.
    */
   template < class T >
-  update_action(object_proxy *proxy, T *obj)
+  update_action(object_proxy *proxy, T *obj, bool backup_before_change = false)
     : proxy_(proxy)
-    , delete_action_(new delete_action(proxy, obj))
+    , delete_action_(std::make_shared<delete_action>(proxy, obj))
+    , backup_before_change_(backup_before_change)
     , backup_func_(&backup_update<T, object_serializer>)
     , restore_func_(&restore_update<T, object_serializer>)
   {}
@@ -55,18 +59,41 @@ public:
    */
   const object_proxy* proxy() const;
 
-  virtual void backup(byte_buffer &buffer);
+  virtual void backup(byte_buffer &buffer, object_serializer &serializer);
 
-  virtual void restore(byte_buffer &buffer, object_store *store);
+  /**
+   * Restores the object from its backup. If the
+   * object was deleted after the update the delete
+   * action restores the deleted object.
+   */
+  virtual void restore(byte_buffer &buffer, object_store *store, object_serializer &serializer);
+
+  /**
+   * Returns the delete action replacing this
+   * action once the object was deleted.
+   */
+  std::shared_ptr<delete_action> release_delete_action();
 
-  delete_action* release_delete_action();
+  /**
+   * Returns the field values of the
+   * object before it was updated.
+   */
+  const detail::field_snapshot& snapshot() const;
+
+  /**
+   * Returns true if the backup and the snapshot were
+   * taken before the object was changed. Only then
+   * the snapshot tells all changed fields.
+   */
+  bool is_backup_before_change() const;
 
 private:
   template < class T, class S >
   static void backup_update(byte_buffer &buffer, update_action *act, S &serializer)
   {
     T* obj = (T*)(act->proxy()->obj());
-    serializer.serialize(obj, &buffer);
+    // the field ranges of the backup tell the changed fields
+    act->snapshot_.take(*obj, buffer, serializer);
   }
 
   template < class T, class S >
@@ -78,7 +105,10 @@ private:
 
 private:
   object_proxy *proxy_;
-  std::unique_ptr<delete_action> delete_action_;
+  std::shared_ptr<delete_action> delete_action_;
+  bool deleted_ = false;
+  detail::field_snapshot snapshot_;
+  bool backup_before_change_ = false;
 
   t_backup_func backup_func_;
   t_restore_func restore_func_;
@@ -19,8 +19,10 @@
 #endif
 
 #include "matador/object/identifier_proxy_map.hpp"
+#include "matador/object/insert_action.hpp"
 
 #include "matador/orm/basic_relation_data.hpp"
+#include "matador/orm/fetch_type.hpp"
 
 #include <string>
 #include <functional>
@@ -34,6 +36,10 @@ class object_proxy;
 class object_store;
 class persistence;
 
+namespace detail {
+class field_snapshot;
+}
+
 template < class T >
 bool is_loaded(const T &)
 {
@@ -58,6 +64,7 @@ public:
   typedef std::unordered_map<std::string, table_ptr> t_table_map;                             /**< Shortcut to an unordered map of table shared pointer*/
   typedef std::unordered_map<std::string, detail::t_identifier_multimap> t_relation_item_map; /**< Shortcut to an unordered identifier multimap */
   typedef std::unordered_map<std::string, std::shared_ptr<detail::basic_relation_data>> t_relation_data_map; /**< Shortcut to unordered relation data map */
+  typedef insert_action::const_iterator t_proxy_iterator;                                      /**< Shortcut to an object proxy iterator */
 
 public:
   /**
@@ -106,9 +113,108 @@ public:
    * Interface for loading a table into the
    * given object_store.
    *
+   * @param conn The database connection
    * @param p The object_store to load the table into
    */
-  virtual void load(object_store &p) = 0;
+  virtual void load(connection &conn, object_store &p) = 0;
+
+  /**
+   * @brief Interface for reading a table
+   *
+   * Interface for reading all rows of a table
+   * with the given connection without touching
+   * the object_store. The read objects are inserted
+   * into the store with merge(), which must be
+   * called from the thread owning the store.
+   *
+   * The default implementation reads nothing.
+   *
+   * @param conn The database connection
+   */
+  virtual void fetch(connection &conn);
+
+  /**
+   * @brief Interface for inserting the read rows of a table
+   *
+   * Interface for inserting the objects read with fetch()
+   * into the given object_store.
+   *
+   * The default implementation loads the
+   * whole table with the given connection.
+   *
+   * @param conn The database connection
+   * @param p The object_store to insert the objects into
+   */
+  virtual void merge(connection &conn, object_store &p);
+
+  /**
+   * @brief Interface for loading a single object
+   *
+   * Interface for loading the object of the given
+   * unloaded proxy by its primary key into the given
+   * object_store. The default implementation doesn't
+   * load anything.
+   *
+   * @param conn The database connection
+   * @param p The object_store to load the object into
+   * @param proxy The unloaded proxy
+   * @return True if the object was loaded
+   */
+  virtual bool load(connection &conn, object_store &p, object_proxy *proxy);
+
+  /**
+   * @brief Interface for loading a single object with its relations
+   *
+   * Interface for loading the object of the given
+   * unloaded proxy like above. With an eager fetch
+   * type the related objects are loaded with the
+   * object as well. The default implementation
+   * loads the object lazy.
+   *
+   * @param conn The database connection
+   * @param p The object_store to load the object into
+   * @param proxy The unloaded proxy
+   * @param fetch The fetch type of the relations
+   * @return True if the object was loaded
+   */
+  virtual bool load(connection &conn, object_store &p, object_proxy *proxy, fetch_type fetch);
+
+  /**
+   * @brief Interface for loading a chunk of a table
+   *
+   * Interface for loading the next chunk of at most
+   * limit rows behind the given last primary key into
+   * the given object_store. If last is empty the chunk
+   * starts at the beginning of the table. Once the call
+   * returns last holds the primary key of the last row.
+   * A chunk with less than limit rows is the last one.
+   *
+   * The default implementation loads the whole table
+   * and returns zero.
+   *
+   * @param conn The database connection
+   * @param p The object_store to load the chunk into
+   * @param last The primary key of the last loaded row
+   * @param limit The maximum count of rows to load
+   * @return The count of rows read
+   */
+  virtual std::size_t load(connection &conn, object_store &p, std::shared_ptr<basic_identifier> &last, std::size_t limit);
+
+  /**
+   * @brief Interface for loading the items of one owner
+   *
+   * Interface for loading the rows of a relation table
+   * belonging to the owner with the given primary key
+   * into the given object_store. Only the rows of this
+   * owner are selected.
+   *
+   * The default implementation loads the whole table.
+   *
+   * @param conn The database connection
+   * @param p The object_store to load the items into
+   * @param owner The primary key of the owner
+   */
+  virtual void load_items(connection &conn, object_store &p, const std::shared_ptr<basic_identifier> &owner);
 
   /**
    * @brief Interface for inserting an object
@@ -116,9 +222,24 @@ public:
    * Interface for inserting an object represented
    * by the given object_proxy
    *
+   * @param conn The database connection
    * @param proxy The proxy representing the object to be inserted
    */
-  virtual void insert(object_proxy *proxy) = 0;
+  virtual void insert(connection &conn, object_proxy *proxy) = 0;
+
+  /**
+   * @brief Interface for inserting a range of objects
+   *
+   * Interface for inserting a range of objects
+   * represented by the given object_proxy iterators.
+   * The default implementation inserts each object
+   * on its own.
+   *
+   * @param conn The database connection
+   * @param first The first proxy of the range to be inserted
+   * @param last The last proxy of the range to be inserted
+   */
+  virtual void insert(connection &conn, t_proxy_iterator first, t_proxy_iterator last);
 
   /**
    * @brief Interface for updating an object
@@ -126,9 +247,24 @@ public:
    * Interface for updating an object represented
    * by the given object_proxy
    *
+   * @param conn The database connection
+   * @param proxy The proxy representing the object to be updated
+   */
+  virtual void update(connection &conn, object_proxy *proxy) = 0;
+
+  /**
+   * @brief Interface for updating the changed fields of an object
+   *
+   * Interface for updating the fields of an object
+   * which were changed since the given snapshot was
+   * taken. The default implementation updates all
+   * fields.
+   *
+   * @param conn The database connection
    * @param proxy The proxy representing the object to be updated
+   * @param snapshot The field values before the update
    */
-  virtual void update(object_proxy *proxy) = 0;
+  virtual void update(connection &conn, object_proxy *proxy, const detail::field_snapshot &snapshot);
 
   /**
    * @brief Interface for deleting an object
@@ -136,9 +272,10 @@ public:
    * Interface for deleting an object represented
    * by the given object_proxy
    *
+   * @param conn The database connection
    * @param proxy The proxy representing the object to be deleted
    */
-  virtual void remove(object_proxy *proxy) = 0;
+  virtual void remove(connection &conn, object_proxy *proxy) = 0;
 
   /**
    * @brief Returns true if the table is laready loaded
@@ -147,6 +284,23 @@ public:
    */
   bool is_loaded() const;
 
+  /**
+   * @brief Sets the insert batch size
+   *
+   * Sets the maximum number of objects
+   * inserted with one statement.
+   *
+   * @param size The insert batch size
+   */
+  void batch_size(std::size_t size);
+
+  /**
+   * @brief Returns the insert batch size
+   *
+   * @return The insert batch size
+   */
+  std::size_t batch_size() const;
+
   /**
    * @brief Returns the underlaying prototype node
    *
@@ -164,7 +318,7 @@ public:
   /**
    * @brief Marks the table as not loaded
    */
-  void reset();
+  virtual void reset();
 
   /// @cond MATADOR_DEV
 
@@ -181,9 +335,12 @@ public:
   t_table_map::iterator end_table();
 
   virtual void prepare(connection &conn) = 0;
+  virtual void release(connection &conn) = 0;
 
   detail::t_identifier_map::iterator insert_proxy(const std::shared_ptr<basic_identifier> &pk, object_proxy *proxy);
+  detail::t_identifier_map::iterator insert_proxy(const detail::identifier_key &key, const std::shared_ptr<basic_identifier> &pk, object_proxy *proxy);
   detail::t_identifier_map::iterator find_proxy(const std::shared_ptr<basic_identifier> &pk);
+  detail::t_identifier_map::iterator find_proxy(const detail::identifier_key &key);
   detail::t_identifier_map::iterator begin_proxy();
   detail::t_identifier_map::iterator end_proxy();
 
@@ -202,6 +359,8 @@ protected:
 
   bool is_loaded_ = false;
 
+  std::size_t batch_size_ = 100;
+
   prototype_node &node_;
 
   /// @endcond
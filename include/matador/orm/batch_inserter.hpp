@@ -0,0 +1,114 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_BATCH_INSERTER_HPP
+#define OOS_BATCH_INSERTER_HPP
+
+#include "matador/object/object_proxy.hpp"
+
+#include "matador/sql/connection.hpp"
+#include "matador/sql/basic_dialect.hpp"
+#include "matador/sql/query.hpp"
+#include "matador/sql/value_serializer.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace matador {
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Inserts a range of object proxies with multi row
+ * insert statements. The number of rows per statement
+ * is limited by the batch size and the host value
+ * limits of the connections sql dialect.
+ *
+ * The statements are prepared once per row count
+ * and reused, so the statement for a full batch and
+ * the ones for the remaining rows aren't prepared
+ * again on the next insert.
+ */
+template < class T >
+class batch_inserter
+{
+public:
+  void prepare(connection &conn, const std::string &name, T &proto)
+  {
+    conn_ = &conn;
+    name_ = name;
+    proto_ = &proto;
+
+    value_serializer vserializer;
+    std::unique_ptr<values> vals(vserializer.execute(proto));
+    column_count_ = vals->values_.size();
+
+    inserts_.clear();
+  }
+
+  template < class Iterator >
+  void insert(Iterator first, Iterator last, std::size_t batch_size)
+  {
+    std::size_t rows = rows_per_statement(batch_size);
+    std::size_t count = (std::size_t)std::distance(first, last);
+
+    while (count > 0) {
+      std::size_t n = std::min(rows, count);
+
+      statement<T> *stmt = &statement_for(n);
+
+      // the first bind resets the statement
+      std::size_t pos = stmt->bind(0, static_cast<T*>((*first++)->obj()));
+      for (std::size_t i = 1; i < n; ++i) {
+        pos = stmt->append(pos, static_cast<T*>((*first++)->obj()));
+      }
+      // Todo: check result
+      stmt->execute();
+
+      count -= n;
+    }
+  }
+
+  std::size_t rows_per_statement(std::size_t batch_size) const
+  {
+    std::size_t rows = (batch_size > 0 ? batch_size : 1);
+    basic_dialect *d = conn_->dialect();
+    if (column_count_ > 0) {
+      rows = std::min(rows, std::max<std::size_t>(d->max_bind_count() / column_count_, 1));
+    }
+    return std::min(rows, std::max<std::size_t>(d->max_insert_rows(), 1));
+  }
+
+private:
+  statement<T>& statement_for(std::size_t rows)
+  {
+    auto i = inserts_.find(rows);
+    if (i == inserts_.end()) {
+      matador::query<T> q(name_);
+      i = inserts_.insert(std::make_pair(rows, q.insert(*proto_, rows).prepare(*conn_))).first;
+    }
+    return i->second;
+  }
+
+private:
+  connection *conn_ = nullptr;
+  std::string name_;
+  T *proto_ = nullptr;
+
+  std::size_t column_count_ = 0;
+
+  // prepared insert statements by row count
+  std::unordered_map<std::size_t, statement<T>> inserts_;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_BATCH_INSERTER_HPP
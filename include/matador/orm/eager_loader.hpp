@@ -0,0 +1,254 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_EAGER_LOADER_HPP
+#define OOS_EAGER_LOADER_HPP
+
+#include "matador/utils/access.hpp"
+#include "matador/utils/serializer.hpp"
+#include "matador/utils/identifier_resolver.hpp"
+
+#include "matador/object/basic_has_many.hpp"
+#include "matador/object/has_one.hpp"
+#include "matador/object/belongs_to.hpp"
+#include "matador/object/object_exception.hpp"
+
+#include "matador/sql/column.hpp"
+#include "matador/sql/column_serializer.hpp"
+#include "matador/sql/query.hpp"
+
+#include "matador/orm/basic_table.hpp"
+#include "matador/orm/identifier_column_resolver.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace matador {
+
+template < class T, class Enabled >
+class table;
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Base class of a to-one relation which is
+ * joined into the select of its owner. It reads
+ * the columns of the related object from the
+ * row of the owner.
+ */
+class basic_eager_relation
+{
+public:
+  basic_eager_relation(const char *field, const basic_table::table_ptr &tbl, const column &pk)
+    : field_(field), table_(tbl), pk_(pk)
+  {}
+
+  virtual ~basic_eager_relation() = default;
+
+  const std::string& field() const { return field_; }
+  const basic_table::table_ptr& related_table() const { return table_; }
+  const column& pk() const { return pk_; }
+
+  /**
+   * Appends the columns of the related
+   * object qualified with its table name
+   */
+  virtual void append_columns(columns &cols) = 0;
+
+  /**
+   * Creates the related object to read
+   * if there is none left from the last row
+   */
+  virtual void create() = 0;
+
+  virtual void serialize(serializer &s) = 0;
+
+  /**
+   * Inserts the read object into the store. If the
+   * relation was null the object is kept for the
+   * next row, if the object was already loaded the
+   * read object is dropped.
+   */
+  virtual void insert(object_store &store) = 0;
+
+private:
+  std::string field_;
+  basic_table::table_ptr table_;
+  column pk_;
+};
+
+template < class V >
+class eager_relation : public basic_eager_relation
+{
+public:
+  eager_relation(const char *field, const basic_table::table_ptr &tbl)
+    : basic_eager_relation(field, tbl, identifier_column_resolver::resolve<V>())
+  {}
+
+  ~eager_relation() override
+  {
+    if (obj_ != nullptr) {
+      detail::delete_object(obj_, related_table()->node().object_allocator());
+    }
+  }
+
+  void append_columns(columns &cols) override
+  {
+    V prototype;
+    column_serializer serializer(columns::WITHOUT_BRACKETS);
+    std::unique_ptr<columns> related(serializer.execute(prototype));
+    for (const auto &col : related->columns_) {
+      cols.push_back(std::make_shared<column>(related_table()->name() + "." + col->name));
+    }
+  }
+
+  void create() override
+  {
+    if (obj_ == nullptr) {
+      obj_ = related_table()->node().template construct<V>();
+    }
+  }
+
+  void serialize(serializer &s) override
+  {
+    matador::access::serialize(s, *obj_);
+  }
+
+  void insert(object_store &store) override;
+
+private:
+  V *obj_ = nullptr;
+  identifier_resolver<V> identifier_resolver_;
+};
+
+/**
+ * The object and its joined related objects
+ * read from one row of an eager select.
+ */
+template < class T >
+struct eager_row
+{
+  T *owner = nullptr;
+  std::vector<std::unique_ptr<basic_eager_relation>> *relations = nullptr;
+
+  void serialize(serializer &s)
+  {
+    matador::access::serialize(s, *owner);
+    for (auto &relation : *relations) {
+      relation->serialize(s);
+    }
+  }
+};
+
+/**
+ * Loads an object together with the objects of
+ * its belongs to and has one relations with one
+ * select. The tables of the related objects are
+ * left joined on their primary key, so each object
+ * comes with at most one row.
+ *
+ * The items of the has many relations are selected
+ * from their relation tables by the primary key of
+ * the object, one select per relation. Joining them
+ * would repeat the object for each item.
+ *
+ * Relations to the table of the object itself or
+ * to a table already joined would need table aliases
+ * and are loaded on demand.
+ */
+template < class T >
+class eager_loader
+{
+public:
+  typedef T table_type;
+
+  explicit eager_loader(basic_table &tbl)
+    : table_(tbl)
+  {}
+
+  /**
+   * Returns true if the object has to-one
+   * relations which could be joined or
+   * has many relations
+   */
+  bool has_relations();
+
+  statement<eager_row<table_type>> prepare(connection &conn);
+
+  /**
+   * Selects the object with the given primary key.
+   * The joined related objects are inserted into the
+   * store. Returns the object or nullptr if there is
+   * no such object.
+   */
+  table_type* load(statement<eager_row<table_type>> &stmt, object_store &store, basic_identifier &pk);
+
+  /**
+   * Loads the items of all has many relations
+   * of the object with the given primary key.
+   * Must be called once the object is in the
+   * store and before its relations are resolved.
+   */
+  void load_items(connection &conn, object_store &store, const std::shared_ptr<basic_identifier> &pk);
+
+  template < class V >
+  void serialize(V &obj)
+  {
+    matador::access::serialize(*this, obj);
+  }
+
+  template < class V >
+  void serialize(const char *, V &) { }
+
+  void serialize(const char *, char *, size_t) { }
+
+  template < class V >
+  void serialize(const char *id, belongs_to<V> &, cascade_type)
+  {
+    append_relation<V>(id);
+  }
+
+  template < class V >
+  void serialize(const char *id, has_one<V> &, cascade_type)
+  {
+    append_relation<V>(id);
+  }
+
+  template<class V, template<class ...> class C>
+  void serialize(const char *id, basic_has_many<V, C> &, const char *, const char *, cascade_type)
+  {
+    append_items(id);
+  }
+
+  template<class V, template<class ...> class C>
+  void serialize(const char *id, basic_has_many<V, C> &, cascade_type)
+  {
+    append_items(id);
+  }
+
+private:
+  template < class V >
+  void append_relation(const char *id);
+
+  void append_items(const char *id);
+
+private:
+  basic_table &table_;
+
+  std::vector<std::unique_ptr<basic_eager_relation>> relations_;
+  // relation tables hold their owner table
+  std::vector<std::weak_ptr<basic_table>> item_tables_;
+
+  bool collected_ = false;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_EAGER_LOADER_HPP
@@ -0,0 +1,132 @@
+#include "matador/orm/eager_loader.hpp"
+
+namespace matador {
+
+namespace detail {
+
+template < class V >
+void eager_relation<V>::insert(object_store &store)
+{
+  std::shared_ptr<basic_identifier> id(identifier_resolver_.resolve_object(obj_));
+  if (!id || !id->is_valid()) {
+    // relation is null, reuse object for the next row
+    return;
+  }
+  auto tbl = std::static_pointer_cast<matador::table<V>>(related_table());
+  tbl->insert_fetched(obj_, id, store);
+  obj_ = nullptr;
+}
+
+template < class T >
+bool eager_loader<T>::has_relations()
+{
+  if (!collected_) {
+    table_type prototype;
+    matador::access::serialize(*this, prototype);
+    collected_ = true;
+  }
+  return !relations_.empty() || !item_tables_.empty();
+}
+
+template < class T >
+statement<eager_row<T>> eager_loader<T>::prepare(connection &conn)
+{
+  has_relations();
+
+  table_type prototype;
+  column_serializer serializer(columns::WITHOUT_BRACKETS);
+  std::unique_ptr<columns> owner(serializer.execute(prototype));
+
+  columns cols(columns::WITHOUT_BRACKETS);
+  for (const auto &col : owner->columns_) {
+    cols.push_back(std::make_shared<column>(table_.name() + "." + col->name));
+  }
+  for (auto &relation : relations_) {
+    relation->append_columns(cols);
+  }
+
+  matador::query<eager_row<table_type>> q(table_.name());
+  q.select(cols);
+  for (auto &relation : relations_) {
+    const std::string &related = relation->related_table()->name();
+    q.left_join(related).on(column(related + "." + relation->pk().name) == column(table_.name() + "." + relation->field()));
+  }
+  column id = identifier_column_resolver::resolve<table_type>();
+  return q.where(column(table_.name() + "." + id.name) == 1).prepare(conn);
+}
+
+template < class T >
+T* eager_loader<T>::load(statement<eager_row<T>> &stmt, object_store &store, basic_identifier &pk)
+{
+  detail::pooled_object_deleter<table_type> deleter(table_.node().object_allocator());
+  std::unique_ptr<table_type, detail::pooled_object_deleter<table_type>> owner(table_.node().template construct<table_type>(), deleter);
+  for (auto &relation : relations_) {
+    relation->create();
+  }
+  eager_row<table_type> row;
+  row.owner = owner.get();
+  row.relations = &relations_;
+
+  stmt.reset();
+  stmt.bind(0, pk);
+  bool found = false;
+  {
+    auto res = stmt.execute();
+    found = res.fetch(row);
+  }
+  // finish the select
+  stmt.reset();
+
+  if (!found) {
+    return nullptr;
+  }
+  // related objects must be in the store
+  // before the relations of the owner are resolved
+  for (auto &relation : relations_) {
+    relation->insert(store);
+  }
+  return owner.release();
+}
+
+template < class T >
+void eager_loader<T>::load_items(connection &conn, object_store &store, const std::shared_ptr<basic_identifier> &pk)
+{
+  for (auto &item_table : item_tables_) {
+    auto tbl = item_table.lock();
+    if (tbl) {
+      tbl->load_items(conn, store, pk);
+    }
+  }
+}
+
+template < class T >
+template < class V >
+void eager_loader<T>::append_relation(const char *id)
+{
+  auto i = table_.template find_table<V>();
+  if (i == table_.end_table()) {
+    throw_object_exception("unknown table for relation " << id);
+  }
+  if (i->second.get() == &table_) {
+    return;
+  }
+  for (const auto &relation : relations_) {
+    if (relation->related_table() == i->second) {
+      return;
+    }
+  }
+  relations_.emplace_back(new eager_relation<V>(id, i->second));
+}
+
+template < class T >
+void eager_loader<T>::append_items(const char *id)
+{
+  auto i = table_.find_table(id);
+  if (i == table_.end_table()) {
+    throw_object_exception("unknown relation table " << id);
+  }
+  item_tables_.push_back(i->second);
+}
+
+}
+}
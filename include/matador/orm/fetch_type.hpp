@@ -0,0 +1,20 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_FETCH_TYPE_HPP
+#define OOS_FETCH_TYPE_HPP
+
+namespace matador {
+
+/**
+ * Represents the way the relations of an
+ * object are loaded from the database.
+ */
+enum class fetch_type {
+  LAZY, /**< Relations are loaded on demand once they are dereferenced (see persistence::lazy_loading()) */
+  EAGER /**< To-one relations are joined into the select of the object, has many items are selected by owner */
+};
+
+}
+#endif //OOS_FETCH_TYPE_HPP
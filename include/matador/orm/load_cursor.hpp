@@ -0,0 +1,111 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_LOAD_CURSOR_HPP
+#define OOS_LOAD_CURSOR_HPP
+
+#ifdef _MSC_VER
+#ifdef matador_orm_EXPORTS
+#define OOS_ORM_API __declspec(dllexport)
+#define EXPIMP_ORM_TEMPLATE
+#else
+#define OOS_ORM_API __declspec(dllimport)
+#define EXPIMP_ORM_TEMPLATE extern
+#endif
+#pragma warning(disable: 4251)
+#else
+#define OOS_ORM_API
+#endif
+
+#include "matador/utils/basic_identifier.hpp"
+
+#include <memory>
+#include <string>
+
+namespace matador {
+
+class session;
+
+/**
+ * @brief Holds the state of a chunked table load
+ *
+ * A load cursor is used to load a table in chunks
+ * ordered by primary key (see session::load()). It
+ * remembers the primary key of the last loaded row,
+ * so that a stopped load can be resumed at any time
+ * with the next chunk.
+ *
+ * @code
+ * auto cursor = s.cursor<person>();
+ * while (s.load(cursor, 1000)) {
+ *   std::cout << cursor.rows() << " persons loaded\n";
+ * }
+ * @endcode
+ */
+class OOS_ORM_API load_cursor
+{
+public:
+  /**
+   * @brief Creates a cursor for the given table
+   *
+   * @param table The name of the table to load
+   */
+  explicit load_cursor(std::string table);
+
+  /**
+   * @brief Returns the name of the table
+   *
+   * @return The name of the table
+   */
+  std::string table() const;
+
+  /**
+   * @brief Returns the count of rows read so far
+   *
+   * @return The count of rows read
+   */
+  std::size_t rows() const;
+
+  /**
+   * @brief Returns the count of chunks read so far
+   *
+   * @return The count of chunks read
+   */
+  std::size_t chunks() const;
+
+  /**
+   * @brief Returns true if the whole table was read
+   *
+   * @return True if the whole table was read
+   */
+  bool finished() const;
+
+  /**
+   * @brief Returns the primary key of the last read row
+   *
+   * If no row was read yet an empty pointer
+   * is returned.
+   *
+   * @return The primary key of the last read row
+   */
+  std::shared_ptr<basic_identifier> last() const;
+
+  /**
+   * @brief Resets the cursor to the beginning of the table
+   */
+  void reset();
+
+private:
+  friend class session;
+
+  std::string table_;
+  std::shared_ptr<basic_identifier> last_;
+  std::size_t rows_ = 0;
+  std::size_t chunks_ = 0;
+  bool finished_ = false;
+};
+
+}
+
+#endif //OOS_LOAD_CURSOR_HPP
@@ -19,6 +19,7 @@
 #endif
 
 #include "matador/sql/connection.hpp"
+#include "matador/sql/connection_pool.hpp"
 
 #include "matador/object/object_store.hpp"
 
@@ -27,7 +28,10 @@
 #include "matador/orm/persistence_observer.hpp"
 
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace matador {
 
@@ -53,11 +57,25 @@ public:
    * @brief Creates a new persistence object
    *
    * Creates a new persistence object for the given
-   * database connection string.
+   * database connection string. Additional connections
+   * for sessions are leased from a connection pool
+   * holding between min_pool_size and max_pool_size
+   * connections.
+   *
+   * The object_store of the persistence isn't
+   * synchronized. All sessions share it, so the store
+   * is confined to the thread holding sessions. Creating
+   * a session on another thread meanwhile throws an
+   * object_exception, it doesn't wait. Other threads do
+   * their database work with queries on connections
+   * leased from the pool. Objects of the store must not
+   * be used from other threads.
    *
    * @param dns The database connection string
+   * @param min_pool_size The minimum count of pooled connections
+   * @param max_pool_size The maximum count of pooled connections
    */
-  explicit persistence(const std::string &dns);
+  explicit persistence(const std::string &dns, std::size_t min_pool_size = 0, std::size_t max_pool_size = 4);
 
   ~persistence();
 
@@ -93,6 +111,34 @@ public:
   template<class T, class S>
   void attach(const char *type, object_store::abstract_type abstract = object_store::abstract_type::not_abstract);
 
+  /**
+   * Inserts a new concrete object prototype into the prototype tree.
+   * The objects and object proxies of the prototype are allocated
+   * from slab allocators of its prototype node. Loaded objects
+   * of one type are placed contiguously.
+   *
+   * @tparam T         The type of the prototype node
+   * @param type       The unique name of the type.
+   * @param allocation The slab allocation settings
+   * @param parent     The name of the parent type.
+   */
+  template<class T>
+  void attach(const char *type, const slab_allocation &allocation, const char *parent = nullptr);
+
+  /**
+   * Inserts a new concrete object prototype below the prototype
+   * of type S into the prototype tree. The objects and object
+   * proxies of the prototype are allocated from slab allocators
+   * of its prototype node.
+   *
+   * @tparam T         The type of the prototype node
+   * @tparam S         The type of the parent prototype node
+   * @param type       The unique name of the type.
+   * @param allocation The slab allocation settings
+   */
+  template<class T, class S>
+  void attach(const char *type, const slab_allocation &allocation);
+
   /**
    * Removes an object prototype from the prototype tree. All children
    * nodes and all objects are also removed.
@@ -193,14 +239,68 @@ public:
    */
   const connection &conn() const;
 
+  /**
+   * @brief Return a reference to the connection pool
+   *
+   * Connections leased from the pool get their
+   * own prepared statements for each table.
+   *
+   * @return A reference to the connection pool.
+   */
+  connection_pool &pool();
+
+  /**
+   * @brief Return the connection to load objects on demand
+   *
+   * Unloaded objects are loaded with the connection
+   * of the latest session created by the calling
+   * thread. Without such a session the connection
+   * of the persistence is used.
+   *
+   * @return The connection to load objects with.
+   */
+  connection &load_conn();
+
+  /**
+   * @brief Enables or disables lazy loading
+   *
+   * With lazy loading enabled an unloaded object
+   * is selected by its primary key once a reference
+   * to it is dereferenced. Even a const access may
+   * then do database I/O. Otherwise unloaded objects
+   * are only loaded with session::get() or
+   * session::load(). Lazy loading is disabled by
+   * default.
+   *
+   * @param enable True to enable lazy loading
+   */
+  void lazy_loading(bool enable);
+
+  /**
+   * @brief Returns true if lazy loading is enabled
+   *
+   * @return True if lazy loading is enabled
+   */
+  bool lazy_loading() const;
+
 private:
   template < class T >
   friend class persistence_observer;
+  friend class session;
+
+  void push_session_conn(connection &conn);
+  void pop_session_conn(connection &conn);
 
 private:
   connection connection_;
+  connection_pool pool_;
   object_store store_;
 
+  bool lazy_loading_ = false;
+
+  std::mutex session_conns_mutex_;
+  std::unordered_map<std::thread::id, std::vector<connection*>> session_conns_;
+
   t_table_map tables_;
 };
 
@@ -222,6 +322,19 @@ void persistence::attach(const char *type, object_store::abstract_type abstract)
   store_.attach<T,S>(type, abstract, { new persistence_observer<T>(*this) });
 }
 
+template<class T>
+void persistence::attach(const char *type, const slab_allocation &allocation, const char *parent)
+{
+  auto node = store_.attach<T>(type, object_store::abstract_type::not_abstract, parent, { new persistence_observer<T>(*this) });
+  node->enable_slab_allocation(sizeof(T), allocation.objects_per_slab);
+}
+
+template<class T, class S>
+void persistence::attach(const char *type, const slab_allocation &allocation)
+{
+  attach<T>(type, allocation, typeid(S).name());
+}
+
 }
 
 #endif //OOS_PERSISTENCE_HPP
@@ -62,10 +62,13 @@ public:
       return;
     }
 
+    // the raw key is extracted once for all lookups
+    detail::identifier_key key = detail::identifier_key::of(*pk);
+
     // get node of object type
     prototype_iterator node = store_->find(x.type());
 
-    object_proxy *proxy = node->find_proxy(pk);
+    object_proxy *proxy = node->find_proxy(key);
     if (proxy) {
       /**
        * find proxy in node map
@@ -85,10 +88,10 @@ public:
       if (j == table_.end_table()) {
         throw_object_exception("unknown table " << node->type());
       }
-      auto k = j->second->find_proxy(pk);
+      auto k = j->second->find_proxy(key);
       if (k == j->second->end_proxy()) {
         proxy = new object_proxy(pk, (T*)nullptr, node.get());
-        k = j->second->insert_proxy(pk, proxy);
+        k = j->second->insert_proxy(key, pk, proxy);
       }
       x.reset(k->second, cascade);
     }
@@ -102,10 +105,13 @@ public:
       return;
     }
 
+    // the raw key is extracted once for all lookups
+    detail::identifier_key key = detail::identifier_key::of(*pk);
+
     // get node of object type
     prototype_iterator node = store_->find(x.type());
 
-    object_proxy *proxy = node->find_proxy(pk);
+    object_proxy *proxy = node->find_proxy(key);
     if (proxy) {
       /**
        * find proxy in node map
@@ -125,10 +131,10 @@ public:
       if (j == table_.end_table()) {
         throw_object_exception("unknown table " << node->type());
       }
-      auto k = j->second->find_proxy(pk);
+      auto k = j->second->find_proxy(key);
       if (k == j->second->end_proxy()) {
         proxy = new object_proxy(pk, (T*)nullptr, node.get());
-        k = j->second->insert_proxy(pk, proxy);
+        k = j->second->insert_proxy(key, pk, proxy);
       }
       x.reset(k->second, cascade);
     }
@@ -276,17 +282,19 @@ public:
 private:
   object_proxy* acquire_proxy(object_holder &x, std::shared_ptr<basic_identifier> pk, cascade_type cascade, std::shared_ptr<basic_table> tbl)
   {
+    detail::identifier_key key = detail::identifier_key::of(*pk);
+
     // get node of object type
     prototype_iterator node = store_->find(x.type());
 
-    object_proxy *proxy = node->find_proxy(pk);
+    object_proxy *proxy = node->find_proxy(key);
     if (proxy) {
       x.reset(proxy, cascade);
     } else {
-      auto idproxy = tbl->find_proxy(pk);
+      auto idproxy = tbl->find_proxy(key);
       if (idproxy == tbl->end_proxy()) {
         proxy = new object_proxy(pk, (T*)nullptr, node.get());
-        idproxy = tbl->insert_proxy(pk, proxy);
+        idproxy = tbl->insert_proxy(key, pk, proxy);
       } else {
         proxy = idproxy->second;
       }
@@ -389,17 +397,19 @@ public:
 private:
   object_proxy* acquire_proxy(object_holder &x, std::shared_ptr<basic_identifier> pk, cascade_type cascade, std::shared_ptr<basic_table> tbl)
   {
+    detail::identifier_key key = detail::identifier_key::of(*pk);
+
     // get node of object type
     prototype_iterator node = store_->find(x.type());
 
-    object_proxy *proxy = node->find_proxy(pk);
+    object_proxy *proxy = node->find_proxy(key);
     if (proxy) {
       x.reset(proxy, cascade);
     } else {
-      auto idproxy = tbl->find_proxy(pk);
+      auto idproxy = tbl->find_proxy(key);
       if (idproxy == tbl->end_proxy()) {
         proxy = new object_proxy(pk, (T*)nullptr, node.get());
-        idproxy = tbl->insert_proxy(pk, proxy);
+        idproxy = tbl->insert_proxy(key, pk, proxy);
       } else {
         proxy = idproxy->second;
       }
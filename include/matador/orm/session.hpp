@@ -23,6 +23,11 @@
 #include "matador/object/transaction.hpp"
 
 #include "matador/orm/persistence.hpp"
+#include "matador/orm/load_cursor.hpp"
+#include "matador/orm/fetch_type.hpp"
+
+#include <functional>
+#include <vector>
 
 namespace matador {
 
@@ -56,6 +61,8 @@ namespace matador {
 class OOS_ORM_API session
 {
 public:
+  typedef std::function<bool(const load_cursor&)> t_load_progress; /**< Shortcut to the chunk load progress callback */
+
   /**
    * @brief Creates a new session object from persistence
    *
@@ -63,6 +70,33 @@ public:
    */
   explicit session(persistence &p);
 
+  /**
+   * @brief Creates a new session object with a leased connection
+   *
+   * Creates a new session object from persistence. All
+   * database work of the session is done on the given
+   * leased connection, which is given back to its pool
+   * once the session is destroyed.
+   *
+   * All sessions share the object_store of the persistence
+   * which isn't synchronized. So only the sessions of one
+   * thread may exist at a time. If sessions of another
+   * thread exist an object_exception is thrown and the
+   * lease is given back.
+   *
+   * @param p The persistence object.
+   * @param lease The leased connection
+   */
+  session(persistence &p, connection_lease &&lease);
+
+  /**
+   * @brief Destroys the session
+   *
+   * Objects of the persistence are no longer loaded
+   * on demand with the connection of the session.
+   */
+  ~session();
+
   /**
    * @brief Inserts an object.
    *
@@ -135,6 +169,104 @@ public:
     }
   }
 
+  /**
+   * @brief Gets an object by its primary key
+   *
+   * Returns the object of the given type identified
+   * by the given primary key. If the object isn't
+   * loaded yet it is loaded on demand with a select
+   * by primary key. This way only the objects in use
+   * are loaded instead of all tables with load().
+   *
+   * With lazy loading enabled (see persistence::lazy_loading())
+   * relations of a loaded object are loaded on demand
+   * once they are dereferenced. With fetch type eager
+   * the belongs to and has one relations are joined
+   * into the select and loaded with the object in
+   * one round trip. The items of each has many relation
+   * are selected from its relation table by the primary
+   * key of the object.
+   *
+   * If there is no such object an empty object_ptr
+   * is returned.
+   *
+   * @tparam T The type of the object
+   * @tparam V The type of the primary key
+   * @param id The primary key of the object
+   * @param fetch The fetch type of the relations
+   * @return The object wrapped by an object_ptr
+   */
+  template < class T, class V >
+  object_ptr<T> get(const V &id, fetch_type fetch = fetch_type::LAZY)
+  {
+    prototype_iterator node = store().find<T>();
+    if (node == store().end()) {
+      throw_object_exception("couldn't find prototype node of type " << typeid(T).name());
+    }
+    std::shared_ptr<identifier<V>> typed_pk = std::make_shared<identifier<V>>(id);
+    std::shared_ptr<basic_identifier> pk = typed_pk;
+    if (!node->has_primary_key() || !node->id()->is_same_type(*pk)) {
+      throw_object_exception("primary key type mismatch for type " << node->type());
+    }
+    detail::identifier_key key = detail::identifier_key::of(*typed_pk);
+    object_proxy *proxy = node->find_proxy(key);
+    if (proxy) {
+      return object_ptr<T>(proxy);
+    }
+    auto i = persistence_.find_table(node->type());
+    if (i == persistence_.end()) {
+      throw_object_exception("couldn't find table " << node->type());
+    }
+    // reuse the placeholder proxy of a resolved relation
+    auto k = i->second->find_proxy(key);
+    if (k == i->second->end_proxy()) {
+      k = i->second->insert_proxy(key, pk, new object_proxy(pk, (T*)nullptr, node.get()));
+    }
+    proxy = k->second;
+    if (!i->second->load(connection_, store(), proxy, fetch)) {
+      return object_ptr<T>();
+    }
+    return object_ptr<T>(proxy);
+  }
+
+  /**
+   * @brief Selects the objects matching a condition
+   *
+   * Selects the objects of the given type matching
+   * the given condition on the database. The objects
+   * are inserted into the object store, objects which
+   * are already loaded are taken from the store. Only
+   * the matching rows are read, so there is no need
+   * to load the whole table first.
+   *
+   * @code
+   * auto adults = s.find<person>(column("age") >= 18);
+   * @endcode
+   *
+   * @tparam T The type of the objects
+   * @tparam COND The type of the condition
+   * @param cond The condition the objects must match
+   * @return The matching objects
+   */
+  template < class T, class COND >
+  std::vector<object_ptr<T>> find(const COND &cond)
+  {
+    prototype_iterator node = store().find<T>();
+    if (node == store().end()) {
+      throw_object_exception("couldn't find prototype node of type " << typeid(T).name());
+    }
+    auto i = persistence_.find_table(node->type());
+    if (i == persistence_.end()) {
+      throw_object_exception("couldn't find table " << node->type());
+    }
+    auto tbl = std::static_pointer_cast<table<T>>(i->second);
+    std::vector<object_ptr<T>> objects;
+    for (auto proxy : tbl->select(connection_, store(), cond)) {
+      objects.push_back(object_ptr<T>(proxy));
+    }
+    return objects;
+  }
+
   /**
    * @brief Select all object of a specific type
    *
@@ -309,9 +441,80 @@ public:
    *
    * Loads all tables from database. All object are inserted
    * into the underlying object_store.
+   *
+   * To load only the objects in use see get().
    */
   void load();
 
+  /**
+   * @brief Loads all tables from database with several connections.
+   *
+   * Loads all tables from database like load() but reads
+   * and decodes the tables concurrently with the given count
+   * of worker threads. Each worker reads tables with its own
+   * connection leased from the persistence connection pool.
+   * The count of workers is limited to the connections the
+   * pool can lease without waiting. If less than two are
+   * available the tables are loaded sequentially.
+   *
+   * Once all tables are read the objects are inserted into
+   * the underlying object_store on the calling thread in the
+   * same order as load() would do.
+   *
+   * @param workers The count of worker threads
+   */
+  void load_parallel(std::size_t workers);
+
+  /**
+   * @brief Creates a load cursor for the table of the given type
+   *
+   * @tparam T The type of the table
+   * @return The load cursor for the table
+   */
+  template < class T >
+  load_cursor cursor()
+  {
+    prototype_iterator node = store().find<T>();
+    if (node == store().end()) {
+      throw_object_exception("couldn't find prototype node of type " << typeid(T).name());
+    }
+    return load_cursor(node->type());
+  }
+
+  /**
+   * @brief Loads the next chunk of a table
+   *
+   * Loads the next chunk of at most chunk_size rows of
+   * the cursors table ordered by primary key into the
+   * underlying object_store. Each chunk is read with its
+   * own statement, so no read transaction is held open
+   * between two chunks.
+   *
+   * Returns false once the whole table was read. The
+   * load can be stopped after any chunk and resumed
+   * later with the same cursor.
+   *
+   * @param cursor The load cursor of the table
+   * @param chunk_size The maximum count of rows per chunk
+   * @return True if there might be more rows to load
+   */
+  bool load(load_cursor &cursor, std::size_t chunk_size);
+
+  /**
+   * @brief Loads a table in chunks
+   *
+   * Loads the cursors table chunk by chunk. After each
+   * chunk the given progress callback is called with
+   * the cursor. If the callback returns false loading
+   * stops and can be resumed later with the same cursor.
+   *
+   * @param cursor The load cursor of the table
+   * @param chunk_size The maximum count of rows per chunk
+   * @param progress The progress callback
+   * @return True if the whole table was read
+   */
+  bool load(load_cursor &cursor, std::size_t chunk_size, const t_load_progress &progress);
+
   /**
    * @brief Starts a transaction.
    *
@@ -326,6 +529,13 @@ public:
    */
   object_store& store();
 
+  /**
+   * @brief Return a reference to the database connection of the session
+   *
+   * @return A reference to the database connection.
+   */
+  connection& conn();
+
   /**
    * @brief Return a const reference to the underlaying object_store
    *
@@ -336,6 +546,8 @@ public:
 private:
   void load(const persistence::table_ptr &table);
 
+  std::vector<persistence::table_ptr> tables_in_load_order();
+
 private:
   class session_observer : public transaction::observer, public action_visitor
   {
@@ -355,6 +567,9 @@ private:
 private:
   persistence &persistence_;
 
+  connection_lease lease_;
+  connection &connection_;
+
   std::shared_ptr<transaction::observer> observer_;
 
 };
@@ -9,8 +9,12 @@
 #include "matador/object/object_store.hpp"
 #include "matador/object/prototype_node.hpp"
 #include "matador/object/object_proxy_accessor.hpp"
+#include "matador/object/field_snapshot.hpp"
+#include "matador/object/object_serializer.hpp"
 
 #include "matador/orm/basic_table.hpp"
+#include "matador/orm/batch_inserter.hpp"
+#include "matador/orm/eager_loader.hpp"
 #include "matador/orm/identifier_binder.hpp"
 #include "matador/orm/identifier_column_resolver.hpp"
 #include "matador/orm/relation_resolver.hpp"
@@ -18,6 +22,13 @@
 
 #include "matador/sql/query.hpp"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include <vector>
+
 
 namespace matador {
 
@@ -59,10 +70,17 @@ public:
    * @param p The underlying persistence object
    */
   table(prototype_node &node, persistence &p)
-    : basic_table(node, p), resolver_(*this)
-  {}
+    : basic_table(node, p), resolver_(*this), eager_loader_(*this)
+  {
+    node.object_loader([this](object_proxy *proxy) {
+      return persistence_.lazy_loading() && load(persistence_.load_conn(), *node_.tree(), proxy);
+    });
+  }
 
-  ~table() override = default;
+  ~table() override
+  {
+    node_.object_loader(nullptr);
+  }
 
   /**
    * @brief Create the table on database
@@ -99,52 +117,270 @@ public:
    * that all relations are resolved or at
    * least prepared for later resolve.
    *
+   * @param conn The database connection
    * @param store The object store to load the data into
    */
-  void load(object_store &store) override
+  void load(connection &conn, object_store &store) override
   {
-    auto result = select_.execute();
+    std::shared_ptr<basic_identifier> last;
+    auto result = prepared(conn).select_.execute();
+    allocate_from_node(result);
+    read(result, store, last, lazy_loaded_ || chunk_loaded_);
 
-    auto first = result.begin();
-    auto last = result.end();
+    // mark table as loaded
+    is_loaded_ = true;
+  }
 
-    while (first != last) {
-      // try to find object proxy by id
-      std::shared_ptr<basic_identifier> id(identifier_resolver_.resolve_object(first.get()));
-
-      auto i = identifier_proxy_map_.find(id);
-      if (i != identifier_proxy_map_.end()) {
-        // use proxy;
-        proxy_.reset(i->second);
-        proxy_->reset(first.release(), false, true);
-        identifier_proxy_map_.erase(i);
-      } else {
-        // create new proxy
-        proxy_.reset(new object_proxy(first.release()));
-      }
+  /**
+   * @brief Reads all rows of the table
+   *
+   * Reads and decodes all rows of the table with
+   * the given connection without touching the
+   * object store. The objects are inserted into
+   * the store with merge(). This way several tables
+   * can be read concurrently on different connections.
+   *
+   * @param conn The database connection
+   */
+  void fetch(connection &conn) override
+  {
+    fetched_.clear();
+    auto result = prepared(conn).select_.execute();
+    allocate_from_node(result);
+    for (auto first = result.begin(); first != result.end(); ++first) {
+      fetched_.emplace_back(first.release(), t_object_deleter(node_.object_allocator()));
+    }
+  }
 
-      ++first;
-      object_proxy *proxy = store.insert<table_type>(proxy_.release(), false);
-      resolver_.resolve(proxy, &store);
+  /**
+   * @brief Inserts the fetched objects into store
+   *
+   * Inserts all objects read with fetch() into the
+   * given object store and resolves their relations.
+   * Afterwards the table is marked as loaded.
+   *
+   * @param conn The database connection
+   * @param store The object store to insert the objects into
+   */
+  void merge(connection &, object_store &store) override
+  {
+    for (auto &obj : fetched_) {
+      std::shared_ptr<basic_identifier> id(identifier_resolver_.resolve_object(obj.get()));
+      insert_loaded(obj.release(), id, store, lazy_loaded_ || chunk_loaded_);
     }
+    fetched_.clear();
 
     // mark table as loaded
     is_loaded_ = true;
   }
 
+  /**
+   * @brief Loads a chunk of the tables data into store
+   *
+   * Loads the next chunk of at most limit rows
+   * ordered by primary key into the given object
+   * store. The chunk starts behind the given last
+   * primary key or at the beginning of the table
+   * if last is empty. Once the call returns last
+   * holds the primary key of the last row read.
+   *
+   * If less than limit rows were read the table
+   * is marked as loaded.
+   *
+   * @param conn The database connection
+   * @param store The object store to load the data into
+   * @param last The primary key of the last loaded row
+   * @param limit The maximum count of rows to load
+   * @return The count of rows read
+   */
+  std::size_t load(connection &conn, object_store &store, std::shared_ptr<basic_identifier> &last, std::size_t limit) override
+  {
+    prepared_statements &stmts = prepared(conn);
+    if (stmts.chunk_limit_ != limit) {
+      query<table_type> q(name());
+      column id = detail::identifier_column_resolver::resolve<T>();
+      stmts.first_chunk_ = q.select().order_by(id.name).asc().limit(limit).prepare(conn);
+      stmts.next_chunk_ = q.select().where(id > 1).order_by(id.name).asc().limit(limit).prepare(conn);
+      stmts.chunk_limit_ = limit;
+    }
+
+    statement<table_type> &stmt = (last ? stmts.next_chunk_ : stmts.first_chunk_);
+    stmt.reset();
+    if (last) {
+      stmt.bind(0, *last);
+    }
+
+    std::size_t rows = 0;
+    {
+      auto result = stmt.execute();
+      allocate_from_node(result);
+      // the rows may already be in the store (i.e. loaded
+      // by a full load or an earlier cursor), so always look
+      // up existing proxies
+      rows = read(result, store, last, true);
+    }
+    chunk_loaded_ = true;
+    // finish the select
+    stmt.reset();
+
+    if (rows < limit) {
+      is_loaded_ = true;
+    }
+    return rows;
+  }
+
+  /**
+   * @brief Loads the object of an unloaded proxy
+   *
+   * Loads the object of the given placeholder proxy
+   * with a select statement by its primary key and
+   * inserts it into the given object store. All
+   * relations of the object are resolved or prepared
+   * for later resolve. The items of its has many
+   * relations are selected by the primary key of
+   * the object.
+   *
+   * @param conn The database connection
+   * @param store The object store to load the object into
+   * @param proxy The unloaded proxy
+   * @return True if the object was found
+   */
+  bool load(connection &conn, object_store &store, object_proxy *proxy) override
+  {
+    return load(conn, store, proxy, fetch_type::LAZY);
+  }
+
+  /**
+   * @brief Loads the object of an unloaded proxy with its relations
+   *
+   * Loads the object of the given placeholder proxy
+   * like above. With an eager fetch type the tables
+   * of the belongs to and has one relations are joined
+   * into the select and the related objects are
+   * inserted into the store as well. This way the
+   * object and its related objects are read with
+   * one statement. The items of the has many relations
+   * are selected from their relation tables by the
+   * primary key of the object.
+   *
+   * @param conn The database connection
+   * @param store The object store to load the object into
+   * @param proxy The unloaded proxy
+   * @param fetch The fetch type of the relations
+   * @return True if the object was found
+   */
+  bool load(connection &conn, object_store &store, object_proxy *proxy, fetch_type fetch) override
+  {
+    std::shared_ptr<basic_identifier> pk = proxy->pk();
+    table_type *obj = nullptr;
+    if (fetch == fetch_type::EAGER && eager_loader_.has_relations()) {
+      prepared_statements &stmts = prepared(conn);
+      if (!stmts.eager_prepared_) {
+        stmts.eager_ = eager_loader_.prepare(conn);
+        stmts.eager_prepared_ = true;
+      }
+      obj = eager_loader_.load(stmts.eager_, store, *pk);
+    } else {
+      obj = find(conn, *pk);
+    }
+
+    if (obj == nullptr) {
+      return false;
+    }
+
+    proxy->reset(obj, false, true, node_.object_allocator());
+    auto i = identifier_proxy_map_.find(pk);
+    if (i != identifier_proxy_map_.end() && i->second == proxy) {
+      identifier_proxy_map_.erase(i);
+    }
+    store.insert<table_type>(proxy, false);
+    // the items of the has many relations are put into
+    // the relation data of this table and appended on resolve
+    if (eager_loader_.has_relations()) {
+      eager_loader_.load_items(conn, store, pk);
+    }
+    resolver_.resolve(proxy, &store);
+    lazy_loaded_ = true;
+    return true;
+  }
+
+  /**
+   * @brief Loads the objects matching the given condition
+   *
+   * Selects the rows matching the given condition with
+   * a prepared statement and inserts the read objects
+   * into the given object store. Objects already loaded
+   * aren't read twice, the proxy in the store is used
+   * instead. Only the matching rows are read, the rest
+   * of the table stays unloaded.
+   *
+   * @tparam COND The type of the condition
+   * @param conn The database connection
+   * @param store The object store to load the objects into
+   * @param cond The condition the objects must match
+   * @return The proxies of the matching objects
+   */
+  template < class COND >
+  std::vector<object_proxy*> select(connection &conn, object_store &store, COND cond)
+  {
+    query<table_type> q(name());
+    statement<table_type> stmt(q.select().where(cond).prepare(conn));
+    stmt.reset();
+    // the condition is a copy, so its values
+    // outlive the execution of the statement
+    cond.bind(stmt, 0);
+
+    std::vector<object_proxy*> proxies;
+    {
+      auto result = stmt.execute();
+      allocate_from_node(result);
+      auto first = result.begin();
+      auto last = result.end();
+      while (first != last) {
+        table_type *obj = first.release();
+        ++first;
+        std::shared_ptr<basic_identifier> id(identifier_resolver_.resolve_object(obj));
+        proxies.push_back(insert_loaded(obj, id, store, true));
+      }
+    }
+    // finish the select
+    stmt.reset();
+    lazy_loaded_ = true;
+    return proxies;
+  }
+
   /**
    * @brief Insert the object proxy into the table
    *
    * Insert the given object proxy into the database
    * table.
    *
+   * @param conn The database connection
    * @param proxy The object proxy to be inserted
    */
-  void insert(object_proxy *proxy) override
+  void insert(connection &conn, object_proxy *proxy) override
   {
-    insert_.bind(0, static_cast<table_type *>(proxy->obj()));
+    statement<table_type> &stmt = prepared(conn).insert_;
+    stmt.bind(0, static_cast<table_type *>(proxy->obj()));
     // Todo: check result
-    insert_.execute();
+    stmt.execute();
+  }
+
+  /**
+   * @brief Insert the object proxies into the table
+   *
+   * Insert the given range of object proxies into
+   * the database table. The objects are inserted
+   * with multi row insert statements holding up
+   * to batch_size() rows.
+   *
+   * @param conn The database connection
+   * @param first The first object proxy to be inserted
+   * @param last The last object proxy to be inserted
+   */
+  void insert(connection &conn, t_proxy_iterator first, t_proxy_iterator last) override
+  {
+    prepared(conn).batch_inserter_.insert(first, last, batch_size());
   }
 
   /**
@@ -153,15 +389,62 @@ public:
    * Updates the given object proxy on
    * the database.
    *
+   * @param conn The database connection
+   * @param proxy The object proxy to update
+   */
+  void update(connection &conn, object_proxy *proxy) override
+  {
+    statement<table_type> &stmt = prepared(conn).update_;
+    auto *obj = static_cast<table_type *>(proxy->obj());
+    size_t pos = stmt.bind(0, obj);
+    binder_.bind(obj, &stmt, pos);
+    // Todo: check result
+    stmt.execute();
+  }
+
+  /**
+   * @brief Updates the changed fields of the object proxy on database
+   *
+   * Updates only the columns of the fields changed
+   * since the given snapshot was taken. The snapshot
+   * must be taken before the object was changed. The
+   * update statements are prepared once per set of
+   * changed fields. If the changed fields are unknown or all
+   * fields were changed the whole row is updated.
+   *
+   * @param conn The database connection
    * @param proxy The object proxy to update
+   * @param snapshot The field values before the update
    */
-  void update(object_proxy *proxy) override
+  void update(connection &conn, object_proxy *proxy, const detail::field_snapshot &snapshot) override
   {
     auto *obj = static_cast<table_type *>(proxy->obj());
-    size_t pos = update_.bind(0, obj);
-    binder_.bind(obj, &update_, pos);
+    object_serializer serializer;
+    std::vector<bool> fields = snapshot.changed(*obj, serializer);
+    // the row is fully updated if nothing
+    // or all fields were changed
+    if (std::find(fields.begin(), fields.end(), true) == fields.end() ||
+        std::find(fields.begin(), fields.end(), false) == fields.end()) {
+      update(conn, proxy);
+      return;
+    }
+
+    prepared_statements &stmts = prepared(conn);
+    auto i = stmts.partial_updates_.find(fields);
+    if (i == stmts.partial_updates_.end()) {
+      if (stmts.partial_updates_.size() >= MAX_PARTIAL_UPDATES) {
+        update(conn, proxy);
+        return;
+      }
+      query<table_type> q(name());
+      column id = detail::identifier_column_resolver::resolve<T>();
+      i = stmts.partial_updates_.insert(std::make_pair(fields, q.update(fields).where(id == 1).prepare(conn))).first;
+    }
+    statement<table_type> &stmt = i->second;
+    size_t pos = stmt.bind(0, obj, fields);
+    binder_.bind(obj, &stmt, pos);
     // Todo: check result
-    update_.execute();
+    stmt.execute();
   }
 
   /**
@@ -170,18 +453,26 @@ public:
    * The object represented by the object proxy
    * is deleted from the table
    *
+   * @param conn The database connection
    * @param proxy The object proxy to be deleted
    */
-  void remove(object_proxy *proxy) override
+  void remove(connection &conn, object_proxy *proxy) override
   {
-    binder_.bind(static_cast<table_type *>(proxy->obj()), &delete_, 0);
+    statement<table_type> &stmt = prepared(conn).delete_;
+    binder_.bind(static_cast<table_type *>(proxy->obj()), &stmt, 0);
     // Todo: check result
-    delete_.execute();
+    stmt.execute();
   }
 
 /// @cond MATADOR_DEV
   template<class V>
   void append_relation_data(const std::string &field, const std::shared_ptr<basic_identifier> &id, const V &val, object_proxy *owner);
+
+  void insert_fetched(table_type *obj, const std::shared_ptr<basic_identifier> &id, object_store &store)
+  {
+    insert_loaded(obj, id, store, true);
+    lazy_loaded_ = true;
+  }
 /// @endcond
 
 protected:
@@ -191,38 +482,190 @@ protected:
    * Prepares the table object for the given connection.
    * Subsequently some prepared statements are created:
    * - select
+   * - select by primary key
    * - insert
    * - update
    * - delete
    *
    * These statements will be used on the provide
-   * methods.
+   * methods. Each connection gets its own set
+   * of prepared statements.
    *
    * @param conn The database connection
    */
   void prepare(connection &conn) override
   {
+    std::unique_ptr<prepared_statements> stmts(new prepared_statements);
     query<table_type> q(name());
-    insert_ = q.insert().prepare(conn);
+    stmts->insert_ = q.insert().prepare(conn);
+    stmts->batch_inserter_.prepare(conn, name(), *node().template prototype<table_type>());
     column id = detail::identifier_column_resolver::resolve<T>();
-    update_ = q.update().where(id == 1).prepare(conn);
-    delete_ = q.remove().where(id == 1).prepare(conn);
-    select_ = q.select().prepare(conn);
+    stmts->update_ = q.update().where(id == 1).prepare(conn);
+    stmts->delete_ = q.remove().where(id == 1).prepare(conn);
+    stmts->select_ = q.select().prepare(conn);
+    stmts->find_ = q.select().where(id == 1).prepare(conn);
+
+    std::lock_guard<std::shared_timed_mutex> lock(statements_mutex_);
+    statements_[&conn] = std::move(stmts);
+  }
+
+  /**
+   * @brief Releases the prepared statements of a connection
+   *
+   * @param conn The database connection
+   */
+  void release(connection &conn) override
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(statements_mutex_);
+    statements_.erase(&conn);
   }
 
 private:
+  // upper bound of cached update statements per connection
+  static const std::size_t MAX_PARTIAL_UPDATES = 64;
+
+  struct prepared_statements
+  {
+    statement<table_type> insert_;
+    statement<table_type> update_;
+    statement<table_type> delete_;
+    statement<table_type> select_;
+    statement<table_type> find_;
+
+    // update statements by changed fields
+    std::map<std::vector<bool>, statement<table_type>> partial_updates_;
+
+    statement<table_type> first_chunk_;
+    statement<table_type> next_chunk_;
+    std::size_t chunk_limit_ = 0;
+
+    statement<detail::eager_row<table_type>> eager_;
+    bool eager_prepared_ = false;
+
+    detail::batch_inserter<table_type> batch_inserter_;
+  };
+
+  prepared_statements& prepared(connection &conn)
+  {
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(statements_mutex_);
+      auto i = statements_.find(&conn);
+      if (i != statements_.end()) {
+        return *i->second;
+      }
+    }
+    // the statements of a connection are only used by
+    // the thread holding the connection, so they stay
+    // valid after the lock is released
+    prepare(conn);
+    std::shared_lock<std::shared_timed_mutex> lock(statements_mutex_);
+    return *statements_.find(&conn)->second;
+  }
+
+  table_type* find(connection &conn, basic_identifier &pk)
+  {
+    statement<table_type> &stmt = prepared(conn).find_;
+    stmt.reset();
+    stmt.bind(0, pk);
+    table_type *obj = nullptr;
+    {
+      auto result = stmt.execute();
+      allocate_from_node(result);
+      auto first = result.begin();
+      if (first != result.end()) {
+        obj = first.release();
+      }
+    }
+    // finish the select
+    stmt.reset();
+    return obj;
+  }
+
+  std::size_t read(result<table_type> &res, object_store &store, std::shared_ptr<basic_identifier> &last, bool skip_loaded)
+  {
+    std::size_t rows = 0;
+    auto first = res.begin();
+    auto end = res.end();
+
+    while (first != end) {
+      ++rows;
+      t_object_ptr obj(first.release(), t_object_deleter(node_.object_allocator()));
+      ++first;
+
+      std::shared_ptr<basic_identifier> id(identifier_resolver_.resolve_object(obj.get()));
+      last.reset(id->clone());
+      insert_loaded(obj.release(), id, store, skip_loaded);
+    }
+    return rows;
+  }
+
+  object_proxy* insert_loaded(table_type *obj, const std::shared_ptr<basic_identifier> &id, object_store &store, bool skip_loaded)
+  {
+    if (skip_loaded) {
+      object_proxy *loaded = node_.find_proxy(id);
+      if (loaded != nullptr) {
+        // object was already loaded on demand or in a chunk
+        detail::delete_object(obj, node_.object_allocator());
+        return loaded;
+      }
+    }
+
+    // try to find object proxy by id
+    auto i = identifier_proxy_map_.find(id);
+    if (i != identifier_proxy_map_.end()) {
+      // use proxy;
+      proxy_.reset(i->second);
+      proxy_->reset(obj, false, true);
+      identifier_proxy_map_.erase(i);
+    } else {
+      // create new proxy
+      proxy_.reset(new (node_.proxy_allocator()) object_proxy(obj));
+    }
+    proxy_->object_allocator(node_.object_allocator());
+
+    object_proxy *proxy = store.insert<table_type>(proxy_.release(), false);
+    resolver_.resolve(proxy, &store);
+    return proxy;
+  }
+
+  void allocate_from_node(result<table_type> &res)
+  {
+    if (!node_.has_slab_allocation()) {
+      return;
+    }
+    // objects are created in the slabs of the node
+    prototype_node &node = node_;
+    res.creator([&node]() {
+      return node.construct<table_type>();
+    });
+    res.destroyer(t_object_deleter(node_.object_allocator()));
+  }
+
+private:
+  typedef detail::pooled_object_deleter<table_type> t_object_deleter;
+  typedef std::unique_ptr<table_type, t_object_deleter> t_object_ptr;
+
   detail::identifier_binder<table_type> binder_;
 
-  statement<table_type> insert_;
-  statement<table_type> update_;
-  statement<table_type> delete_;
-  statement<table_type> select_;
+  // connections of a pool are used and released from several threads
+  std::shared_timed_mutex statements_mutex_;
+  std::unordered_map<connection*, std::unique_ptr<prepared_statements>> statements_;
 
   detail::relation_resolver<T> resolver_;
 
+  detail::eager_loader<T> eager_loader_;
+
   std::unique_ptr<object_proxy> proxy_;
 
   identifier_resolver<T> identifier_resolver_;
+
+  // objects read by fetch()
+  std::vector<t_object_ptr> fetched_;
+
+  // true if objects were loaded on demand
+  bool lazy_loaded_ = false;
+  // true if objects were loaded in chunks
+  bool chunk_loaded_ = false;
 };
 
 /// @cond MATADOR_DEV
@@ -277,82 +720,186 @@ public:
 
   void prepare(connection &conn) override
   {
+    std::unique_ptr<prepared_statements> stmts(new prepared_statements);
     query<table_type> q(name());
 
     table_type *proto = node().template prototype<table_type>();
-    select_all_ = q.select({proto->left_column(), proto->right_column()}).prepare(conn);
-    insert_ = q.insert(*proto).prepare(conn);
-
     column owner_id(proto->left_column());
     column item_id(proto->right_column());
 
-    update_ = q.update(*proto).where(owner_id == 1 && item_id == 1).limit(1).prepare(conn);
-    delete_ = q.remove().where(owner_id == 1 && item_id == 1).limit(1).prepare(conn);
+    stmts->select_all_ = q.select({proto->left_column(), proto->right_column()}).prepare(conn);
+    stmts->select_items_ = q.select({proto->left_column(), proto->right_column()}).where(owner_id == 1).prepare(conn);
+    stmts->insert_ = q.insert(*proto).prepare(conn);
+    stmts->batch_inserter_.prepare(conn, name(), *proto);
+
+    stmts->update_ = q.update(*proto).where(owner_id == 1 && item_id == 1).limit(1).prepare(conn);
+    stmts->delete_ = q.remove().where(owner_id == 1 && item_id == 1).limit(1).prepare(conn);
 
+    std::lock_guard<std::shared_timed_mutex> lock(statements_mutex_);
+    // the resolver is shared by the statements of all
+    // connections, so it is prepared under the same lock
     resolver_.prepare();
+    statements_[&conn] = std::move(stmts);
   }
 
-  void load(object_store &store) override
+  void release(connection &conn) override
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(statements_mutex_);
+    statements_.erase(&conn);
+  }
+
+  void load(connection &conn, object_store &store) override
   {
     if (is_loaded_) {
       return;
     }
-    auto res = select_all_.execute();
+    auto res = prepared(conn).select_all_.execute();
+    read(res, store);
 
-    // set explicit creator function
-    prototype_node &node = this->node();
-
-    res.creator([&node]() {
-      return node.create<T>();
-    });
-
-    auto first = res.begin();
-    auto last = res.end();
+    loaded_owners_.clear();
+    is_loaded_ = true;
+  }
 
-    while (first != last) {
-      // create new proxy of relation object
-      proxy_.reset(new object_proxy(first.release()));
-      ++first;
-      object_proxy *proxy = store.insert<T>(proxy_.release(), false);
-      resolver_.resolve(proxy, &store);
+  /**
+   * Selects only the items of the given owner. The
+   * owner is remembered, so its items are neither
+   * selected twice nor read again on a full load.
+   */
+  void load_items(connection &conn, object_store &store, const std::shared_ptr<basic_identifier> &owner) override
+  {
+    if (is_loaded_ || loaded_owners_.find(owner) != loaded_owners_.end()) {
+      return;
+    }
+    statement<T> &stmt = prepared(conn).select_items_;
+    stmt.reset();
+    stmt.bind(0, *owner);
+    {
+      auto res = stmt.execute();
+      read(res, store);
     }
+    // finish the select
+    stmt.reset();
+    loaded_owners_.insert(owner);
+  }
 
-    is_loaded_ = true;
+  void reset() override
+  {
+    basic_table::reset();
+    loaded_owners_.clear();
   }
 
-  void insert(object_proxy *proxy) override
+  void insert(connection &conn, object_proxy *proxy) override
   {
-    insert_.bind(0, static_cast<T*>(proxy->obj()));
+    statement<T> &stmt = prepared(conn).insert_;
+    stmt.bind(0, static_cast<T*>(proxy->obj()));
     // Todo: check result
-    insert_.execute();
+    stmt.execute();
+  }
+
+  void insert(connection &conn, t_proxy_iterator first, t_proxy_iterator last) override
+  {
+    prepared(conn).batch_inserter_.insert(first, last, batch_size());
   }
 
-  void update(object_proxy *proxy) override
+  void update(connection &conn, object_proxy *proxy) override
   {
-    size_t pos = update_.bind(0, static_cast<T*>(proxy->obj()));
-    update_.bind(pos, static_cast<T*>(proxy->obj()));
+    statement<T> &stmt = prepared(conn).update_;
+    size_t pos = stmt.bind(0, static_cast<T*>(proxy->obj()));
+    stmt.bind(pos, static_cast<T*>(proxy->obj()));
 
-    update_.execute();
+    stmt.execute();
   }
 
-  void remove(object_proxy *proxy) override
+  void remove(connection &conn, object_proxy *proxy) override
   {
-    delete_.bind(0, static_cast<T*>(proxy->obj()));
-    delete_.execute();
+    statement<T> &stmt = prepared(conn).delete_;
+    stmt.bind(0, static_cast<T*>(proxy->obj()));
+    stmt.execute();
   }
 
   template < class V >
   void append_relation_data(const std::string &, const std::shared_ptr<basic_identifier> &, const V &) { }
 
 private:
-  statement<T> select_all_;
-  statement<T> insert_;
-  statement<T> update_;
-  statement<T> delete_;
+  struct prepared_statements
+  {
+    statement<T> select_all_;
+    statement<T> select_items_;
+    statement<T> insert_;
+    statement<T> update_;
+    statement<T> delete_;
+
+    detail::batch_inserter<T> batch_inserter_;
+  };
+
+  prepared_statements& prepared(connection &conn)
+  {
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(statements_mutex_);
+      auto i = statements_.find(&conn);
+      if (i != statements_.end()) {
+        return *i->second;
+      }
+    }
+    // the statements of a connection are only used by
+    // the thread holding the connection, so they stay
+    // valid after the lock is released
+    prepare(conn);
+    std::shared_lock<std::shared_timed_mutex> lock(statements_mutex_);
+    return *statements_.find(&conn)->second;
+  }
+
+  void read(result<T> &res, object_store &store)
+  {
+    // set explicit creator function
+    prototype_node &node = this->node();
+
+    res.creator([&node]() {
+      return node.construct<T>();
+    });
+    res.destroyer(detail::pooled_object_deleter<T>(node.object_allocator()));
+
+    auto first = res.begin();
+    auto last = res.end();
+
+    while (first != last) {
+      T *item = first.release();
+      ++first;
+      if (is_loaded_owner(*item)) {
+        // items of this owner were already loaded
+        detail::delete_object(item, node.object_allocator());
+        continue;
+      }
+      // create new proxy of relation object
+      proxy_.reset(new (node.proxy_allocator()) object_proxy(item));
+      proxy_->object_allocator(node.object_allocator());
+      object_proxy *proxy = store.insert<T>(proxy_.release(), false);
+      resolver_.resolve(proxy, &store);
+    }
+  }
+
+  bool is_loaded_owner(const T &item) const
+  {
+    if (loaded_owners_.empty()) {
+      return false;
+    }
+    std::shared_ptr<basic_identifier> owner = item.left().primary_key();
+    return owner && loaded_owners_.find(owner) != loaded_owners_.end();
+  }
+
+private:
+  typedef std::unordered_set<detail::identifier_ptr, detail::identifier_hash<detail::identifier_ptr>, detail::identifier_equal> t_identifier_set;
+
+  // connections of a pool are used and released from several threads
+  std::shared_timed_mutex statements_mutex_;
+  std::unordered_map<connection*, std::unique_ptr<prepared_statements>> statements_;
 
   detail::relation_resolver<T> resolver_;
 
   std::unique_ptr<object_proxy> proxy_;
+
+  // owners whose items were loaded with load_items()
+  t_identifier_set loaded_owners_;
 };
 
 /// @endcond
@@ -360,5 +907,6 @@ private:
 }
 
 #include "matador/orm/relation_resolver.tpp"
+#include "matador/orm/eager_loader.tpp"
 
 #endif //OOS_TABLE_HPP
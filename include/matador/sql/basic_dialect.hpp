@@ -34,6 +34,8 @@ namespace matador {
 
 class basic_dialect;
 class sql;
+class date;
+class time;
 
 namespace detail {
 
@@ -129,6 +131,12 @@ public:
   /**
    * @brief Build a sql statement as a prepared statement
    *
+   * The prepared statements are cached by the
+   * structure of their token list. Any sql object
+   * with the same structure, regardless of its
+   * values, is only compiled and linked once
+   * per dialect.
+   *
    * @param s The sql object to be compiled and linked
    * @return The sql string as a prepared statement
    */
@@ -156,10 +164,42 @@ public:
    */
   size_t column_count() const;
 
+  /**
+   * @brief The count of cached prepared statements
+   *
+   * @return Count of cached prepared statements
+   */
+  size_t prepared_count() const;
+
+  /**
+   * @brief The maximum count of values to be bind
+   *
+   * This function returns the maximum count
+   * of values which could be bind to one
+   * prepared statement of this dialect.
+   * The count is unlimited by default.
+   *
+   * @return Maximum count of values to be bind
+   */
+  virtual size_t max_bind_count() const;
+
+  /**
+   * @brief The maximum count of rows of one insert
+   *
+   * This function returns the maximum count
+   * of value rows one multi row insert
+   * statement of this dialect could hold.
+   *
+   * @return Maximum count of rows of one insert
+   */
+  virtual size_t max_insert_rows() const;
+
   /**
    * Prepare sql dialect identifier for execution
    * and escape quotes and quote the identifier
-   * string
+   * string. The parts of an identifier qualified
+   * with a table name (i.e. table.column) are
+   * quoted separately.
    *
    * @param str The identifier string to be prepared
    * @return The prepared string
@@ -173,6 +213,26 @@ public:
    */
   std::string prepare_literal(const std::string &str) const;
 
+  /**
+   * Returns the literal of the given date as
+   * it is written into a direct statement. The
+   * default is a quoted ISO 8601 date string.
+   *
+   * @param d The date
+   * @return The date literal
+   */
+  virtual std::string date_literal(const matador::date &d) const;
+
+  /**
+   * Returns the literal of the given time as
+   * it is written into a direct statement. The
+   * default is a quoted ISO 8601 time string.
+   *
+   * @param t The time
+   * @return The time literal
+   */
+  virtual std::string time_literal(const matador::time &t) const;
+
   /**
    * Wrap identifier quotes around a sql identifier keyword
    *
@@ -256,6 +316,16 @@ private:
   size_t bind_count_ = 0;
   size_t column_count_ = 0;
 
+  // prepared statements by the structure of their token list
+  struct prepared_statement
+  {
+    std::string result;
+    size_t bind_count = 0;
+    size_t column_count = 0;
+  };
+  typedef std::unordered_map<std::string, prepared_statement> t_prepared_map;
+  t_prepared_map prepared_;
+
   t_compile_type compile_type_ = DIRECT;
 
   detail::basic_dialect_compiler* compiler_;
@@ -286,6 +356,9 @@ private:
     {detail::token::AS, "AS"},
     {detail::token::OFFSET, "OFFSET"},
     {detail::token::DISTINCT, "DISTINCT"},
+    {detail::token::JOIN, "JOIN"},
+    {detail::token::LEFT_JOIN, "LEFT JOIN"},
+    {detail::token::ON, "ON"},
     {detail::token::SET, "SET"},
     {detail::token::NOT_NULL, "NOT NULL"},
     {detail::token::PRIMARY_KEY, "PRIMARY KEY"},
@@ -55,6 +55,8 @@ public:
   virtual void visit(const matador::detail::basic_value_column &) override;
   virtual void visit(const matador::detail::from &) override;
   virtual void visit(const matador::detail::where &) override;
+  virtual void visit(const matador::detail::join &) override;
+  virtual void visit(const matador::detail::on &) override;
   virtual void visit(const matador::detail::basic_condition &) override;
   virtual void visit(const matador::detail::basic_column_condition &) override;
   virtual void visit(const matador::detail::basic_in_condition &) override;
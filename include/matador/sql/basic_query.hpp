@@ -120,6 +120,8 @@ protected:
     QUERY_COLUMN,
     QUERY_SET,
     QUERY_FROM,
+    QUERY_JOIN,
+    QUERY_ON,
     QUERY_WHERE,
     QUERY_COND_WHERE,
     QUERY_ORDERBY,
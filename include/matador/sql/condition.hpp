@@ -35,6 +35,9 @@
 #include "matador/sql/column.hpp"
 #include "matador/sql/token.hpp"
 #include "matador/sql/basic_query.hpp"
+#include "matador/sql/token_structure.hpp"
+
+#include "matador/utils/serializer.hpp"
 
 #include <string>
 #include <sstream>
@@ -80,6 +83,25 @@ public:
 
   virtual std::string evaluate(basic_dialect &dialect) const = 0;
 
+  /**
+   * Serializes the values of the condition in the
+   * order of their placeholders. Used to bind the
+   * values of conditions which types are unknown,
+   * i.e. the conditions of a subquery.
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  virtual void serialize_values(serializer &srlzr);
+
+  /**
+   * Writes the structure of the condition, its
+   * columns and operands but not the values bound
+   * to placeholders, to the given string.
+   *
+   * @param out The string to append to
+   */
+  virtual void structure(std::string &out) const = 0;
+
   static std::array<std::string, num_operands> operands;
 };
 
@@ -116,6 +138,47 @@ public:
   virtual size_t size() const = 0;
 };
 
+/**
+ * Serializer binding each serialized value
+ * to the next host value of a statement
+ *
+ * @tparam S The type of the prepared statement
+ */
+template < class S >
+class condition_value_binder : public serializer
+{
+public:
+  condition_value_binder(S &stmt, std::size_t index)
+    : stmt_(stmt), index_(index)
+  {}
+
+  void serialize(const char *, char &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, short &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, int &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, long &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, unsigned char &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, unsigned short &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, unsigned int &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, unsigned long &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, bool &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, float &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, double &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, std::string &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, matador::varchar_base &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, matador::time &x) override { index_ = stmt_.bind(index_, x); }
+  void serialize(const char *, matador::date &x) override { index_ = stmt_.bind(index_, x); }
+  // conditions don't hold values of the following types
+  void serialize(const char *, char *, size_t) override {}
+  void serialize(const char *, matador::basic_identifier &) override {}
+  void serialize(const char *, matador::identifiable_holder &, cascade_type) override {}
+
+  std::size_t index() const { return index_; }
+
+private:
+  S &stmt_;
+  std::size_t index_;
+};
+
 /// @endcond
 
 }
@@ -162,6 +225,23 @@ public:
     }
     return str.str();
   }
+
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    return stmt.bind(index, value);
+  }
+
+  void serialize_values(serializer &srlzr) override
+  {
+    srlzr.serialize("", value);
+  }
+
+  void structure(std::string &out) const override
+  {
+    detail::token_structure::write_identifier(out, field_.name);
+    out.append(" ").append(operand).append(" ?");
+  }
 };
 
 template<class T>
@@ -187,6 +267,29 @@ public:
     }
     return str.str();
   }
+
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    // the statement keeps a pointer to the bound text
+    host_value_ = value;
+    return stmt.bind(index, host_value_);
+  }
+
+  void serialize_values(serializer &srlzr) override
+  {
+    host_value_ = value;
+    srlzr.serialize("", host_value_);
+  }
+
+  void structure(std::string &out) const override
+  {
+    detail::token_structure::write_identifier(out, field_.name);
+    out.append(" ").append(operand).append(" ?");
+  }
+
+private:
+  std::string host_value_;
 };
 
 template<class T>
@@ -209,6 +312,22 @@ public:
     str << value << " " << operand << " " << dialect.prepare_identifier(field_.name);
     return str.str();
   }
+
+  void structure(std::string &out) const override
+  {
+    // the value is part of the statement
+    std::stringstream str;
+    str << value;
+    out.append(str.str()).append(" ").append(operand).append(" ");
+    detail::token_structure::write_identifier(out, field_.name);
+  }
+
+  template < class S >
+  std::size_t bind(S &, std::size_t index)
+  {
+    // value is part of the statement
+    return index;
+  }
 };
 
 template<class T>
@@ -230,6 +349,54 @@ public:
     str << "'" << value << "' " << operand << " " << dialect.prepare_identifier(field_.name);
     return str.str();
   }
+
+  void structure(std::string &out) const override
+  {
+    // the value is part of the statement
+    detail::token_structure::write_identifier(out, value);
+    out.append(" ").append(operand).append(" ");
+    detail::token_structure::write_identifier(out, field_.name);
+  }
+
+  template < class S >
+  std::size_t bind(S &, std::size_t index)
+  {
+    // value is part of the statement
+    return index;
+  }
+};
+
+template<>
+class condition<column, column> : public detail::basic_condition
+{
+public:
+  condition(const column &left, detail::basic_condition::t_operand op, const column &right)
+    : left_(left)
+    , operand(detail::basic_condition::operands[op])
+    , right_(right)
+  { }
+
+  column left_;
+  std::string operand;
+  column right_;
+
+  std::string evaluate(basic_dialect &dialect) const override
+  {
+    return dialect.prepare_identifier(left_.name) + " " + operand + " " + dialect.prepare_identifier(right_.name);
+  }
+
+  void structure(std::string &out) const override
+  {
+    detail::token_structure::write_identifier(out, left_.name);
+    out.append(" ").append(operand).append(" ");
+    detail::token_structure::write_identifier(out, right_.name);
+  }
+
+  template < class S >
+  std::size_t bind(S &, std::size_t index)
+  {
+    return index;
+  }
 };
 
 /// @endcond
@@ -307,6 +474,46 @@ public:
     return args_.size();
   }
 
+  /**
+   * @brief Binds the arguments to the given statement
+   *
+   * @tparam S The type of the prepared statement
+   * @param stmt The prepared statement
+   * @param index The index of the first argument
+   * @return The next index to bind
+   */
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    for (auto &arg : args_) {
+      index = stmt.bind(index, arg);
+    }
+    return index;
+  }
+
+  /**
+   * @brief Serializes the argument values
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  void serialize_values(serializer &srlzr) override
+  {
+    for (auto &arg : args_) {
+      srlzr.serialize("", arg);
+    }
+  }
+
+  /**
+   * @brief Writes the column and the number of arguments
+   *
+   * @param out The string to append to
+   */
+  void structure(std::string &out) const override
+  {
+    detail::token_structure::write_identifier(out, field_.name);
+    out.append(" IN ").append(std::to_string(args_.size()));
+  }
+
 private:
   std::vector<V> args_;
 };
@@ -356,6 +563,39 @@ public:
     return result;
   }
 
+  /**
+   * @brief Binds the values of the conditions
+   * of the query to the given statement
+   *
+   * @tparam S The type of the prepared statement
+   * @param stmt The prepared statement
+   * @param index The index of the first value
+   * @return The next index to bind
+   */
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    detail::condition_value_binder<S> binder(stmt, index);
+    serialize_values(binder);
+    return binder.index();
+  }
+
+  /**
+   * @brief Serializes the values of the where
+   * conditions of the query
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  void serialize_values(serializer &srlzr) override;
+
+  /**
+   * @brief Writes the column and the
+   * structure of the query
+   *
+   * @param out The string to append to
+   */
+  void structure(std::string &out) const override;
+
 private:
   column field_;
   detail::basic_query query_;
@@ -402,6 +642,43 @@ public:
     return str.str();
   }
 
+  /**
+   * @brief Binds the boundary values to the given statement
+   *
+   * @tparam S The type of the prepared statement
+   * @param stmt The prepared statement
+   * @param index The index of the lower boundary
+   * @return The next index to bind
+   */
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    index = stmt.bind(index, range_.first);
+    return stmt.bind(index, range_.second);
+  }
+
+  /**
+   * @brief Serializes both boundary values
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  void serialize_values(serializer &srlzr) override
+  {
+    srlzr.serialize("", range_.first);
+    srlzr.serialize("", range_.second);
+  }
+
+  /**
+   * @brief Writes the column of the range check
+   *
+   * @param out The string to append to
+   */
+  void structure(std::string &out) const override
+  {
+    detail::token_structure::write_identifier(out, field_.name);
+    out.append(" BETWEEN ? AND ?");
+  }
+
 private:
   column field_;
   std::pair<T, T> range_;
@@ -449,6 +726,46 @@ public:
     return str.str();
   }
 
+  /**
+   * @brief Binds the values of both conditions to the given statement
+   *
+   * @tparam S The type of the prepared statement
+   * @param stmt The prepared statement
+   * @param index The index of the first value
+   * @return The next index to bind
+   */
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    index = left.bind(stmt, index);
+    return right.bind(stmt, index);
+  }
+
+  /**
+   * @brief Serializes the values of both conditions
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  void serialize_values(serializer &srlzr) override
+  {
+    left.serialize_values(srlzr);
+    right.serialize_values(srlzr);
+  }
+
+  /**
+   * @brief Writes the structure of both conditions
+   *
+   * @param out The string to append to
+   */
+  void structure(std::string &out) const override
+  {
+    out.append("(");
+    left.structure(out);
+    out.append(" ").append(detail::basic_condition::operands[operand]).append(" ");
+    right.structure(out);
+    out.append(")");
+  }
+
 private:
   condition<L1, R1> left;
   condition<L2, R2> right;
@@ -487,6 +804,42 @@ public:
     return str.str();
   }
 
+  /**
+   * @brief Binds the values of the negated condition to the given statement
+   *
+   * @tparam S The type of the prepared statement
+   * @param stmt The prepared statement
+   * @param index The index of the first value
+   * @return The next index to bind
+   */
+  template < class S >
+  std::size_t bind(S &stmt, std::size_t index)
+  {
+    return cond.bind(stmt, index);
+  }
+
+  /**
+   * @brief Serializes the values of the negated condition
+   *
+   * @param srlzr The serializer to serialize the values with
+   */
+  void serialize_values(serializer &srlzr) override
+  {
+    cond.serialize_values(srlzr);
+  }
+
+  /**
+   * @brief Writes the structure of the negated condition
+   *
+   * @param out The string to append to
+   */
+  void structure(std::string &out) const override
+  {
+    out.append(operand).append(" (");
+    cond.structure(out);
+    out.append(")");
+  }
+
 private:
   condition<L, R> cond;
   std::string operand;
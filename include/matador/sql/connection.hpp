@@ -18,10 +18,15 @@
 #include "matador/sql/result.hpp"
 #include "matador/sql/statement.hpp"
 #include "matador/sql/connection_impl.hpp"
+#include "matador/sql/statement_cache.hpp"
 #include "row.hpp"
 #include "field.hpp"
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace matador {
 
@@ -33,6 +38,8 @@ class basic_dialect;
 class OOS_SQL_API connection
 {
 public:
+  typedef std::shared_ptr<std::atomic<std::size_t>> t_schema_generation; /**< Shortcut to the shared schema generation */
+
   /**
    * @brief Creates an empty connection
    */
@@ -146,11 +153,16 @@ public:
   /**
    * @brief Execute a sql string statement with retrieving any result
    *
+   * If the statement changes the schema of the database
+   * (CREATE, DROP, ALTER or RENAME) the cached table
+   * descriptions are dropped.
+   *
    * @param stmt The statement to be executed
    */
   void execute(const std::string &stmt)
   {
     std::unique_ptr<detail::result_impl> res(impl_->execute(stmt));
+    schema_changed(stmt);
   }
 
   /**
@@ -185,6 +197,131 @@ public:
    */
   bool is_valid() const;
 
+  /**
+   * @brief Sets the capacity of the prepared statement cache
+   *
+   * Prepared statements are cached by their sql string.
+   * Once a statement is destroyed its backend statement
+   * is kept and reused by the next prepare of the same
+   * sql string. The cache holds at most capacity idle
+   * statements, the least recently used statement is
+   * dropped first. A capacity of zero disables the cache.
+   *
+   * @param capacity The maximum count of cached statements
+   */
+  void prepared_cache_capacity(std::size_t capacity);
+
+  /**
+   * @brief Returns the capacity of the prepared statement cache
+   *
+   * @return The capacity of the prepared statement cache
+   */
+  std::size_t prepared_cache_capacity() const;
+
+  /**
+   * @brief Enables or disables streaming of result sets
+   *
+   * Some backends (i.e. mysql) read the complete result
+   * set into client memory before the first row is
+   * returned. With streaming enabled the rows are read
+   * from the server while the result is iterated, so the
+   * memory needed doesn't grow with the size of the result.
+   *
+   * A streamed result occupies the connection until all
+   * of its rows are read or the result is destroyed. Only
+   * one streamed result can be open per connection,
+   * executing or preparing any other statement on the
+   * connection meanwhile throws an exception.
+   *
+   * The setting applies to the statements executed or
+   * prepared afterwards. A single prepared statement can
+   * be switched with statement::stream_results() as well.
+   *
+   * @param enable True to stream results
+   */
+  void stream_results(bool enable);
+
+  /**
+   * @brief Returns true if results are streamed
+   *
+   * @return True if results are streamed
+   */
+  bool streams_results() const;
+
+  /**
+   * @brief Returns the count of idle cached prepared statements
+   *
+   * @return The count of idle cached prepared statements
+   */
+  std::size_t prepared_cache_size() const;
+
+  /**
+   * @brief Returns the count of prepares served from the cache
+   *
+   * The counter is reset when the connection is closed.
+   *
+   * @return The count of prepared statement cache hits
+   */
+  std::size_t prepared_cache_hits() const;
+
+  /**
+   * @brief Returns the count of prepares sent to the database
+   *
+   * The counter is reset when the connection is closed.
+   *
+   * @return The count of prepared statement cache misses
+   */
+  std::size_t prepared_cache_misses() const;
+
+  /**
+   * @brief Drops all cached table descriptions
+   *
+   * The descriptions of the tables queried with
+   * row queries are cached per connection. The cache
+   * is dropped whenever a create or drop statement
+   * is executed by this connection or by a connection
+   * sharing its schema generation or the connection
+   * is closed. If the schema is changed from outside
+   * the cache must be refreshed explicitly.
+   */
+  void refresh_schema();
+
+  /**
+   * @brief Drops the cached description of the given table
+   *
+   * @param tablename The table to be described again
+   */
+  void refresh_schema(const std::string &tablename);
+
+  /**
+   * @brief Returns the count of cached table descriptions
+   *
+   * @return The count of cached table descriptions
+   */
+  std::size_t schema_cache_size() const;
+
+  /**
+   * @brief Returns the schema generation of the connection
+   *
+   * The schema generation is incremented on each schema
+   * change executed by the connection. A copied connection
+   * shares the generation of its origin.
+   *
+   * @return The schema generation of the connection
+   */
+  t_schema_generation schema_generation() const;
+
+  /**
+   * @brief Shares the given schema generation
+   *
+   * Connections sharing a schema generation drop
+   * their cached table descriptions whenever one of
+   * them changes the schema of the database.
+   *
+   * @param generation The schema generation to share
+   */
+  void schema_generation(const t_schema_generation &generation);
+
 private:
   template < class T >
   friend class query;
@@ -196,7 +333,9 @@ private:
   {
     // get column descriptions
     prepare_prototype_row(prototype, tablename);
-    return result<T>(impl_->execute(stmt), prototype);
+    result<T> res(impl_->execute(stmt), prototype);
+    schema_changed(stmt);
+    return res;
   }
 
   /**
@@ -209,22 +348,34 @@ private:
   template < class T >
   result<T> execute(const sql &stmt, typename std::enable_if< !std::is_same<T, row>::value >::type* = 0)
   {
-    return result<T>(impl_->execute(stmt));
+    result<T> res(impl_->execute(stmt));
+    schema_changed(stmt);
+    return res;
   }
 
   template < class T >
   statement<T> prepare(const matador::sql &sql, typename std::enable_if< !std::is_same<T, row>::value >::type* = 0)
   {
-    return statement<T>(impl_->prepare(sql));
+    schema_changed(sql);
+    return statement<T>(prepare_statement(sql));
   }
 
   template < class T >
   statement<T> prepare(const matador::sql &sql, const std::string &tablename, row prototype, typename std::enable_if< std::is_same<T, row>::value >::type* = 0)
   {
     prepare_prototype_row(prototype, tablename);
-    return statement<T>(impl_->prepare(sql), prototype);
+    schema_changed(sql);
+    return statement<T>(prepare_statement(sql), prototype);
   }
 
+  detail::statement_impl* prepare_statement(const matador::sql &sql);
+  void drop_cache();
+
+  const std::vector<field>* describe_cached(const std::string &tablename);
+  void schema_changed(const matador::sql &stmt);
+  void schema_changed(const std::string &stmt);
+  void increment_schema_generation();
+
 private:
   connection_impl* create_connection(const std::string &type) const;
   void init_from_foreign_connection(const connection &foreign_connection);
@@ -234,6 +385,14 @@ private:
   std::string type_;
   std::string dns_;
   std::unique_ptr<connection_impl> impl_;
+  std::shared_ptr<detail::statement_cache> cache_;
+  bool stream_results_ = false;
+  // field descriptions of existing tables by table name
+  std::unordered_map<std::string, std::vector<field>> schema_cache_;
+  // incremented by every connection changing the schema
+  t_schema_generation schema_generation_;
+  // the generation the cached descriptions belong to
+  std::size_t schema_cache_generation_ = 0;
 };
 
 }
@@ -60,6 +60,16 @@ public:
   virtual std::vector<field> describe(const std::string &table) = 0;
 
   virtual basic_dialect* dialect() = 0;
+
+  /**
+   * Enables or disables unbuffered results. Backends
+   * which read the rows on demand anyway ignore it.
+   */
+  void stream_results(bool enable) { stream_results_ = enable; }
+  bool streams_results() const { return stream_results_; }
+
+private:
+  bool stream_results_ = false;
 };
 
 /// @endcond
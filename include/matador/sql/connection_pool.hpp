@@ -0,0 +1,317 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_CONNECTION_POOL_HPP
+#define OOS_CONNECTION_POOL_HPP
+
+#ifdef _MSC_VER
+#ifdef matador_sql_EXPORTS
+    #define OOS_SQL_API __declspec(dllexport)
+    #define EXPIMP_SQL_TEMPLATE
+  #else
+    #define OOS_SQL_API __declspec(dllimport)
+    #define EXPIMP_SQL_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+#define OOS_SQL_API
+#endif
+
+#include "matador/sql/connection.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace matador {
+
+class connection_pool;
+
+/**
+ * @brief Represents a leased connection of a connection pool
+ *
+ * A connection lease holds a connection acquired
+ * from a connection_pool. Once the lease is destroyed
+ * or released the connection is given back to the pool.
+ *
+ * A lease can't be copied but moved.
+ */
+class OOS_SQL_API connection_lease
+{
+public:
+  /**
+   * @brief Creates an empty lease
+   */
+  connection_lease() = default;
+
+  connection_lease(const connection_lease &) = delete;
+  connection_lease& operator=(const connection_lease &) = delete;
+
+  /**
+   * @brief Moves the lease from x
+   *
+   * @param x The lease to move
+   */
+  connection_lease(connection_lease &&x) noexcept;
+
+  /**
+   * @brief Moves the lease from x
+   *
+   * If this lease holds a connection
+   * it is given back to its pool first.
+   *
+   * @param x The lease to move
+   * @return Reference to this lease
+   */
+  connection_lease& operator=(connection_lease &&x) noexcept;
+
+  /**
+   * @brief Gives the connection back to the pool
+   */
+  ~connection_lease();
+
+  /**
+   * @brief Gives the connection back to the pool
+   *
+   * After release the lease is empty.
+   */
+  void release();
+
+  /**
+   * @brief Returns the leased connection
+   *
+   * @return The leased connection
+   */
+  connection* get() const;
+
+  /**
+   * @brief Returns the leased connection
+   *
+   * @return The leased connection
+   */
+  connection* operator->() const;
+
+  /**
+   * @brief Returns the leased connection
+   *
+   * @return The leased connection
+   */
+  connection& operator*() const;
+
+  /**
+   * @brief Returns true if the lease holds a connection
+   *
+   * @return True if the lease holds a connection
+   */
+  explicit operator bool() const;
+
+private:
+  friend class connection_pool;
+
+  connection_lease(connection_pool *pool, connection *conn);
+
+private:
+  connection_pool *pool_ = nullptr;
+  connection *conn_ = nullptr;
+};
+
+/**
+ * @brief A thread safe pool of database connections
+ *
+ * The connection pool holds between min_size and
+ * max_size open connections to one database. Each
+ * connection has its own connection implementation
+ * and therefor its own sql dialect and its own
+ * prepared statements.
+ *
+ * A connection is acquired as a connection_lease. If
+ * all connections are in use and the pool has reached
+ * its maximum size acquire blocks until a connection
+ * is given back.
+ *
+ * On checkout a connection is checked for health. A
+ * broken connection is reopened. Idle connections which
+ * weren't used longer than the idle timeout are closed
+ * as long as the pool holds more than min_size connections.
+ * Before a connection is closed all registered close
+ * callbacks are called with the connection.
+ *
+ * All connections of the pool share one schema
+ * generation. A schema change executed by one connection
+ * drops the cached table descriptions of all others.
+ */
+class OOS_SQL_API connection_pool
+{
+public:
+  typedef std::chrono::steady_clock clock;                 /**< Shortcut to the clock type */
+  typedef std::function<void(connection&)> t_close_callback; /**< Shortcut to the close callback */
+
+  /**
+   * @brief Creates a new connection pool
+   *
+   * Creates a new connection pool for the given
+   * database connection string. The minimum count
+   * of connections is opened immediately.
+   *
+   * @param dns The database connection string
+   * @param min_size The minimum count of open connections
+   * @param max_size The maximum count of open connections
+   * @param idle_timeout The time after an idle connection is closed
+   */
+  connection_pool(const std::string &dns, std::size_t min_size, std::size_t max_size,
+                  std::chrono::seconds idle_timeout = std::chrono::seconds(60));
+
+  connection_pool(const connection_pool &) = delete;
+  connection_pool& operator=(const connection_pool &) = delete;
+
+  /**
+   * @brief Closes all connections
+   *
+   * All leases must be given back before the
+   * pool is destroyed. Close callbacks aren't
+   * called on destruction.
+   */
+  ~connection_pool();
+
+  /**
+   * @brief Acquires a connection from the pool
+   *
+   * Returns a lease of an idle and healthy connection.
+   * If there is no idle connection a new one is opened
+   * as long as the pool hasn't reached its maximum size.
+   * Otherwise the call blocks until a connection is
+   * given back.
+   *
+   * @return A lease holding the connection
+   */
+  connection_lease acquire();
+
+  /**
+   * @brief Acquires a connection from the pool without blocking
+   *
+   * Like acquire() but if there is neither an idle
+   * connection nor room for a new one an empty lease
+   * is returned instead of waiting.
+   *
+   * @return A lease holding the connection or an empty lease
+   */
+  connection_lease try_acquire();
+
+  /**
+   * @brief Closes all idle connections exceeding the idle timeout
+   *
+   * Closes all idle connections which weren't used longer than
+   * the idle timeout as long as the pool holds more than
+   * the minimum count of connections.
+   */
+  void shrink();
+
+  /**
+   * @brief Registers a callback called before a connection is closed
+   *
+   * The callbacks are called without holding
+   * the lock of the pool.
+   *
+   * @param callback The callback to register
+   */
+  void on_close(const t_close_callback &callback);
+
+  /**
+   * @brief Returns the count of open connections
+   *
+   * @return The count of open connections
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Returns the count of idle connections
+   *
+   * @return The count of idle connections
+   */
+  std::size_t idle() const;
+
+  /**
+   * @brief Returns the minimum count of connections
+   *
+   * @return The minimum count of connections
+   */
+  std::size_t min_size() const;
+
+  /**
+   * @brief Returns the maximum count of connections
+   *
+   * @return The maximum count of connections
+   */
+  std::size_t max_size() const;
+
+  /**
+   * @brief Returns the idle timeout
+   *
+   * @return The idle timeout
+   */
+  std::chrono::seconds idle_timeout() const;
+
+  /**
+   * @brief Returns the database connection string
+   *
+   * @return The database connection string
+   */
+  std::string dns() const;
+
+  /**
+   * @brief Returns the schema generation shared by all connections
+   *
+   * @return The shared schema generation
+   */
+  connection::t_schema_generation schema_generation() const;
+
+private:
+  friend class connection_lease;
+
+  struct idle_connection
+  {
+    connection *conn;
+    clock::time_point last_used;
+  };
+
+  void release(connection *conn);
+  connection_lease lease(std::unique_lock<std::mutex> &lock);
+
+  std::unique_ptr<connection> open_connection() const;
+  bool is_healthy(connection &conn) const;
+  connection* check(connection *conn);
+
+  typedef std::vector<std::unique_ptr<connection>> t_connection_vector;
+
+  void close_expired();
+  t_connection_vector take_expired(clock::time_point now);
+  std::unique_ptr<connection> take(connection *conn);
+  void close(connection *conn);
+  void notify_close(connection &conn);
+
+private:
+  std::string dns_;
+  std::size_t min_size_ = 0;
+  std::size_t max_size_ = 0;
+  std::chrono::seconds idle_timeout_;
+  connection::t_schema_generation schema_generation_;
+
+  t_connection_vector connections_;
+  std::vector<idle_connection> idle_;
+  // count of connections being opened
+  std::size_t pending_ = 0;
+
+  std::vector<t_close_callback> close_callbacks_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable available_;
+};
+
+}
+
+#endif //OOS_CONNECTION_POOL_HPP
@@ -132,6 +132,9 @@ struct OOS_SQL_API values : public token
   }
 
   std::vector<std::shared_ptr<basic_value>> values_;
+  // number of value rows; rows greater one
+  // repeat the values for multi row inserts
+  std::size_t rows = 1;
 };
 
 struct OOS_SQL_API asc : public token
@@ -211,6 +214,37 @@ struct OOS_SQL_API where : public token
   std::shared_ptr<basic_condition> cond;
 };
 
+struct OOS_SQL_API join : public token
+{
+  /**
+   * Creates a join of the given table. The
+   * join type must be either JOIN or LEFT_JOIN.
+   */
+  join(const std::string &t, t_token join_type = JOIN);
+
+  virtual void accept(token_visitor &visitor) override;
+
+  std::string table;
+};
+
+struct OOS_SQL_API on : public token
+{
+  template < class COND >
+  explicit on(const COND &c)
+    : token(token::ON)
+    , cond(new COND(c))
+  { }
+
+  on(const std::shared_ptr<basic_condition> &c)
+    : token(token::ON)
+    , cond(c)
+  { }
+
+  virtual void accept(token_visitor &visitor) override;
+
+  std::shared_ptr<basic_condition> cond;
+};
+
 /// @endcond
 
 }
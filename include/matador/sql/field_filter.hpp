@@ -0,0 +1,77 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_FIELD_FILTER_HPP
+#define OOS_FIELD_FILTER_HPP
+
+#ifdef _MSC_VER
+#ifdef matador_sql_EXPORTS
+    #define OOS_SQL_API __declspec(dllexport)
+    #define EXPIMP_SQL_TEMPLATE
+  #else
+    #define OOS_SQL_API __declspec(dllimport)
+    #define EXPIMP_SQL_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+  #pragma warning(disable: 4355)
+#else
+#define OOS_SQL_API
+#endif
+
+#include "matador/utils/serializer.hpp"
+
+#include <vector>
+
+namespace matador {
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Passes only the selected fields of an object
+ * on to another serializer. The fields are
+ * numbered like the columns of the object,
+ * identifiers and relations to single objects
+ * count as one field each.
+ */
+class OOS_SQL_API field_filter : public serializer
+{
+public:
+  field_filter(serializer &target, const std::vector<bool> &fields);
+
+  void serialize(const char *id, char &x) override;
+  void serialize(const char *id, short &x) override;
+  void serialize(const char *id, int &x) override;
+  void serialize(const char *id, long &x) override;
+  void serialize(const char *id, unsigned char &x) override;
+  void serialize(const char *id, unsigned short &x) override;
+  void serialize(const char *id, unsigned int &x) override;
+  void serialize(const char *id, unsigned long &x) override;
+  void serialize(const char *id, bool &x) override;
+  void serialize(const char *id, float &x) override;
+  void serialize(const char *id, double &x) override;
+  void serialize(const char *id, char *x, size_t s) override;
+  void serialize(const char *id, std::string &x) override;
+  void serialize(const char *id, varchar_base &x) override;
+  void serialize(const char *id, time &x) override;
+  void serialize(const char *id, date &x) override;
+  void serialize(const char *id, basic_identifier &x) override;
+  void serialize(const char *id, identifiable_holder &x, cascade_type cascade) override;
+
+private:
+  bool selected();
+
+private:
+  serializer &target_;
+  const std::vector<bool> &fields_;
+  std::size_t index_ = 0;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_FIELD_FILTER_HPP
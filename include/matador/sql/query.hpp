@@ -246,6 +246,29 @@ public:
     return *this;
   }
 
+  /**
+   * Creates a select statement for the given columns.
+   * The columns must match the fields of the object
+   * type in count and order.
+   *
+   * @param cols The columns to select
+   * @return A reference to the query.
+   */
+  query& select(const columns &cols)
+  {
+    reset(t_query_command::SELECT);
+
+    throw_invalid(QUERY_SELECT, state);
+    sql_.append(new detail::select);
+
+    sql_.append(new columns(cols));
+
+    sql_.append(new detail::from(table_name_));
+
+    state = QUERY_FROM;
+    return *this;
+  }
+
   /**
    * Creates an insert statement
    *
@@ -260,10 +283,16 @@ public:
    * Creates an insert statement based
    * on the given object.
    *
+   * If rows is greater than one the values
+   * are repeated for each row, resulting in a
+   * multi row insert. This only makes sense
+   * if the query will be prepared afterwards.
+   *
    * @param obj The serializable used for the insert statement.
+   * @param rows The number of rows to insert.
    * @return A reference to the query.
    */
-  query& insert(T &obj)
+  query& insert(T &obj, std::size_t rows = 1)
   {
     reset(t_query_command::INSERT);
 
@@ -278,6 +307,7 @@ public:
     detail::value_serializer vserializer;
 
     std::unique_ptr<detail::values> vals(vserializer.execute(obj));
+    vals->rows = rows;
 
     sql_.append(vals.release());
 
@@ -328,6 +358,49 @@ public:
     return *this;
   }
 
+  /**
+   * Creates an update statement without
+   * any settings. Sets column and values only
+   * for the selected attributes of the
+   * internal object.
+   *
+   * @param fields The selected attributes
+   * @return A reference to the query.
+   */
+  query& update(const std::vector<bool> &fields)
+  {
+    return update(obj_, fields);
+  }
+
+  /**
+   * Creates an update statement without
+   * any settings. Sets column and values only
+   * for the selected object attributes.
+   *
+   * @param obj The object to be updated.
+   * @param fields The selected attributes
+   * @return A reference to the query.
+   */
+  query& update(T &obj, const std::vector<bool> &fields)
+  {
+    reset(t_query_command::UPDATE);
+
+    sql_.append(new detail::update);
+    sql_.append(new detail::tablename(table_name_));
+    sql_.append(new detail::set);
+    sql_.append(update_columns_);
+
+    state = QUERY_UPDATE;
+
+    detail::value_column_serializer vcserializer;
+
+    vcserializer.append_to(update_columns_, obj, fields);
+
+    state = QUERY_SET;
+
+    return *this;
+  }
+
   /**
    * Creates an update statement without
    * any settings. Sets for all column value pairs
@@ -387,6 +460,67 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Adds a join of the given table to the query
+   *
+   * Adds an inner join of the given table to a
+   * select statement. The join condition must be
+   * added with on().
+   *
+   * @param table The name of the table to join
+   * @return A reference to the query.
+   */
+  query& join(const std::string &table)
+  {
+    throw_invalid(QUERY_JOIN, state);
+
+    sql_.append(new detail::join(table));
+
+    state = QUERY_JOIN;
+    return *this;
+  }
+
+  /**
+   * @brief Adds a left join of the given table to the query
+   *
+   * Adds a left outer join of the given table to a
+   * select statement. The join condition must be
+   * added with on().
+   *
+   * @param table The name of the table to join
+   * @return A reference to the query.
+   */
+  query& left_join(const std::string &table)
+  {
+    throw_invalid(QUERY_JOIN, state);
+
+    sql_.append(new detail::join(table, detail::token::LEFT_JOIN));
+
+    state = QUERY_JOIN;
+    return *this;
+  }
+
+  /**
+   * @brief Adds the condition of the last join to the query.
+   *
+   * Columns of the joined tables are
+   * qualified with their table name
+   * (i.e. column("table.column")).
+   *
+   * @param c The join condition.
+   * @return A reference to the query.
+   */
+  template < class COND >
+  query& on(const COND &c)
+  {
+    throw_invalid(QUERY_ON, state);
+
+    sql_.append(new detail::on(c));
+
+    state = QUERY_ON;
+    return *this;
+  }
+
   /**
    * Adds a where clause condition to the select or
    * update statement. For any other query an
@@ -828,6 +962,7 @@ public:
 
     table_name_ = table;
 
+    state = QUERY_FROM;
     return *this;
   }
 
@@ -850,6 +985,67 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Adds a join of the given table to the query
+   *
+   * Adds an inner join of the given table to a
+   * select statement. The join condition must be
+   * added with on().
+   *
+   * @param table The name of the table to join
+   * @return A reference to the query.
+   */
+  query& join(const std::string &table)
+  {
+    throw_invalid(QUERY_JOIN, state);
+
+    sql_.append(new detail::join(table));
+
+    state = QUERY_JOIN;
+    return *this;
+  }
+
+  /**
+   * @brief Adds a left join of the given table to the query
+   *
+   * Adds a left outer join of the given table to a
+   * select statement. The join condition must be
+   * added with on().
+   *
+   * @param table The name of the table to join
+   * @return A reference to the query.
+   */
+  query& left_join(const std::string &table)
+  {
+    throw_invalid(QUERY_JOIN, state);
+
+    sql_.append(new detail::join(table, detail::token::LEFT_JOIN));
+
+    state = QUERY_JOIN;
+    return *this;
+  }
+
+  /**
+   * @brief Adds the condition of the last join to the query.
+   *
+   * Columns of the joined tables are
+   * qualified with their table name
+   * (i.e. column("table.column")).
+   *
+   * @param c The join condition.
+   * @return A reference to the query.
+   */
+  template < class COND >
+  query& on(const COND &c)
+  {
+    throw_invalid(QUERY_ON, state);
+
+    sql_.append(new detail::on(c));
+
+    state = QUERY_ON;
+    return *this;
+  }
+
   /**
    * @brief Adds a where clause condition to the query.
    *
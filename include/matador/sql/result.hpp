@@ -25,6 +25,7 @@
 #include <type_traits>
 #include <iterator>
 #include <functional>
+#include <vector>
 
 namespace matador {
 
@@ -127,6 +128,35 @@ public:
   self operator++(int);
 };
 
+namespace detail {
+
+/*
+ * Fetches the rows of the result into the
+ * objects of the batch and calls the function
+ * each time the batch is filled.
+ */
+template < class R, class V, class Func >
+std::size_t fetch_batches(R &res, V &batch, Func &func)
+{
+  std::size_t count = 0;
+  std::size_t total = 0;
+  while (res.fetch(batch[count])) {
+    if (++count == batch.size()) {
+      func(static_cast<const V&>(batch));
+      total += count;
+      count = 0;
+    }
+  }
+  if (count > 0) {
+    batch.resize(count);
+    func(static_cast<const V&>(batch));
+    total += count;
+  }
+  return total;
+}
+
+}
+
 /// @endcond
 
 /**
@@ -144,6 +174,7 @@ class result
 {
 public:
   typedef std::function<T*()> t_creator_func; /**< Shortcut to a creator function for the object type */
+  typedef std::function<void(T*)> t_destroyer_func; /**< Shortcut to a destroyer function for the object type */
   typedef result_iterator<T> iterator;        /**< Shortcut to the iterator type */
 
   result(const result &x) = delete;
@@ -254,6 +285,78 @@ public:
     creator_func_ = creator_func;
   }
 
+  /**
+   * Sets a destroyer function to destroy
+   * objects created by a custom creator
+   * function which couldn't be fetched
+   *
+   * @param destroyer_func The custom destroyer function
+   */
+  void destroyer(const t_destroyer_func &destroyer_func)
+  {
+    destroyer_func_ = destroyer_func;
+  }
+
+  /**
+   * Fetches the next row of the result set
+   * into the given object. The fields of the
+   * object are overwritten with the values of
+   * the row.
+   *
+   * @param obj The object to fetch into
+   * @return True if a row was fetched
+   */
+  bool fetch(T &obj)
+  {
+    p->bind(&obj);
+    return p->fetch(&obj);
+  }
+
+  /**
+   * Calls the given function for each remaining
+   * row of the result set. All rows are fetched
+   * into one object created once with the creator
+   * function, therefore the object passed to the
+   * function is only valid until the function
+   * returns.
+   *
+   * @tparam Func Type of the function
+   * @param func Function called with a const reference of each object
+   * @return The number of fetched rows
+   */
+  template < class Func >
+  std::size_t for_each(Func func)
+  {
+    std::unique_ptr<T, t_destroyer_func> obj(create(), [this](T *o) { destroy(o); });
+    std::size_t count = 0;
+    while (fetch(*obj)) {
+      ++count;
+      func(static_cast<const T&>(*obj));
+    }
+    return count;
+  }
+
+  /**
+   * Calls the given function with the remaining
+   * rows of the result set in batches of up to
+   * the given size. The objects of the batch are
+   * default constructed once and reused for all
+   * batches, i.e. they are overwritten once the
+   * function returns. Only the last batch may hold
+   * fewer objects.
+   *
+   * @tparam Func Type of the function
+   * @param size The maximum number of objects per batch
+   * @param func Function called with a const reference of each batch vector
+   * @return The number of fetched rows
+   */
+  template < class Func >
+  std::size_t for_each_batch(std::size_t size, Func func)
+  {
+    std::vector<T> batch(size > 0 ? size : 1);
+    return detail::fetch_batches(*this, batch, func);
+  }
+
 private:
   friend class result_iterator<T>;
 
@@ -267,9 +370,20 @@ private:
       return new T;
     }
   }
+
+  void destroy(T *obj) const
+  {
+    if (destroyer_func_) {
+      destroyer_func_(obj);
+    } else {
+      delete obj;
+    }
+  }
+
 private:
   matador::detail::result_impl *p = nullptr;
   t_creator_func creator_func_;
+  t_destroyer_func destroyer_func_;
 };
 
 /**
@@ -387,6 +501,63 @@ public:
     return p->result_rows();
   }
 
+  /**
+   * Fetches the next row of the result set
+   * into the given row. The row must contain
+   * the columns of the result.
+   *
+   * @param r The row to fetch into
+   * @return True if a row was fetched
+   */
+  bool fetch(row &r)
+  {
+    p->bind(&r);
+    return p->fetch(&r);
+  }
+
+  /**
+   * Calls the given function for each remaining
+   * row of the result set. All rows are fetched
+   * into one row, therefore the row passed to the
+   * function is only valid until the function
+   * returns.
+   *
+   * @tparam Func Type of the function
+   * @param func Function called with a const reference of each row
+   * @return The number of fetched rows
+   */
+  template < class Func >
+  std::size_t for_each(Func func)
+  {
+    row r(prototype_);
+    std::size_t count = 0;
+    while (fetch(r)) {
+      ++count;
+      func(static_cast<const row&>(r));
+    }
+    return count;
+  }
+
+  /**
+   * Calls the given function with the remaining
+   * rows of the result set in batches of up to
+   * the given size. The rows of the batch are
+   * reused for all batches, i.e. they are
+   * overwritten once the function returns. Only
+   * the last batch may hold fewer rows.
+   *
+   * @tparam Func Type of the function
+   * @param size The maximum number of rows per batch
+   * @param func Function called with a const reference of each batch vector
+   * @return The number of fetched rows
+   */
+  template < class Func >
+  std::size_t for_each_batch(std::size_t size, Func func)
+  {
+    std::vector<row> batch(size > 0 ? size : 1, prototype_);
+    return detail::fetch_batches(*this, batch, func);
+  }
+
 private:
   friend class result_iterator<row>;
 
@@ -396,6 +567,11 @@ private:
   {
     return new row(prototype_);
   }
+
+  void destroy(row *r) const
+  {
+    delete r;
+  }
 private:
   matador::detail::result_impl *p = nullptr;
   const row prototype_;
@@ -408,7 +584,7 @@ typename result_iterator<T>::self &result_iterator<T>::operator++()
   base::obj_.reset(base::result_->create());
   base::result_->p->bind(base::obj_.get());
   if (!base::result_->p->fetch(base::obj_.get())) {
-    base::obj_.reset();
+    base::result_->destroy(base::obj_.release());
   }
   return *this;
 }
@@ -32,15 +32,66 @@
 #endif
 
 #include "matador/sql/value.hpp"
+#include "matador/sql/row_value.hpp"
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
 namespace matador {
 
+namespace detail {
+
+/**
+ * @brief The columns of a row
+ *
+ * Holds the column names of a row and their
+ * index. The schema is shared between a row
+ * and all its copies, i.e. all rows of a
+ * result, and copied on change.
+ */
+class OOS_SQL_API row_schema
+{
+public:
+  /**
+   * Adds a column to the schema
+   *
+   * @param column Name of the column
+   * @return True if the column was added, false if it already exists
+   */
+  bool add(const std::string &column);
+
+  bool has(const std::string &column) const;
+
+  /**
+   * Returns the index of the given column
+   *
+   * @throw std::out_of_range if there is no such column
+   * @param column Name of the column
+   * @return Index of the column
+   */
+  std::size_t index_of(const std::string &column) const;
+
+  const std::string& column(std::size_t index) const;
+
+  std::size_t size() const;
+
+private:
+  std::vector<std::string> columns_;
+  std::unordered_map<std::string, std::size_t> indices_;
+};
+
+}
+
 /**
  * @brief Row representation
+ *
+ * The values of a row are kept by column index
+ * with inline storage. The column names are kept
+ * in a schema shared with all copies of the row,
+ * so copying a row of a result doesn't copy or
+ * hash any column name.
  */
 class OOS_SQL_API row
 {
@@ -74,6 +125,34 @@ public:
    */
   bool has_column(const std::string &column) const;
 
+  /**
+   * @brief Returns the index of the column with given name
+   *
+   * The index can be resolved once and used
+   * for all rows of a result.
+   *
+   * @throw out_of_range exception
+   * @param column The name of the column
+   * @return The index of the column
+   */
+  std::size_t index_of(const std::string &column) const;
+
+  /**
+   * @brief Returns the name of the column at the given index
+   *
+   * @throw out_of_range exception
+   * @param index The index of the column
+   * @return The name of the column
+   */
+  const std::string& column(std::size_t index) const;
+
+  /**
+   * @brief Returns the number of columns
+   *
+   * @return The number of columns
+   */
+  std::size_t size() const;
+
   /**
    * @brief Serializes the row with the given serializer
    *
@@ -83,8 +162,8 @@ public:
   template < class SERIALIZER >
   void serialize(SERIALIZER &serializer)
   {
-    for (auto &&column : columns_) {
-      values_.at(column)->serialize(column.c_str(), serializer);
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      values_[i].serialize(schema_->column(i).c_str(), serializer);
     }
   }
 
@@ -101,7 +180,7 @@ public:
   template < class T >
   void set(size_t index, const T &val)
   {
-    values_.at(columns_.at(index)).reset(new value<T>(val));
+    values_.at(index).assign(val);
   }
 
   /**
@@ -117,7 +196,7 @@ public:
   template < class T >
   void set(const std::string &column, const T &val)
   {
-    values_.at(column).reset(new value<T>(val));
+    values_[index_of(column)].assign(val);
   }
 
   /**
@@ -136,9 +215,9 @@ public:
    * @return The value of the requested column.
    */
   template < class T >
-  T at(size_t pos)
+  T at(size_t pos) const
   {
-    return values_.at(columns_.at(pos))->get<T>();
+    return values_.at(pos).get<T>();
   }
 
   /**
@@ -149,9 +228,9 @@ public:
    * @return The value of the requested column.
    */
   template < class T >
-  T at(const std::string &column)
+  T at(const std::string &column) const
   {
-    return values_.at(column)->get<T>();
+    return values_[index_of(column)].get<T>();
   }
 
   /**
@@ -162,7 +241,7 @@ public:
    */
   std::string str(size_t pos)
   {
-    return values_.at(columns_.at(pos))->str();
+    return values_.at(pos).str();
   }
 
   /**
@@ -173,7 +252,7 @@ public:
    */
   std::string str(const std::string &column)
   {
-    return values_.at(column)->str();
+    return values_[index_of(column)].str();
   }
 
   /**
@@ -184,16 +263,8 @@ public:
   void clear();
 
 private:
-
-//  std::vector<detail::basic_value> values_;
-
-  typedef std::shared_ptr<detail::basic_value> value_ptr;
-  typedef std::vector<std::string> t_columns;
-  typedef std::unordered_map<std::string, value_ptr> t_values;
-
-  t_columns columns_;
-  t_values values_;
-
+  std::shared_ptr<detail::row_schema> schema_;
+  std::vector<detail::row_value> values_;
 };
 /// @endcond
 
@@ -0,0 +1,154 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_ROW_VALUE_HPP
+#define OOS_ROW_VALUE_HPP
+
+#ifdef _MSC_VER
+  #ifdef matador_sql_EXPORTS
+    #define OOS_SQL_API __declspec(dllexport)
+    #define EXPIMP_SQL_TEMPLATE
+  #else
+    #define OOS_SQL_API __declspec(dllimport)
+    #define EXPIMP_SQL_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+  #define OOS_SQL_API
+#endif
+
+#include "matador/sql/types.hpp"
+
+#include "matador/utils/varchar.hpp"
+#include "matador/utils/date.hpp"
+#include "matador/utils/time.hpp"
+#include "matador/utils/serializer.hpp"
+
+#include <string>
+#include <typeinfo>
+
+namespace matador {
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * A single value of a row. The value is stored
+ * inline in a union tagged with its data type,
+ * so that the values of a row can be held in one
+ * contiguous block without an allocation per value.
+ *
+ * A value is read with the type it was set with,
+ * text and varchar values can be read as each other.
+ * Reading any other type throws std::bad_cast.
+ */
+class OOS_SQL_API row_value
+{
+public:
+  row_value();
+  ~row_value();
+
+  row_value(const row_value &x);
+  row_value(row_value &&x) noexcept;
+  row_value& operator=(const row_value &x);
+  row_value& operator=(row_value &&x) noexcept;
+
+  data_type type() const;
+  bool is_null() const;
+
+  void assign(char x);
+  void assign(short x);
+  void assign(int x);
+  void assign(long x);
+  void assign(unsigned char x);
+  void assign(unsigned short x);
+  void assign(unsigned int x);
+  void assign(unsigned long x);
+  void assign(bool x);
+  void assign(float x);
+  void assign(double x);
+  void assign(const char *x);
+  void assign(const std::string &x);
+  void assign(const varchar_base &x);
+  void assign(const date &x);
+  void assign(const time &x);
+
+  /**
+   * Resets the value to null
+   */
+  void clear();
+
+  template < class T >
+  T get() const
+  {
+    T val{};
+    get(val);
+    return val;
+  }
+
+  /**
+   * Serializes the value with the given serializer. A
+   * null value is serialized as text, i.e. the value
+   * is read as text from a result.
+   */
+  void serialize(const char *id, serializer &srlzr);
+
+  std::string str() const;
+
+private:
+  void get(char &x) const;
+  void get(short &x) const;
+  void get(int &x) const;
+  void get(long &x) const;
+  void get(unsigned char &x) const;
+  void get(unsigned short &x) const;
+  void get(unsigned int &x) const;
+  void get(unsigned long &x) const;
+  void get(bool &x) const;
+  void get(float &x) const;
+  void get(double &x) const;
+  void get(const char *&x) const;
+  void get(std::string &x) const;
+  void get(varchar_base &x) const;
+  void get(date &x) const;
+  void get(time &x) const;
+
+  void check(data_type type) const;
+  bool is_text() const;
+
+  void copy(const row_value &x);
+  void move(row_value &&x) noexcept;
+  // destroys a non trivial value
+  void reset(data_type type);
+
+private:
+  data_type type_ = data_type::type_null;
+
+  union
+  {
+    char char_;
+    short short_;
+    int int_;
+    long long_;
+    unsigned char unsigned_char_;
+    unsigned short unsigned_short_;
+    unsigned int unsigned_int_;
+    unsigned long unsigned_long_;
+    bool bool_;
+    float float_;
+    double double_;
+    std::string text_;
+    varchar_base varchar_;
+    date date_;
+    time time_;
+  };
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_ROW_VALUE_HPP
@@ -51,6 +51,7 @@ namespace detail {
 
 class basic_dialect_compiler;
 class basic_dialect_linker;
+class token_structure;
 struct build_info;
 
 }
@@ -67,6 +68,13 @@ public:
 
   void reset(t_query_command command_type);
 
+  /**
+   * Returns the command type of the sql statement
+   *
+   * @return The command type of the sql statement
+   */
+  t_query_command command() const;
+
   static unsigned int type_size(data_type type);
 
   template < class T >
@@ -80,6 +88,7 @@ private:
   friend struct detail::build_info;
   friend class detail::basic_dialect_compiler;
   friend class detail::basic_dialect_linker;
+  friend class detail::token_structure;
   template < class L, class R, class E >
   friend class condition;
 
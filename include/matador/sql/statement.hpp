@@ -19,10 +19,12 @@
 #define STATEMENT_HPP
 
 #include "matador/sql/statement_impl.hpp"
+#include "matador/sql/statement_cache.hpp"
 #include "matador/sql/result.hpp"
 
 #include <string>
 #include <functional>
+#include <vector>
 
 namespace matador {
 
@@ -67,7 +69,7 @@ public:
   ~statement()
   {
     if (p) {
-      delete p;
+      detail::statement_cache::release(p);
     }
   }
 
@@ -90,7 +92,7 @@ public:
   statement& operator=(statement &&x)
   {
     if (p) {
-      delete p;
+      detail::statement_cache::release(p);
       p = nullptr;
     }
     std::swap(p, x.p);
@@ -104,6 +106,8 @@ public:
   {
     if (p) {
       p->clear();
+      // a cleared statement can't be reused
+      detail::statement_cache::detach(p);
     }
   }
 
@@ -128,6 +132,18 @@ public:
   {
     p->reset();
   }
+
+  /**
+   * Enables or disables streaming of the results
+   * of this statement. The default is taken from
+   * the connection, see connection::stream_results().
+   *
+   * @param enable True to stream results
+   */
+  void stream_results(bool enable)
+  {
+    p->stream_results(enable);
+  }
   
   /**
    * Bind an object to the statement starting
@@ -142,6 +158,36 @@ public:
     return p->bind(obj, index);
   }
 
+  /**
+   * Bind the selected fields of an object to
+   * the statement starting at the given
+   * position index.
+   *
+   * @param index The index where to start the binding
+   * @param obj The object to bind
+   * @param fields The fields to bind
+   * @return The next index to bind
+   */
+  std::size_t bind(std::size_t index, T *obj, const std::vector<bool> &fields)
+  {
+    return p->bind(obj, index, fields);
+  }
+
+  /**
+   * Bind an object to the statement starting
+   * at the given position index without resetting
+   * the statement. This way several objects can
+   * be bound to one statement (i.e. a multi row insert).
+   *
+   * @param index The index where to start the binding
+   * @param obj The object to bind
+   * @return The next index to bind
+   */
+  std::size_t append(std::size_t index, T *obj)
+  {
+    return p->append(obj, index);
+  }
+
   /**
    * Bind single value to a specified
    * position index of the prepared statement
@@ -205,7 +251,7 @@ public:
   ~statement()
   {
     if (p) {
-      delete p;
+      detail::statement_cache::release(p);
     }
   }
 
@@ -228,7 +274,7 @@ public:
   statement& operator=(statement &&x)
   {
     if (p) {
-      delete p;
+      detail::statement_cache::release(p);
       p = nullptr;
     }
     std::swap(p, x.p);
@@ -242,6 +288,8 @@ public:
   {
     if (p) {
       p->clear();
+      // a cleared statement can't be reused
+      detail::statement_cache::detach(p);
     }
   }
 
@@ -267,6 +315,18 @@ public:
     p->reset();
   }
 
+  /**
+   * Enables or disables streaming of the results
+   * of this statement. The default is taken from
+   * the connection, see connection::stream_results().
+   *
+   * @param enable True to stream results
+   */
+  void stream_results(bool enable)
+  {
+    p->stream_results(enable);
+  }
+
   /**
    * Bind single value to a specified
    * position index of the prepared statement
@@ -0,0 +1,123 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_STATEMENT_CACHE_HPP
+#define OOS_STATEMENT_CACHE_HPP
+
+#ifdef _MSC_VER
+#ifdef matador_sql_EXPORTS
+    #define OOS_SQL_API __declspec(dllexport)
+    #define EXPIMP_SQL_TEMPLATE
+  #else
+    #define OOS_SQL_API __declspec(dllimport)
+    #define EXPIMP_SQL_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+#define OOS_SQL_API
+#endif
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace matador {
+
+namespace detail {
+
+class statement_impl;
+
+/// @cond MATADOR_DEV
+
+/**
+ * A least recently used cache of idle prepared
+ * statement implementations of one connection. The
+ * statements are keyed by their linked sql string.
+ *
+ * A statement acquired from the cache is owned by
+ * its statement object until it is released. On
+ * release it is reset and given back to the cache
+ * as long as the cache is alive. If the cache
+ * exceeds its capacity the least recently used
+ * idle statement is deleted.
+ */
+class OOS_SQL_API statement_cache : public std::enable_shared_from_this<statement_cache>
+{
+public:
+  explicit statement_cache(std::size_t capacity);
+  ~statement_cache();
+
+  statement_cache(const statement_cache&) = delete;
+  statement_cache& operator=(const statement_cache&) = delete;
+
+  /**
+   * Returns a reset idle statement for the given
+   * sql string or nullptr if there is none. Counts
+   * a hit or a miss.
+   */
+  statement_impl* acquire(const std::string &sql);
+
+  /**
+   * Attaches a newly prepared statement to
+   * the cache. Once the statement is released
+   * it is given back to this cache.
+   */
+  void attach(statement_impl *stmt);
+
+  void capacity(std::size_t capacity);
+  std::size_t capacity() const;
+
+  std::size_t size() const;
+  std::size_t hits() const;
+  std::size_t misses() const;
+
+  /**
+   * Deletes all idle statements
+   */
+  void clear();
+
+  /**
+   * Gives the statement back to its cache
+   * or deletes it if it isn't attached to
+   * a cache or the cache is gone.
+   */
+  static void release(statement_impl *stmt);
+
+  /**
+   * Detaches the statement from its cache.
+   * On release the statement is deleted.
+   */
+  static void detach(statement_impl *stmt);
+
+private:
+  void put(statement_impl *stmt);
+  void evict();
+
+private:
+  struct entry
+  {
+    std::string sql;
+    statement_impl *stmt;
+  };
+  typedef std::list<entry> t_entry_list;
+
+  std::size_t capacity_ = 0;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+
+  // front is the most recently used statement
+  t_entry_list entries_;
+  std::unordered_multimap<std::string, t_entry_list::iterator> index_;
+
+  mutable std::mutex mutex_;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_STATEMENT_CACHE_HPP
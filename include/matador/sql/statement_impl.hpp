@@ -8,6 +8,10 @@
 #include "matador/utils/varchar.hpp"
 
 #include "matador/sql/result.hpp"
+#include "matador/sql/field_filter.hpp"
+
+#include <memory>
+#include <vector>
 
 #ifdef _MSC_VER
 #ifdef matador_sql_EXPORTS
@@ -28,6 +32,8 @@ class sql;
 
 namespace detail {
 
+class statement_cache;
+
 /// @cond MATADOR_DEV
 
 class OOS_SQL_API statement_impl : public serializer
@@ -41,15 +47,39 @@ public:
 
   virtual void reset() = 0;
 
+  /**
+   * Enables or disables unbuffered results of
+   * this statement. Backends which read the rows
+   * on demand anyway ignore it.
+   */
+  void stream_results(bool enable);
+  bool streams_results() const;
+
   template < class T >
   size_t bind(T *o, size_t pos)
   {
     reset();
+    return append(o, pos);
+  }
+
+  template < class T >
+  size_t append(T *o, size_t pos)
+  {
     host_index = pos;
     matador::access::serialize(static_cast<serializer&>(*this), *o);
     return host_index;
   }
 
+  template < class T >
+  size_t bind(T *o, size_t pos, const std::vector<bool> &fields)
+  {
+    reset();
+    host_index = pos;
+    field_filter filter(*this, fields);
+    matador::access::serialize(static_cast<serializer&>(filter), *o);
+    return host_index;
+  }
+
   template < class T >
   size_t bind(T &val, size_t pos)
   {
@@ -67,7 +97,11 @@ protected:
   size_t host_index;
 
 private:
+  friend class statement_cache;
+
   std::string sql_;
+  std::weak_ptr<statement_cache> cache_;
+  bool stream_results_ = false;
 };
 
 /// @endcond
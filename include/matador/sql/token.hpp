@@ -73,6 +73,9 @@ struct OOS_SQL_API token
     AS,
     OFFSET,
     DISTINCT,
+    JOIN,
+    LEFT_JOIN,
+    ON,
     CONDITION,
     SET,
     NOT_NULL,
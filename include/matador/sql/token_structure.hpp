@@ -0,0 +1,122 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_TOKEN_STRUCTURE_HPP
+#define OOS_TOKEN_STRUCTURE_HPP
+
+#ifdef _MSC_VER
+#ifdef matador_sql_EXPORTS
+    #define OOS_SQL_API __declspec(dllexport)
+    #define EXPIMP_SQL_TEMPLATE
+  #else
+    #define OOS_SQL_API __declspec(dllimport)
+    #define EXPIMP_SQL_TEMPLATE extern
+  #endif
+  #pragma warning(disable: 4251)
+#else
+#define OOS_SQL_API
+#endif
+
+#include "matador/sql/token.hpp"
+#include "matador/sql/token_visitor.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace matador {
+
+namespace detail {
+
+/// @cond MATADOR_DEV
+
+/**
+ * Writes the structure of the token list of a sql
+ * object: the token types, the identifiers and all
+ * other parts linked into a prepared statement but
+ * not the values bound to its placeholders.
+ *
+ * Token lists with the same structure are compiled
+ * and linked to the same prepared statement.
+ */
+class OOS_SQL_API token_structure : public token_visitor
+{
+public:
+  explicit token_structure(std::string &out);
+
+  /**
+   * Writes the structure of the given sql object
+   *
+   * @param s The sql object
+   */
+  void write(const sql &s);
+
+  /**
+   * Returns the structure of the given sql object
+   *
+   * @param s The sql object
+   * @return The structure as a string
+   */
+  static std::string of(const sql &s);
+
+  /**
+   * Writes the given identifier prefixed by its
+   * length, so that adjacent identifiers can't
+   * be confused
+   *
+   * @param out The string to append to
+   * @param identifier The identifier to write
+   */
+  static void write_identifier(std::string &out, const std::string &identifier);
+
+  void visit(const matador::detail::create &create) override;
+  void visit(const matador::detail::drop &drop) override;
+  void visit(const matador::detail::select &select) override;
+  void visit(const matador::detail::distinct &distinct) override;
+  void visit(const matador::detail::update &update) override;
+  void visit(const matador::detail::tablename &tab) override;
+  void visit(const matador::detail::set &set) override;
+  void visit(const matador::columns &cols) override;
+  void visit(const matador::column &col) override;
+  void visit(const matador::detail::typed_column &col) override;
+  void visit(const matador::detail::typed_identifier_column &col) override;
+  void visit(const matador::detail::typed_varchar_column &col) override;
+  void visit(const matador::detail::identifier_varchar_column &col) override;
+  void visit(const matador::detail::basic_value_column &col) override;
+  void visit(const matador::detail::from &from) override;
+  void visit(const matador::detail::where &where) override;
+  void visit(const matador::detail::join &join) override;
+  void visit(const matador::detail::on &on) override;
+  void visit(const matador::detail::basic_condition &cond) override;
+  void visit(const matador::detail::basic_column_condition &cond) override;
+  void visit(const matador::detail::basic_in_condition &cond) override;
+  void visit(const matador::detail::order_by &by) override;
+  void visit(const matador::detail::asc &asc) override;
+  void visit(const matador::detail::desc &desc) override;
+  void visit(const matador::detail::group_by &by) override;
+  void visit(const matador::detail::insert &insert) override;
+  void visit(const matador::detail::values &values) override;
+  void visit(const matador::detail::basic_value &val) override;
+  void visit(const matador::detail::remove &remove) override;
+  void visit(const matador::detail::top &top) override;
+  void visit(const matador::detail::as &alias) override;
+  void visit(const matador::detail::begin &begin) override;
+  void visit(const matador::detail::commit &commit) override;
+  void visit(const matador::detail::rollback &rollback) override;
+  void visit(matador::detail::query &q) override;
+
+private:
+  void write(token::t_token type);
+  void write(const std::string &identifier);
+  void write_number(std::size_t number);
+
+private:
+  std::string &out_;
+};
+
+/// @endcond
+
+}
+}
+
+#endif //OOS_TOKEN_STRUCTURE_HPP
@@ -44,6 +44,8 @@ struct asc;
 struct desc;
 struct from;
 struct where;
+struct join;
+struct on;
 class basic_condition;
 class basic_column_condition;
 class basic_in_condition;
@@ -83,6 +85,8 @@ public:
   virtual void visit(const matador::detail::basic_value_column &) = 0;
   virtual void visit(const matador::detail::from &) = 0;
   virtual void visit(const matador::detail::where &) = 0;
+  virtual void visit(const matador::detail::join &) = 0;
+  virtual void visit(const matador::detail::on &) = 0;
   virtual void visit(const matador::detail::basic_condition &) = 0;
   virtual void visit(const matador::detail::basic_column_condition &) = 0;
   virtual void visit(const matador::detail::basic_in_condition &) = 0;
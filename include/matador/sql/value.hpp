@@ -314,9 +314,7 @@ struct value<matador::date> : public detail::basic_value
 
   std::string safe_string(const basic_dialect &dialect) const
   {
-    std::stringstream str;
-    str << "'" << dialect.prepare_literal(matador::to_string(val)) << "'";
-    return str.str();
+    return dialect.date_literal(val);
   }
 
   const char* type_id() const
@@ -341,16 +339,14 @@ struct value<matador::time> : public detail::basic_value
 
   std::string str() const
   {
-    std::stringstream str;
-    str << "'" << matador::to_string(val, "%FT%T.%f") << "'";
-    return str.str();
+    char buffer[iso8601::TIME_SIZE];
+    to_iso8601(val, buffer);
+    return "'" + std::string(buffer) + "'";
   }
 
   std::string safe_string(const basic_dialect &dialect) const
   {
-    std::stringstream str;
-    str << "'" << dialect.prepare_literal(matador::to_string(val, "%FT%T.%f")) << "'";
-    return str.str();
+    return dialect.time_literal(val);
   }
 
   const char* type_id() const
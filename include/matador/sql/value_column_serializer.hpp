@@ -23,6 +23,7 @@
 #include "matador/utils/serializer.hpp"
 
 #include "matador/sql/column.hpp"
+#include "matador/sql/field_filter.hpp"
 
 namespace matador {
 
@@ -43,6 +44,14 @@ public:
     matador::access::serialize(static_cast<serializer&>(*this), x);
   }
 
+  template<class T>
+  void append_to(const std::shared_ptr<columns> cols, T &x, const std::vector<bool> &fields)
+  {
+    cols_ = cols;
+    field_filter filter(*this, fields);
+    matador::access::serialize(static_cast<serializer&>(filter), x);
+  }
+
   void serialize(const char *id, char &x);
   void serialize(const char *id, short &x);
   void serialize(const char *id, int &x);
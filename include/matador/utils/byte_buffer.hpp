@@ -31,8 +31,9 @@
   #define OOS_UTILS_API
 #endif
 
-#include <array>
-#include <list>
+#include <cstddef>
+#include <cstring>
+#include <vector>
 
 namespace matador {
 
@@ -42,32 +43,30 @@ namespace matador {
  * @brief A buffer for bytes.
  * 
  * This class provide a buffer for bytes. The
- * bytes are added in chunks. Once the current chunk
- * of bytes is full a new empty chunk is added.
- * The bytes are appended and released from the end
- * of the buffer.
+ * bytes are kept in one contiguous block of memory
+ * which grows on demand. Bytes are appended at the end
+ * and released from the front of the buffer.
+ * Once all bytes are released or the buffer is
+ * cleared the memory is reused for new bytes.
  * It is used by the object_store to serialize objects.
  */
 class OOS_UTILS_API byte_buffer
 {
-private:
-  enum { BUF_SIZE = 1 << 14 };
-  typedef std::array<char, BUF_SIZE> t_data_array;
-
 public:
   /**
    * The type of the size.
    */
-  typedef t_data_array::size_type size_type;
+  typedef std::size_t size_type;
 
   /**
    * @brief Create an empty buffer.
    * 
-   * Create an empty buffer. One empty chunk is
-   * also created.
+   * Create an empty buffer. No memory
+   * is allocated until the first bytes
+   * are appended.
    */
-  byte_buffer();
-  ~byte_buffer();
+  byte_buffer() = default;
+  ~byte_buffer() = default;
 
   /**
    * @brief Append an amount of bytes.
@@ -77,7 +76,14 @@ public:
    * @param bytes The pointer to the bytes to add.
    * @param size The size of the bytes to add.
    */
-  void append(const void *bytes, size_type size);
+  void append(const void *bytes, size_type size)
+  {
+    if (size > data_.size() - write_cursor_) {
+      grow(size);
+    }
+    std::memcpy(data_.data() + write_cursor_, bytes, size);
+    write_cursor_ += size;
+  }
 
   /**
    * @brief Release a number of bytes.
@@ -87,8 +93,60 @@ public:
    * 
    * @param bytes The address of the memory where the bytes should go to.
    * @param size The number of bytes released from the buffer.
+   * @throws std::out_of_range If the buffer holds less than size bytes.
+   */
+  void release(void *bytes, size_type size)
+  {
+    std::memcpy(bytes, view(size), size);
+  }
+
+  /**
+   * @brief Release a number of bytes without copying.
+   *
+   * A number of bytes is released and a pointer to
+   * the first released byte is returned. The pointer
+   * stays valid until the next call to append or clear.
+   *
+   * @param size The number of bytes released from the buffer.
+   * @return Pointer to the released bytes.
+   * @throws std::out_of_range If the buffer holds less than size bytes.
    */
-  void release(void *bytes, size_type size);
+  const char* view(size_type size)
+  {
+    if (size > write_cursor_ - read_cursor_) {
+      throw_out_of_range(size);
+    }
+    const char *bytes = data_.data() + read_cursor_;
+    read_cursor_ += size;
+    if (read_cursor_ == write_cursor_) {
+      // all bytes are released, reuse the memory
+      read_cursor_ = write_cursor_ = 0;
+    }
+    return bytes;
+  }
+
+  /**
+   * @brief Read a range of appended bytes again.
+   *
+   * Makes the bytes between the given positions the
+   * bytes not yet released. A position is the size of
+   * the buffer at the time the bytes were appended,
+   * counted since the buffer was last empty. Bytes
+   * overwritten by a later append can't be read again.
+   *
+   * @param begin The position of the first byte.
+   * @param end The position behind the last byte.
+   * @throws std::out_of_range If the range exceeds the memory of the buffer.
+   */
+  void rewind(size_type begin, size_type end);
+
+  /**
+   * Reserves memory for at least the given
+   * number of bytes.
+   *
+   * @param size The number of bytes to reserve.
+   */
+  void reserve(size_type size);
 
   /**
    * Return the size of the buffer.
@@ -96,23 +154,37 @@ public:
   size_type size() const;
 
   /**
-   * Clear the buffer.
+   * Returns the bytes not yet released.
+   * The pointer is invalidated by the
+   * next append.
+   */
+  const char* data() const;
+
+  /**
+   * Return the number of bytes the
+   * buffer can hold without growing.
+   */
+  size_type capacity() const;
+
+  /**
+   * Returns true if the buffer is empty.
+   */
+  bool empty() const;
+
+  /**
+   * Clear the buffer. The memory
+   * of the buffer is retained.
    */
   void clear();
 
 private:
-  struct buffer_chunk
-  {
-    buffer_chunk() : read_cursor(0), write_cursor(0) {}
-    byte_buffer::size_type available() const { return data.size() - write_cursor; }
-    byte_buffer::size_type used() const { return write_cursor - read_cursor; }
-    byte_buffer::size_type released() const { return read_cursor; }
-    t_data_array data;
-    byte_buffer::size_type read_cursor;
-    byte_buffer::size_type write_cursor;
-  };
-  typedef std::list<buffer_chunk> t_chunk_list;
-  t_chunk_list chunk_list_;
+  void grow(size_type size);
+  void throw_out_of_range(size_type size) const;
+
+private:
+  std::vector<char> data_;
+  size_type read_cursor_ = 0;
+  size_type write_cursor_ = 0;
 };
 /// @endcond
 
@@ -109,6 +109,69 @@ OOS_UTILS_API std::string to_string(const matador::time &x, const char *format =
  */
 OOS_UTILS_API std::string to_string(const matador::date &x, const char *format = date_format::ISO8601);
 
+/**
+ * The iso8601 struct holds the buffer sizes
+ * needed by the fixed format ISO 8601
+ * conversions of date and time.
+ */
+struct OOS_UTILS_API iso8601
+{
+  static const std::size_t DATE_SIZE = 11; /**< Buffer size of a date (YYYY-MM-DD) */
+  static const std::size_t TIME_SIZE = 24; /**< Buffer size of a time (YYYY-MM-DDTHH:MM:SS.mmm) */
+};
+
+/**
+ * Writes the given date in the format YYYY-MM-DD
+ * into the given buffer. The buffer must hold at
+ * least iso8601::DATE_SIZE characters. Unlike
+ * to_string() it doesn't allocate.
+ *
+ * @param x Date object to convert.
+ * @param buffer The buffer to write into
+ * @return The number of characters written without the terminating null
+ */
+OOS_UTILS_API std::size_t to_iso8601(const matador::date &x, char *buffer);
+
+/**
+ * Writes the given time in the format
+ * YYYY-MM-DDTHH:MM:SS.mmm into the given buffer.
+ * The buffer must hold at least iso8601::TIME_SIZE
+ * characters. Unlike to_string() it doesn't
+ * allocate.
+ *
+ * @param x Time object to convert.
+ * @param buffer The buffer to write into
+ * @param separator The separator between date and time
+ * @param with_millis If false the milliseconds are omitted
+ * @return The number of characters written without the terminating null
+ */
+OOS_UTILS_API std::size_t to_iso8601(const matador::time &x, char *buffer, char separator = 'T', bool with_millis = true);
+
+/**
+ * Reads a date in the format YYYY-MM-DD from the
+ * given string. Trailing characters are ignored.
+ *
+ * @param str The string to read
+ * @param len The length of the string
+ * @param x The date to set
+ * @throws std::logic_error if the string isn't a date
+ */
+OOS_UTILS_API void from_iso8601(const char *str, std::size_t len, matador::date &x);
+
+/**
+ * Reads a time in the format YYYY-MM-DDTHH:MM:SS
+ * from the given string. The separator may also
+ * be a space. The time may have a fraction of
+ * seconds with up to six digits, trailing
+ * characters are ignored.
+ *
+ * @param str The string to read
+ * @param len The length of the string
+ * @param x The time to set
+ * @throws std::logic_error if the string isn't a time
+ */
+OOS_UTILS_API void from_iso8601(const char *str, std::size_t len, matador::time &x);
+
 /**
  * Convert any floating point values
  * into a string with a given precision.
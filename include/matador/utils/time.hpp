@@ -196,6 +196,20 @@ public:
    */
   static time parse(const std::string &tstr, const char *format);
 
+  /**
+   * Converts the given broken down local time into
+   * seconds since epoch and normalizes it. Unlike
+   * mktime the result doesn't depend on tm_isdst or
+   * the platform at a daylight saving time switch:
+   * A time in the gap is moved forward by the shift,
+   * a time in the overlap is the earlier one, which
+   * is still in daylight saving time.
+   *
+   * @param t Broken down local time.
+   * @return Seconds since epoch.
+   */
+  static time_t to_time_t(struct tm &t);
+
   /**
    * Sets time by its parts.
    *
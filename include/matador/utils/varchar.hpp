@@ -90,7 +90,7 @@ public:
    *
    * @param x Varchar to be moved
    */
-  varchar_base(varchar_base &&x);
+  varchar_base(varchar_base &&x) noexcept;
 
   /**
    * Copy assign a varchar from given varchar.
@@ -106,7 +106,7 @@ public:
    * @param x Varchar to be assign moved
    * @return Reference of the new varchar
    */
-  varchar_base& operator=(varchar_base &&x);
+  varchar_base& operator=(varchar_base &&x) noexcept;
 
   ~varchar_base();
 
@@ -104,6 +104,16 @@ dialect_traits::identifier mssql_dialect::identifier_escape_type() const
   return dialect_traits::ESCAPE_CLOSING_BRACKET;
 }
 
+size_t mssql_dialect::max_bind_count() const
+{
+  return 2100;
+}
+
+size_t mssql_dialect::max_insert_rows() const
+{
+  return 1000;
+}
+
 }
 
 }
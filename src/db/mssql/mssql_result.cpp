@@ -157,7 +157,9 @@ void mssql_result::serialize(const char * /*id*/, char *x, size_t s)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, result_index_++, SQL_C_CHAR, x, s, &info);
   if (ret == SQL_SUCCESS) {
-    return;
+    if (info == SQL_NULL_DATA) {
+      x[0] = '\0';
+    }
   } else {
     throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
   }
@@ -199,7 +201,11 @@ void mssql_result::read_column(const char *, std::string &val)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, result_index_++, SQL_C_CHAR, buf, 1024, &info);
   if (SQL_SUCCEEDED(ret)) {
-    val.assign(buf, info);
+    if (info == SQL_NULL_DATA) {
+      val.clear();
+    } else {
+      val.assign(buf, info);
+    }
   } else {
     throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
   }
@@ -210,7 +216,9 @@ void mssql_result::read_column(const char *, char &val)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, (SQLUSMALLINT)(result_index_++), SQL_C_CHAR, &val, 0, &info);
   if (SQL_SUCCEEDED(ret)) {
-    return;
+    if (info == SQL_NULL_DATA) {
+      val = '\0';
+    }
   } else {
     throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
   }
@@ -222,7 +230,7 @@ void mssql_result::read_column(const char *, varchar_base &val)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, static_cast<SQLUSMALLINT>(result_index_++), SQL_C_CHAR, buf, val.capacity(), &info);
   if (SQL_SUCCEEDED(ret)) {
-    val.assign(buf, static_cast<size_t>(info));
+    val.assign(buf, info == SQL_NULL_DATA ? 0 : static_cast<size_t>(info));
     delete [] buf;
   } else {
     delete [] buf;
@@ -238,9 +246,11 @@ void mssql_result::read_column(char const *, date &x)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, static_cast<SQLUSMALLINT>(result_index_++), SQL_C_TYPE_DATE, &ds, 0, &info);
   if (SQL_SUCCEEDED(ret)) {
-    x.year(ds.year);
-    x.month(ds.month);
-    x.day(ds.day);
+    if (info == SQL_NULL_DATA) {
+      x = matador::date();
+    } else {
+      x.set(ds.day, ds.month, ds.year);
+    }
   } else {
     throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
   }
@@ -253,7 +263,11 @@ void mssql_result::read_column(char const *, time &x)
   SQLLEN info = 0;
   SQLRETURN ret = SQLGetData(stmt_, static_cast<SQLUSMALLINT>(result_index_++), SQL_C_TYPE_TIMESTAMP, &ts, 0, &info);
   if (SQL_SUCCEEDED(ret)) {
-    x.set(ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second, ts.fraction / 1000 / 1000);
+    if (info == SQL_NULL_DATA) {
+      x = matador::time();
+    } else {
+      x.set(ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second, ts.fraction / 1000 / 1000);
+    }
   } else {
     throw_error(ret, SQL_HANDLE_STMT, stmt_, "mssql", "error on retrieving column value");
   }
@@ -107,9 +107,18 @@ detail::result_impl* mysql_connection::execute(const matador::sql &sql)
 
 detail::result_impl* mysql_connection::execute(const std::string &stmt)
 {
+  return execute(stmt, streams_results());
+}
+
+detail::result_impl* mysql_connection::execute(const std::string &stmt, bool stream)
+{
+  check_cursor(stmt);
   if (mysql_query(&mysql_, stmt.c_str())) {
     throw mysql_exception(&mysql_, "mysql_query", stmt);
   }
+  if (stream) {
+    return new mysql_result(*this);
+  }
   return new mysql_result(&mysql_);
 }
 
@@ -121,19 +130,19 @@ detail::statement_impl* mysql_connection::prepare(const matador::sql &stmt)
 void mysql_connection::begin()
 {
   // TODO: check result
-  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("START TRANSACTION;")));
+  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("START TRANSACTION;", false)));
 }
 
 void mysql_connection::commit()
 {
   // TODO: check result
-  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("COMMIT;")));
+  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("COMMIT;", false)));
 }
 
 void mysql_connection::rollback()
 {
   // TODO: check result
-  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("ROLLBACK;")));
+  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute("ROLLBACK;", false)));
 }
 
 std::string mysql_connection::type() const
@@ -150,7 +159,7 @@ bool mysql_connection::exists(const std::string &tablename)
 {
   std::string stmt("SHOW TABLES LIKE '" + tablename + "'");
 //  std::string stmt("SELECT COUNT(*) FROM information_schema.tables WHERE table_schema = '" + db_ + "' AND table_name = '" + tablename + "' LIMIT 1");
-  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute(stmt)));
+  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute(stmt, false)));
   if (!res->fetch()) {
     return false;
   } else {
@@ -163,7 +172,7 @@ bool mysql_connection::exists(const std::string &tablename)
 std::vector<field> mysql_connection::describe(const std::string &table)
 {
   std::string stmt("SHOW COLUMNS FROM " + table);
-  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute(stmt)));
+  std::unique_ptr<mysql_result> res(static_cast<mysql_result*>(execute(stmt, false)));
 
   std::vector<field> fields;
 
@@ -186,6 +195,25 @@ basic_dialect* mysql_connection::dialect()
   return &dialect_;
 }
 
+void mysql_connection::open_cursor(detail::result_impl *cursor)
+{
+  cursor_ = cursor;
+}
+
+void mysql_connection::close_cursor(detail::result_impl *cursor)
+{
+  if (cursor_ == cursor) {
+    cursor_ = nullptr;
+  }
+}
+
+void mysql_connection::check_cursor(const std::string &sql) const
+{
+  if (cursor_ != nullptr) {
+    throw_error("mysql", "connection has an open streamed result, read all its rows or destroy it first (" + sql + ")");
+  }
+}
+
 unsigned long mysql_connection::last_inserted_id()
 {
   if (mysql_field_count(&mysql_) == 0 &&
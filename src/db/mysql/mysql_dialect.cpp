@@ -112,6 +112,11 @@ dialect_traits::identifier mysql_dialect::identifier_escape_type() const
   return dialect_traits::ESCAPE_BOTH_SAME;
 }
 
+size_t mysql_dialect::max_bind_count() const
+{
+  return 65535;
+}
+
 }
 
 }
@@ -1,9 +1,11 @@
 #include "matador/db/mysql/mysql_prepared_result.hpp"
+#include "matador/db/mysql/mysql_connection.hpp"
 #include "matador/db/mysql/mysql_exception.hpp"
 
 #include "matador/utils/date.hpp"
 #include "matador/utils/time.hpp"
 #include "matador/utils/varchar.hpp"
+#include "matador/utils/string.hpp"
 #include "matador/utils/basic_identifier.hpp"
 #include "matador/utils/identifiable_holder.hpp"
 
@@ -26,8 +28,31 @@ mysql_prepared_result::mysql_prepared_result(MYSQL_STMT *s, int rs)
     memset(info_, 0, rs * sizeof(mysql_result_info));
 }
 
+mysql_prepared_result::mysql_prepared_result(MYSQL_STMT *s, int rs, mysql_connection &conn)
+  : affected_rows_((size_type)mysql_stmt_affected_rows(s))
+  , rows(0)
+  , fields_(mysql_stmt_field_count(s))
+  , stmt(s)
+  , result_size(rs)
+  , bind_(new MYSQL_BIND[rs])
+  , info_(new mysql_result_info[rs])
+  , stream_(true)
+{
+  memset(bind_, 0, rs * sizeof(MYSQL_BIND));
+  memset(info_, 0, rs * sizeof(mysql_result_info));
+  if (fields_ > 0) {
+    conn_ = &conn;
+    conn_->open_cursor(this);
+  }
+}
+
 mysql_prepared_result::~mysql_prepared_result()
 {
+  if (conn_ != nullptr) {
+    // discards the rows not fetched yet
+    mysql_stmt_free_result(stmt);
+    close_cursor();
+  }
   delete [] bind_;
   for (int i = 0; i < result_size; ++i) {
     if (info_[i].buffer != 0) {
@@ -49,6 +74,18 @@ bool mysql_prepared_result::fetch()
   if (ret == MYSQL_DATA_TRUNCATED) {
     // Todo: handle truncated data
   }
+  if (stream_) {
+    if (ret == MYSQL_NO_DATA) {
+      close_cursor();
+      return false;
+    } else if (ret == 1) {
+      // an error while streaming isn't the end of the result
+      close_cursor();
+      throw_stmt_error(ret, stmt, "mysql", "");
+    }
+    ++rows;
+    return true;
+  }
   return rows-- > 0;
 }
 
@@ -59,10 +96,15 @@ bool mysql_prepared_result::prepare_fetch()
   // fetch data
   int ret = mysql_stmt_fetch(stmt);
   if (ret == MYSQL_NO_DATA) {
+    close_cursor();
     return false;
   } else if (ret == 1) {
+    close_cursor();
     throw_stmt_error(ret, stmt, "mysql", "");
   }
+  if (stream_) {
+    ++rows;
+  }
   prepare_binding_ = false;
   return true;
 }
@@ -72,6 +114,14 @@ bool mysql_prepared_result::finalize_fetch()
   return true;
 }
 
+void mysql_prepared_result::close_cursor()
+{
+  if (conn_ != nullptr) {
+    conn_->close_cursor(this);
+    conn_ = nullptr;
+  }
+}
+
 mysql_prepared_result::size_type mysql_prepared_result::affected_rows() const
 {
   size_t ar = mysql_stmt_affected_rows(stmt);
@@ -99,6 +149,9 @@ void mysql_prepared_result::serialize(const char *, char &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_TINY, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -108,6 +161,9 @@ void mysql_prepared_result::serialize(const char *, short & x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_SHORT, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -117,6 +173,9 @@ void mysql_prepared_result::serialize(const char *, int &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_LONG, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -127,6 +186,9 @@ void mysql_prepared_result::serialize(const char *, long &x)
 	  //prepare_bind_column(column_index_++, MYSQL_TYPE_LONGLONG, x);
 	prepare_bind_column(column_index_++, MYSQL_TYPE_LONG, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -136,6 +198,9 @@ void mysql_prepared_result::serialize(const char *, unsigned char &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_TINY, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -145,6 +210,9 @@ void mysql_prepared_result::serialize(const char *, unsigned short &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_SHORT, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -154,6 +222,9 @@ void mysql_prepared_result::serialize(const char *, unsigned int &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_LONG, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -164,6 +235,9 @@ void mysql_prepared_result::serialize(const char *, unsigned long &x)
 	  //prepare_bind_column(column_index_++, MYSQL_TYPE_LONGLONG, x);
 	prepare_bind_column(column_index_++, MYSQL_TYPE_LONG, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -173,6 +247,9 @@ void mysql_prepared_result::serialize(const char *, bool &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_TINY, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -182,6 +259,9 @@ void mysql_prepared_result::serialize(const char *, float &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_FLOAT, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -191,6 +271,9 @@ void mysql_prepared_result::serialize(const char *, double &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_DOUBLE, x);
   } else {
+    if (info_[result_index_].is_null) {
+      x = 0;
+    }
     ++result_index_;
   }
 }
@@ -200,6 +283,9 @@ void mysql_prepared_result::serialize(const char *, char *x, size_t s)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_VAR_STRING, x, s);
   } else {
+    if (info_[result_index_].is_null) {
+      x[0] = '\0';
+    }
     ++result_index_;
   }
 }
@@ -209,7 +295,9 @@ void mysql_prepared_result::serialize(const char *, matador::date &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_DATE, x);
   } else {
-    if (info_[result_index_].length > 0) {
+    if (info_[result_index_].is_null) {
+      x = matador::date();
+    } else if (info_[result_index_].length > 0) {
       MYSQL_TIME *mtt = (MYSQL_TIME*)info_[result_index_].buffer;
       x.set(mtt->day, mtt->month, mtt->year);
     }
@@ -223,14 +311,18 @@ void mysql_prepared_result::serialize(const char *id, matador::time &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_VAR_STRING, x);
   } else {
-    if (info_[result_index_].length > 0) {
+    if (info_[result_index_].is_null) {
+      x = matador::time();
+      ++result_index_;
+    } else {
       // before mysql version 5.6.4 datetime
       // doesn't support fractional seconds
       // so we use a datetime string here
       std::string val;
       serialize(id, val);
-      x = matador::time::parse(val, "%FT%T");
-      ++result_index_;
+      if (!val.empty()) {
+        from_iso8601(val.data(), val.size(), x);
+      }
     }
   }
 }
@@ -240,11 +332,13 @@ void mysql_prepared_result::serialize(const char *, matador::time &x)
   if (prepare_binding_) {
     prepare_bind_column(column_index_++, MYSQL_TYPE_TIMESTAMP, x);
   } else {
-    if (info_[result_index_].length > 0) {
+    if (info_[result_index_].is_null) {
+      x = matador::time();
+    } else if (info_[result_index_].length > 0) {
       MYSQL_TIME *mtt = (MYSQL_TIME*)info_[result_index_].buffer;
       x.set(mtt->year, mtt->month, mtt->day, mtt->hour, mtt->minute, mtt->second, mtt->second_part / 1000);
-      ++result_index_;
     }
+    ++result_index_;
   }
 }
 #endif
@@ -266,6 +360,8 @@ void mysql_prepared_result::serialize(const char *, std::string &x)
       }
       delete [] (char*)bind_[result_index_].buffer;
       bind_[result_index_].buffer = 0;
+    } else {
+      x.clear();
     }
     ++result_index_;
   }
@@ -278,7 +374,7 @@ void mysql_prepared_result::serialize(const char *, varchar_base &x)
   } else {
     char *data = (char*)bind_[result_index_].buffer;
 //  unsigned long len = bind_[result_index].buffer_length;
-    unsigned long len = info_[result_index_].length;
+    unsigned long len = info_[result_index_].is_null ? 0 : info_[result_index_].length;
     x.assign(data, len);
     ++result_index_;
   }
@@ -23,6 +23,7 @@
 #include "matador/utils/identifier.hpp"
 
 #include "matador/db/mysql/mysql_result.hpp"
+#include "matador/db/mysql/mysql_connection.hpp"
 #include "matador/db/mysql/mysql_exception.hpp"
 
 #include <cstring>
@@ -45,11 +46,31 @@ mysql_result::mysql_result(MYSQL *c)
     fields_ = mysql_num_fields(res_);
   }
 }
+
+mysql_result::mysql_result(mysql_connection &conn)
+  : affected_rows_((size_type)mysql_affected_rows(conn.handle()))
+  , rows_(0)
+  , fields_(0)
+  , res_(0)
+  , stream_(true)
+{
+  res_ = mysql_use_result(conn.handle());
+  if (res_ == 0 && mysql_errno(conn.handle()) > 0) {
+    throw_error(-1, conn.handle(), "mysql", "");
+  } else if (res_) {
+    fields_ = mysql_num_fields(res_);
+    conn_ = &conn;
+    conn_->open_cursor(this);
+  }
+}
+
 mysql_result::~mysql_result()
 {
   if (res_) {
+    // reads the remaining rows of a streamed result
     mysql_free_result(res_);
   }
+  close_cursor();
 }
 
 const char* mysql_result::column(size_type c) const
@@ -65,9 +86,21 @@ bool mysql_result::fetch()
 {
   row_ = mysql_fetch_row(res_);
   if (!row_) {
-    rows_ = 0;
+    if (!stream_) {
+      rows_ = 0;
+    }
+    // an error while streaming isn't the end of the result
+    MYSQL *handle = conn_ != nullptr ? conn_->handle() : nullptr;
+    close_cursor();
+    if (handle != nullptr && mysql_errno(handle) != 0) {
+      throw_error(-1, handle, "mysql", "");
+    }
     return false;
-  }    
+  }
+  if (stream_) {
+    ++rows_;
+    return true;
+  }
   return rows_-- > 0;
 }
 
@@ -86,6 +119,14 @@ bool mysql_result::finalize_fetch()
   return true;
 }
 
+void mysql_result::close_cursor()
+{
+  if (conn_ != nullptr) {
+    conn_->close_cursor(this);
+    conn_ = nullptr;
+  }
+}
+
 mysql_result::size_type mysql_result::affected_rows() const
 {
   return affected_rows_;
@@ -109,15 +150,14 @@ int mysql_result::transform_index(int index) const
 void mysql_result::serialize(const char *, char &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) > 1) {
-    x = val[0];
-  }
+  x = val == nullptr ? '\0' : val[0];
 }
 
 void mysql_result::serialize(const char *, short &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -127,7 +167,8 @@ void mysql_result::serialize(const char *, short &x)
 void mysql_result::serialize(const char *, int &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -138,7 +179,8 @@ void mysql_result::serialize(const char *, int &x)
 void mysql_result::serialize(const char *, long &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -149,7 +191,8 @@ void mysql_result::serialize(const char *, long &x)
 void mysql_result::serialize(const char *, unsigned char &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -160,7 +203,8 @@ void mysql_result::serialize(const char *, unsigned char &x)
 void mysql_result::serialize(const char *, unsigned short &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -171,7 +215,8 @@ void mysql_result::serialize(const char *, unsigned short &x)
 void mysql_result::serialize(const char *, unsigned int &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -182,7 +227,8 @@ void mysql_result::serialize(const char *, unsigned int &x)
 void mysql_result::serialize(const char *, unsigned long &x)
 {
   char *val = row_[result_index_++];
-  if (!val || strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end = nullptr;
@@ -193,7 +239,8 @@ void mysql_result::serialize(const char *, unsigned long &x)
 void mysql_result::serialize(const char *, bool &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -204,7 +251,8 @@ void mysql_result::serialize(const char *, bool &x)
 void mysql_result::serialize(const char *, float &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -215,7 +263,8 @@ void mysql_result::serialize(const char *, float &x)
 void mysql_result::serialize(const char *, double &x)
 {
   char *val = row_[result_index_++];
-  if (strlen(val) == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = 0;
     return;
   }
   char *end;
@@ -226,6 +275,10 @@ void mysql_result::serialize(const char *, double &x)
 void mysql_result::serialize(const char *, char *x, size_t s)
 {
   char *val = row_[result_index_++];
+  if (val == nullptr) {
+    x[0] = '\0';
+    return;
+  }
   size_t len = strlen(val);
   if (len > (size_t)s) {
     strncpy(x, val, (size_t)s);
@@ -239,39 +292,39 @@ void mysql_result::serialize(const char *, char *x, size_t s)
 void mysql_result::serialize(const char *, varchar_base &x)
 {
   char *val = row_[result_index_++];
-  x.assign(val);
+  x.assign(val == nullptr ? "" : val);
 }
 
 void mysql_result::serialize(const char *, std::string &x)
 {
   char *val = row_[result_index_++];
-  x.assign(val);
+  if (val == nullptr) {
+    x.clear();
+  } else {
+    x.assign(val);
+  }
 }
 
 void mysql_result::serialize(const char *, matador::date &x)
 {
   char *val = row_[result_index_++];
-  size_t len = strlen(val);
-  if (val == nullptr || len == 0) {
+  if (val == nullptr || strlen(val) == 0) {
+    x = matador::date();
     return;
   }
-  x.set(val, matador::date_format::ISO8601);
+  from_iso8601(val, strlen(val), x);
 }
 
-void mysql_result::serialize(const char *id, matador::time &x)
+void mysql_result::serialize(const char *, matador::time &x)
 {
-#if MYSQL_VERSION_ID < 50604
-  // before mysql version 5.6.4 datetime
-  // doesn't support fractional seconds
-  // so we use a datetime string here
-  std::string val;
-  serialize(id, val);
-  x = matador::time::parse(val, "%Y-%m-%dT%T");
-#else
-  std::string val;
-  serialize(id, val);
-  x = matador::time::parse(val, "%Y-%m-%d %T.%f");
-#endif
+  // the fraction of seconds is optional, before
+  // mysql version 5.6.4 datetime doesn't have one
+  char *val = row_[result_index_++];
+  if (val == nullptr || strlen(val) == 0) {
+    x = matador::time();
+    return;
+  }
+  from_iso8601(val, strlen(val), x);
 }
 
 void mysql_result::serialize(const char *id, matador::basic_identifier &x)
@@ -34,7 +34,8 @@ namespace matador {
 namespace mysql {
 
 mysql_statement::mysql_statement(mysql_connection &db, const matador::sql &stmt)
-  : result_size(0)
+  : db_(db)
+  , result_size(0)
   , host_size(0)
   , stmt_(mysql_stmt_init(db.handle()))
 {
@@ -49,6 +50,7 @@ mysql_statement::mysql_statement(mysql_connection &db, const matador::sql &stmt)
     is_null_vector.assign(host_size, false);
   }
 
+  db_.check_cursor(str());
   int res = mysql_stmt_prepare(stmt_, str().c_str(), (unsigned long)str().size());
   if (res > 0) {
     throw_stmt_error(res, stmt_, "mysql", str());
@@ -83,6 +85,7 @@ void mysql_statement::clear()
 
 detail::result_impl* mysql_statement::execute()
 {
+  db_.check_cursor(str());
   if (host_array) {
     int res = mysql_stmt_bind_param(stmt_, host_array);
     if (res > 0) {
@@ -94,6 +97,10 @@ detail::result_impl* mysql_statement::execute()
   if (res > 0) {
     throw_stmt_error(res, stmt_, "mysql", str());
   }
+  if (streams_results()) {
+    // rows are fetched one by one from the server
+    return new mysql_prepared_result(stmt_, (int)result_size, db_);
+  }
   res = mysql_stmt_store_result(stmt_);
   if (res > 0) {
     throw_stmt_error(res, stmt_, "mysql", str());
@@ -193,8 +200,9 @@ void mysql_statement::serialize(const char *, matador::time &x)
   // before mysql version 5.6.4 datetime
   // doesn't support fractional seconds
   // so we use a datetime string here
-  std::string tstr = to_string(x, "%FT%T");
-  bind_value(host_index, MYSQL_TYPE_VAR_STRING, tstr.c_str(), tstr.size());
+  char buffer[iso8601::TIME_SIZE];
+  std::size_t len = to_iso8601(x, buffer, 'T', false);
+  bind_value(host_index, MYSQL_TYPE_VAR_STRING, buffer, len);
 #else
   bind_value(host_index, MYSQL_TYPE_TIMESTAMP, x);
 #endif
@@ -17,7 +17,7 @@
 
 #include "matador/db/sqlite/sqlite_connection.hpp"
 #include "matador/db/sqlite/sqlite_statement.hpp"
-#include "matador/db/sqlite/sqlite_result.hpp"
+#include "matador/db/sqlite/sqlite_query_result.hpp"
 #include "matador/db/sqlite/sqlite_types.hpp"
 #include "matador/db/sqlite/sqlite_exception.hpp"
 
@@ -41,6 +41,15 @@ void throw_error(int ec, sqlite3 *db, const std::string &source)
   throw sqlite_exception(msg.str()); 
 }
 
+void throw_step_error(sqlite3_stmt *stmt, sqlite3 *db)
+{
+  // the message must be read before the statement is finalized
+  std::stringstream msg;
+  msg << "sqlite3_step: " << sqlite3_errmsg(db);
+  sqlite3_finalize(stmt);
+  throw sqlite_exception(msg.str());
+}
+
 sqlite_connection::sqlite_connection()
   : sqlite_db_(0)
 {
@@ -81,17 +90,17 @@ sqlite3* sqlite_connection::handle()
 
 void sqlite_connection::begin()
 {
-  std::unique_ptr<sqlite_result> res(static_cast<sqlite_result*>(execute("BEGIN TRANSACTION;")));
+  std::unique_ptr<detail::result_impl> res(execute("BEGIN TRANSACTION;"));
 }
 
 void sqlite_connection::commit()
 {
-  std::unique_ptr<sqlite_result> res(static_cast<sqlite_result*>(execute("COMMIT TRANSACTION;")));
+  std::unique_ptr<detail::result_impl> res(execute("COMMIT TRANSACTION;"));
 }
 
 void sqlite_connection::rollback()
 {
-  std::unique_ptr<sqlite_result> res(static_cast<sqlite_result*>(execute("ROLLBACK TRANSACTION;")));
+  std::unique_ptr<detail::result_impl> res(execute("ROLLBACK TRANSACTION;"));
 }
 
 std::string sqlite_connection::type() const
@@ -112,15 +121,40 @@ matador::detail::result_impl* sqlite_connection::execute(const matador::sql &sql
 
 matador::detail::result_impl* sqlite_connection::execute(const std::string &stmt)
 {
-  std::unique_ptr<sqlite_result> res(new sqlite_result);
-  char *errmsg = 0;
-  int ret = sqlite3_exec(sqlite_db_, stmt.c_str(), parse_result, res.get(), &errmsg);
-  if (ret != SQLITE_OK) {
-    std::string error(errmsg);
-    sqlite3_free(errmsg);
-    throw sqlite_exception(error);
+  const char *tail = stmt.c_str();
+  sqlite3_stmt *current = nullptr;
+  int ret = SQLITE_DONE;
+
+  while (*tail != '\0') {
+    sqlite3_stmt *next = nullptr;
+    int prep = sqlite3_prepare_v2(sqlite_db_, tail, -1, &next, &tail);
+    if (prep != SQLITE_OK) {
+      sqlite3_finalize(current);
+      throw_error(prep, sqlite_db_, "sqlite3_prepare_v2");
+    }
+    if (next == nullptr) {
+      // only whitespace or comments left
+      break;
+    }
+    // all but the last statement are executed completely
+    while (ret == SQLITE_ROW) {
+      ret = sqlite3_step(current);
+    }
+    if (ret != SQLITE_DONE) {
+      sqlite3_finalize(next);
+      throw_step_error(current, sqlite_db_);
+    }
+    sqlite3_finalize(current);
+    current = next;
+
+    // get the first row
+    ret = sqlite3_step(current);
+    if (ret != SQLITE_ROW && ret != SQLITE_DONE) {
+      throw_step_error(current, sqlite_db_);
+    }
   }
-  return res.release();
+  // the result steps through the remaining rows
+  return new sqlite_query_result(current, ret);
 }
 
 matador::detail::statement_impl *sqlite_connection::prepare(const matador::sql &sql)
@@ -132,9 +166,9 @@ matador::detail::statement_impl *sqlite_connection::prepare(const matador::sql &
 bool sqlite_connection::exists(const std::string &tablename)
 {
   std::string stmt("SELECT COUNT(*) FROM sqlite_master WHERE type='table' AND tbl_name='" + tablename + "' LIMIT 1");
-  std::unique_ptr<sqlite_result> res(static_cast<sqlite_result*>(execute(stmt)));
+  std::unique_ptr<detail::result_impl> res(execute(stmt));
 
-  if (res->result_rows() != 1) {
+  if (!res->fetch()) {
     return false;
   } else {
     char *end;
@@ -145,11 +179,11 @@ bool sqlite_connection::exists(const std::string &tablename)
 std::vector<field> sqlite_connection::describe(const std::string &table)
 {
   std::string stmt("PRAGMA table_info(" + table + ")");
-  std::unique_ptr<sqlite_result> res(static_cast<sqlite_result*>(execute(stmt)));
+  std::unique_ptr<detail::result_impl> res(execute(stmt));
 
   std::vector<field> fields;
 
-  do {
+  while (res->fetch()) {
     field f;
     char *end = nullptr;
     f.index(strtoul(res->column(0), &end, 10));
@@ -161,7 +195,7 @@ std::vector<field> sqlite_connection::describe(const std::string &table)
 //    end = nullptr;
 //    f.is_primary_key(strtoul(res->column(3), &end, 10) == 0);
     fields.push_back(f);
-  } while (res->fetch());
+  }
 
   return fields;
 }
@@ -171,24 +205,6 @@ basic_dialect *sqlite_connection::dialect()
   return &dialect_;
 }
 
-int sqlite_connection::parse_result(void* param, int column_count, char** values, char** /*columns*/)
-{
-  sqlite_result *result = static_cast<sqlite_result*>(param);
-
-  /********************
-   *
-   * a new row was retrieved
-   * add a new row to the result
-   * and iterator over all columns
-   * adding each column value as
-   * string to the row
-   *
-   ********************/
-
-  result->push_back(values, column_count);
-  return 0;
-}
-
 unsigned long sqlite_connection::last_inserted_id()
 {
   return static_cast<unsigned long>(sqlite3_last_insert_rowid(sqlite_db_));
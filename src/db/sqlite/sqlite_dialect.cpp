@@ -6,6 +6,8 @@
 
 #include "matador/sql/basic_dialect_linker.hpp"
 
+#include "matador/utils/date.hpp"
+
 #include <algorithm>
 
 namespace matador {
@@ -103,6 +105,29 @@ dialect_traits::identifier sqlite_dialect::identifier_escape_type() const
   return dialect_traits::ESCAPE_BOTH_SAME;
 }
 
+size_t sqlite_dialect::max_bind_count() const
+{
+  // SQLITE_MAX_VARIABLE_NUMBER of sqlite before 3.32
+  return 999;
+}
+
+std::string sqlite_dialect::date_literal(const matador::date &d) const
+{
+  if (binary_date_time_) {
+    return std::to_string(d.julian_date());
+  }
+  return basic_dialect::date_literal(d);
+}
+
+std::string sqlite_dialect::time_literal(const matador::time &t) const
+{
+  if (binary_date_time_) {
+    return std::to_string(epoch_micro_seconds(t));
+  }
+  return basic_dialect::time_literal(t);
+}
+
+
 }
 
 }
\ No newline at end of file
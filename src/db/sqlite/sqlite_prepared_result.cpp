@@ -1,4 +1,6 @@
 #include "matador/db/sqlite/sqlite_prepared_result.hpp"
+#include "matador/db/sqlite/sqlite_dialect.hpp"
+#include "matador/db/sqlite/sqlite_exception.hpp"
 
 #include "matador/utils/date.hpp"
 #include "matador/utils/time.hpp"
@@ -7,6 +9,7 @@
 #include "matador/utils/basic_identifier.hpp"
 
 #include <cstring>
+#include <sstream>
 
 #include <sqlite3.h>
 
@@ -15,11 +18,11 @@ namespace matador {
 namespace sqlite {
 
 sqlite_prepared_result::sqlite_prepared_result(sqlite3_stmt *stmt, int ret)
-  : ret_(ret)
+  : stmt_(stmt)
+  , ret_(ret)
   , first_(true)
   , rows(0)
-  , fields_(0)
-  , stmt_(stmt)
+  , fields_((size_type)sqlite3_column_count(stmt))
 {
 }
 
@@ -27,25 +30,23 @@ sqlite_prepared_result::~sqlite_prepared_result()
 {
 }
 
-const char* sqlite_prepared_result::column(size_type ) const
+const char* sqlite_prepared_result::column(size_type c) const
 {
-  return 0;
+  const char *val = (const char*)sqlite3_column_text(stmt_, (int)c);
+  // null values are returned as empty string
+  return val != nullptr ? val : "";
 }
 
 bool sqlite_prepared_result::fetch()
 {
-  if (!first_) {
-    // get next row
-    ret_ = sqlite3_step(stmt_);
-  } else {
-    first_ = false;
-  }
-  return !(ret_ == SQLITE_DONE || ret_ == SQLITE_OK);
-
+  return prepare_fetch();
 }
 
 sqlite_prepared_result::size_type sqlite_prepared_result::affected_rows() const
 {
+  if (stmt_ == nullptr) {
+    return 0;
+  }
   sqlite3 *db = sqlite3_db_handle(stmt_);
   return (size_type)sqlite3_changes(db);
 }
@@ -67,7 +68,13 @@ int sqlite_prepared_result::transform_index(int index) const
 
 void sqlite_prepared_result::serialize(const char *, char &x)
 {
-  x = (char)sqlite3_column_int(stmt_, result_index_++);
+  if (sqlite3_column_type(stmt_, result_index_) == SQLITE_TEXT) {
+    // direct sql statements store characters as text
+    const char *text = (const char*)sqlite3_column_text(stmt_, result_index_++);
+    x = text[0];
+  } else {
+    x = (char)sqlite3_column_int(stmt_, result_index_++);
+  }
 }
 
 void sqlite_prepared_result::serialize(const char *, short &x)
@@ -82,7 +89,7 @@ void sqlite_prepared_result::serialize(const char *, int &x)
 
 void sqlite_prepared_result::serialize(const char *, long &x)
 {
-  x = (long)sqlite3_column_int(stmt_, result_index_++);
+  x = (long)sqlite3_column_int64(stmt_, result_index_++);
 }
 
 void sqlite_prepared_result::serialize(const char *, unsigned char &x)
@@ -102,7 +109,7 @@ void sqlite_prepared_result::serialize(const char *, unsigned int &x)
 
 void sqlite_prepared_result::serialize(const char *, unsigned long &x)
 {
-  x = (unsigned long)sqlite3_column_int(stmt_, result_index_++);
+  x = (unsigned long)sqlite3_column_int64(stmt_, result_index_++);
 }
 
 void sqlite_prepared_result::serialize(const char *, bool &x)
@@ -124,14 +131,19 @@ void sqlite_prepared_result::serialize(const char *, std::string &x)
 {
   size_t s = (size_t)sqlite3_column_bytes(stmt_, result_index_);
   const char *text = (const char*)sqlite3_column_text(stmt_, result_index_++);
-  x.assign(text, s);
+  if (text == nullptr) {
+    x.clear();
+  } else {
+    x.assign(text, s);
+  }
 }
 
 void sqlite_prepared_result::serialize(const char *, varchar_base &x)
 {
   size_t s = (size_t)sqlite3_column_bytes(stmt_, result_index_);
   const char *text = (const char*)sqlite3_column_text(stmt_, result_index_++);
-  if (s == 0) {
+  if (text == nullptr || s == 0) {
+    x.assign("", 0);
   } else {
     x.assign(text, s);
   }
@@ -139,6 +151,11 @@ void sqlite_prepared_result::serialize(const char *, varchar_base &x)
 
 void sqlite_prepared_result::serialize(const char *, char *x, size_t s)
 {
+  if (sqlite3_column_type(stmt_, result_index_) == SQLITE_NULL) {
+    ++result_index_;
+    x[0] = '\0';
+    return;
+  }
   size_t size = (size_t)sqlite3_column_bytes(stmt_, result_index_);
   if (size < s) {
 #ifdef _MSC_VER
@@ -157,18 +174,34 @@ void sqlite_prepared_result::serialize(const char *, char *x, size_t s)
   }
 }
 
-void sqlite_prepared_result::serialize(const char *id, matador::date &x)
+void sqlite_prepared_result::serialize(const char *, matador::date &x)
 {
-  std::string val;
-  serialize(id, val);
-  x = matador::date::parse(val, date_format::ISO8601);
+  if (sqlite3_column_type(stmt_, result_index_) == SQLITE_INTEGER) {
+    x = matador::date((int)sqlite3_column_int64(stmt_, result_index_++));
+    return;
+  }
+  size_t s = (size_t)sqlite3_column_bytes(stmt_, result_index_);
+  const char *text = (const char*)sqlite3_column_text(stmt_, result_index_++);
+  if (text == nullptr || s == 0) {
+    x = matador::date();
+  } else {
+    from_iso8601(text, s, x);
+  }
 }
 
-void sqlite_prepared_result::serialize(const char *id, matador::time &x)
+void sqlite_prepared_result::serialize(const char *, matador::time &x)
 {
-  std::string val;
-  serialize(id, val);
-  x = matador::time::parse(val, "%Y-%m-%dT%T.%f");
+  if (sqlite3_column_type(stmt_, result_index_) == SQLITE_INTEGER) {
+    x = sqlite_dialect::from_epoch_micro_seconds(sqlite3_column_int64(stmt_, result_index_++));
+    return;
+  }
+  size_t s = (size_t)sqlite3_column_bytes(stmt_, result_index_);
+  const char *text = (const char*)sqlite3_column_text(stmt_, result_index_++);
+  if (text == nullptr || s == 0) {
+    x = matador::time();
+  } else {
+    from_iso8601(text, s, x);
+  }
 }
 
 void sqlite_prepared_result::serialize(const char *id, identifiable_holder &x, cascade_type)
@@ -185,11 +218,16 @@ bool sqlite_prepared_result::prepare_fetch()
 {
   if (!first_) {
     // get next row
-    ret_ = sqlite3_step(stmt_);
+    ret_ = (ret_ == SQLITE_ROW ? sqlite3_step(stmt_) : ret_);
   } else {
     first_ = false;
   }
-  return !(ret_ == SQLITE_DONE || ret_ == SQLITE_OK);
+  if (ret_ != SQLITE_ROW) {
+    throw_step_error();
+    return false;
+  }
+  ++rows;
+  return true;
 }
 
 bool sqlite_prepared_result::finalize_fetch()
@@ -197,6 +235,17 @@ bool sqlite_prepared_result::finalize_fetch()
   return true;
 }
 
+void sqlite_prepared_result::throw_step_error() const
+{
+  // busy, locked or any other error mustn't end the result silently
+  if (ret_ == SQLITE_ROW || ret_ == SQLITE_DONE) {
+    return;
+  }
+  std::stringstream msg;
+  msg << "sqlite3_step: " << sqlite3_errmsg(sqlite3_db_handle(stmt_));
+  throw sqlite_exception(msg.str());
+}
+
 }
 
 }
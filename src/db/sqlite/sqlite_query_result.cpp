@@ -0,0 +1,35 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/db/sqlite/sqlite_query_result.hpp"
+
+#include <sqlite3.h>
+
+namespace matador {
+
+namespace sqlite {
+
+sqlite_query_result::sqlite_query_result(sqlite3_stmt *stmt, int ret)
+  : sqlite_prepared_result(stmt, ret)
+{
+}
+
+sqlite_query_result::~sqlite_query_result()
+{
+  sqlite3_finalize(stmt_);
+}
+
+bool sqlite_query_result::finalize_fetch()
+{
+  // the object is read, so step ahead to the next row.
+  // A done statement releases its read lock
+  ret_ = sqlite3_step(stmt_);
+  throw_step_error();
+  first_ = true;
+  return true;
+}
+
+}
+
+}
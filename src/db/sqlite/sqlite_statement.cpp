@@ -19,6 +19,7 @@
 #include "matador/db/sqlite/sqlite_connection.hpp"
 #include "matador/db/sqlite/sqlite_exception.hpp"
 #include "matador/db/sqlite/sqlite_prepared_result.hpp"
+#include "matador/db/sqlite/sqlite_dialect.hpp"
 
 #include "matador/sql/row.hpp"
 
@@ -175,21 +176,36 @@ void sqlite_statement::serialize(const char*, varchar_base &x)
   throw_error(ret, db_.handle(), "sqlite3_bind_text");
 }
 
-void sqlite_statement::serialize(const char *id, matador::date &x)
+void sqlite_statement::serialize(const char *, matador::date &x)
 {
-  auto date_string = std::make_shared<std::string>(matador::to_string(x, date_format::ISO8601));
-  serialize(id, *date_string);
-  host_strings_.push_back(date_string);
-//  int ret = sqlite3_bind_int(stmt_, (int)++host_index, x.julian_date());
-//  throw_error(ret, db_.handle(), "sqlite3_bind_int");
+  if (binary_date_time()) {
+    int ret = sqlite3_bind_int64(stmt_, (int)++host_index, x.julian_date());
+    throw_error(ret, db_.handle(), "sqlite3_bind_int64");
+    return;
+  }
+  char buffer[iso8601::DATE_SIZE];
+  std::size_t len = to_iso8601(x, buffer);
+  int ret = sqlite3_bind_text(stmt_, (int)++host_index, buffer, (int)len, SQLITE_TRANSIENT);
+  throw_error(ret, db_.handle(), "sqlite3_bind_text");
+}
+
+void sqlite_statement::serialize(const char *, matador::time &x)
+{
+  if (binary_date_time()) {
+    int ret = sqlite3_bind_int64(stmt_, (int)++host_index, sqlite_dialect::epoch_micro_seconds(x));
+    throw_error(ret, db_.handle(), "sqlite3_bind_int64");
+    return;
+  }
+  char buffer[iso8601::TIME_SIZE];
+  std::size_t len = to_iso8601(x, buffer);
+  // sqlite copies the text into its reused value buffer
+  int ret = sqlite3_bind_text(stmt_, (int)++host_index, buffer, (int)len, SQLITE_TRANSIENT);
+  throw_error(ret, db_.handle(), "sqlite3_bind_text");
 }
 
-void sqlite_statement::serialize(const char *id, matador::time &x)
+bool sqlite_statement::binary_date_time() const
 {
-  // format time to ISO8601
-  auto time_string = std::make_shared<std::string>(matador::to_string(x, "%Y-%m-%dT%T.%f"));
-  serialize(id, *time_string);
-  host_strings_.push_back(time_string);
+  return static_cast<sqlite_dialect*>(db_.dialect())->stores_binary_date_time();
 }
 
 void sqlite_statement::serialize(const char *id, identifiable_holder &x, cascade_type)
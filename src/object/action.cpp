@@ -17,20 +17,10 @@
 
 #include "matador/object/action.hpp"
 #include "matador/object/object_store.hpp"
-#include "matador/object/object_serializer.hpp"
 
 namespace matador
 {
 
-action::action()
-  : serializer_(new object_serializer)
-{}
-
-action::~action()
-{
-  delete serializer_;
-}
-
 void action::remove_proxy(object_proxy *proxy, object_store *store)
 {
   store->remove_proxy(proxy);
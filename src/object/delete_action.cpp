@@ -40,14 +40,14 @@ object_proxy *delete_action::proxy() const
   return proxy_;
 }
 
-void delete_action::backup(byte_buffer &buffer)
+void delete_action::backup(byte_buffer &buffer, object_serializer &serializer)
 {
-  backup_func_(buffer, this, *serializer_);
+  backup_func_(buffer, this, serializer);
 }
 
-void delete_action::restore(byte_buffer &buffer, object_store *store)
+void delete_action::restore(byte_buffer &buffer, object_store *store, object_serializer &serializer)
 {
-  restore_func_(buffer, this, store, *serializer_);
+  restore_func_(buffer, this, store, serializer);
 }
 
 void delete_action::mark_deleted()
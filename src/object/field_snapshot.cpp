@@ -0,0 +1,42 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/object/field_snapshot.hpp"
+
+#include <cstring>
+
+namespace matador {
+
+namespace detail {
+
+std::vector<bool> field_snapshot::diff(const field_snapshot &current) const
+{
+  std::vector<bool> fields(current.ranges_.size(), true);
+  for (std::size_t i = 0; i < fields.size() && i < ranges_.size(); ++i) {
+    const std::size_t size = ranges_[i].second - ranges_[i].first;
+    const std::size_t current_size = current.ranges_[i].second - current.ranges_[i].first;
+    fields[i] = size != current_size ||
+                std::memcmp(buffer_->data() + ranges_[i].first, current.buffer_->data() + current.ranges_[i].first, size) != 0;
+  }
+  return fields;
+}
+
+bool field_snapshot::empty() const
+{
+  return ranges_.empty();
+}
+
+std::size_t field_snapshot::size() const
+{
+  return ranges_.size();
+}
+
+void field_snapshot::clear()
+{
+  buffer_ = nullptr;
+  ranges_.clear();
+}
+
+}
+}
@@ -0,0 +1,342 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/object/identifier_proxy_map.hpp"
+#include "matador/object/object_exception.hpp"
+
+#include "matador/utils/identifier.hpp"
+#include "matador/utils/serializer.hpp"
+
+#include <functional>
+
+namespace matador {
+
+namespace detail {
+
+namespace {
+
+/*
+ * Reads the raw value of an identifier. All
+ * identifiers are either integral or strings.
+ */
+class identifier_key_reader : public serializer
+{
+public:
+  explicit identifier_key_reader(identifier_key &key) : key_(key) {}
+
+  void serialize(const char *, char &x) override { integral(x); }
+  void serialize(const char *, short &x) override { integral(x); }
+  void serialize(const char *, int &x) override { integral(x); }
+  void serialize(const char *, long &x) override { integral(x); }
+  void serialize(const char *, unsigned char &x) override { integral(x); }
+  void serialize(const char *, unsigned short &x) override { integral(x); }
+  void serialize(const char *, unsigned int &x) override { integral(x); }
+  void serialize(const char *, unsigned long &x) override { integral(x); }
+  void serialize(const char *, bool &x) override { integral(x); }
+  void serialize(const char *, float &) override {}
+  void serialize(const char *, double &) override {}
+  void serialize(const char *, char *, size_t) override {}
+  void serialize(const char *, std::string &x) override { key_ = identifier_key::of(x); }
+  void serialize(const char *, matador::varchar_base &) override {}
+  void serialize(const char *, matador::time &) override {}
+  void serialize(const char *, matador::date &) override {}
+  void serialize(const char *, matador::basic_identifier &) override {}
+  void serialize(const char *, matador::identifiable_holder &, cascade_type) override {}
+
+private:
+  template < class T >
+  void integral(T x)
+  {
+    key_ = identifier_key::of(static_cast<std::uint64_t>(x));
+    key_.value_type = &typeid(T);
+  }
+
+private:
+  identifier_key &key_;
+};
+
+std::uint64_t mix(std::uint64_t x)
+{
+  // finalizer of splitmix64, spreads dense ids over all bits
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+}
+
+identifier_key identifier_key::of(const basic_identifier &id)
+{
+  identifier_key key;
+  identifier_key_reader reader(key);
+  const_cast<basic_identifier&>(id).serialize("", reader);
+  return key;
+}
+
+identifier_key identifier_key::of(std::uint64_t value)
+{
+  identifier_key key;
+  key.type = INTEGRAL;
+  key.value = value;
+  return key;
+}
+
+identifier_key identifier_key::of(const std::string &value)
+{
+  identifier_key key;
+  key.type = STRING;
+  key.value = std::hash<std::string>()(value);
+  key.str = &value;
+  return key;
+}
+
+std::pair<identifier_proxy_map::iterator, bool> identifier_proxy_map::insert(const value_type &value)
+{
+  return insert(identifier_key::of(*value.first), value);
+}
+
+std::pair<identifier_proxy_map::iterator, bool> identifier_proxy_map::insert(const identifier_key &key, const value_type &value)
+{
+  if (key.type == identifier_key::NONE) {
+    throw_object_exception("unsupported identifier type");
+  }
+  if (type_ == identifier_key::NONE) {
+    type_ = key.type;
+    value_type_ = key.value_type;
+  } else if (!is_same_type(key)) {
+    throw_object_exception("not the same type");
+  } else if (value_type_ == nullptr) {
+    value_type_ = key.value_type;
+  }
+
+  if ((size_ + deleted_ + 1) * 10 > slots_.size() * 7) {
+    // grow only if the deleted slots don't make enough room
+    rehash(slots_.empty() ? 16 : ((size_ + 1) * 2 > slots_.size() ? slots_.size() * 2 : slots_.size()));
+  }
+
+  const std::size_t mask = slots_.size() - 1;
+  std::size_t pos = home_of(key.value);
+  std::size_t free = slots_.size();
+  while (slots_[pos].state != EMPTY) {
+    if (slots_[pos].state == DELETED) {
+      if (free == slots_.size()) {
+        free = pos;
+      }
+    } else if (matches(slots_[pos], key)) {
+      return std::make_pair(iterator(&slots_[pos], slots_.data() + slots_.size()), false);
+    }
+    pos = (pos + 1) & mask;
+  }
+  if (free != slots_.size()) {
+    // reuse the first deleted slot of the probe sequence
+    pos = free;
+    --deleted_;
+  }
+  slots_[pos].state = OCCUPIED;
+  slots_[pos].key = key.value;
+  slots_[pos].entry = value;
+  ++size_;
+  return std::make_pair(iterator(&slots_[pos], slots_.data() + slots_.size()), true);
+}
+
+identifier_proxy_map::iterator identifier_proxy_map::find(const identifier_ptr &pk)
+{
+  return pk ? find(*pk) : end();
+}
+
+identifier_proxy_map::const_iterator identifier_proxy_map::find(const identifier_ptr &pk) const
+{
+  return pk ? find(*pk) : end();
+}
+
+identifier_proxy_map::iterator identifier_proxy_map::find(const basic_identifier &pk)
+{
+  return find(identifier_key::of(pk));
+}
+
+identifier_proxy_map::const_iterator identifier_proxy_map::find(const basic_identifier &pk) const
+{
+  return find(identifier_key::of(pk));
+}
+
+identifier_proxy_map::iterator identifier_proxy_map::find(const identifier_key &key)
+{
+  std::size_t pos = find_slot(key);
+  if (pos == slots_.size()) {
+    return end();
+  }
+  return iterator(&slots_[pos], slots_.data() + slots_.size());
+}
+
+identifier_proxy_map::const_iterator identifier_proxy_map::find(const identifier_key &key) const
+{
+  std::size_t pos = find_slot(key);
+  if (pos == slots_.size()) {
+    return end();
+  }
+  return const_iterator(&slots_[pos], slots_.data() + slots_.size());
+}
+
+object_proxy *identifier_proxy_map::find_proxy(std::uint64_t pk) const
+{
+  return find_proxy(identifier_key::of(pk));
+}
+
+object_proxy *identifier_proxy_map::find_proxy(const std::string &pk) const
+{
+  return find_proxy(identifier_key::of(pk));
+}
+
+object_proxy *identifier_proxy_map::find_proxy(const identifier_key &key) const
+{
+  std::size_t pos = find_slot(key);
+  return pos == slots_.size() ? nullptr : slots_[pos].entry.second;
+}
+
+std::size_t identifier_proxy_map::erase(const identifier_ptr &pk)
+{
+  return pk ? erase(*pk) : 0;
+}
+
+std::size_t identifier_proxy_map::erase(const basic_identifier &pk)
+{
+  std::size_t pos = find_slot(identifier_key::of(pk));
+  if (pos == slots_.size()) {
+    return 0;
+  }
+  erase_slot(pos);
+  return 1;
+}
+
+void identifier_proxy_map::erase(iterator i)
+{
+  erase_slot(static_cast<std::size_t>(i.current_ - slots_.data()));
+}
+
+void identifier_proxy_map::clear()
+{
+  slots_.clear();
+  size_ = 0;
+  deleted_ = 0;
+  type_ = identifier_key::NONE;
+  value_type_ = nullptr;
+}
+
+void identifier_proxy_map::reserve(std::size_t size)
+{
+  std::size_t capacity = slots_.empty() ? 16 : slots_.size();
+  while (size * 10 > capacity * 7) {
+    capacity *= 2;
+  }
+  if (size > 0 && capacity > slots_.size()) {
+    rehash(capacity);
+  }
+}
+
+std::size_t identifier_proxy_map::size() const
+{
+  return size_;
+}
+
+bool identifier_proxy_map::empty() const
+{
+  return size_ == 0;
+}
+
+identifier_proxy_map::iterator identifier_proxy_map::begin()
+{
+  return iterator(slots_.data(), slots_.data() + slots_.size());
+}
+
+identifier_proxy_map::iterator identifier_proxy_map::end()
+{
+  return iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size());
+}
+
+identifier_proxy_map::const_iterator identifier_proxy_map::begin() const
+{
+  return const_iterator(slots_.data(), slots_.data() + slots_.size());
+}
+
+identifier_proxy_map::const_iterator identifier_proxy_map::end() const
+{
+  return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size());
+}
+
+std::size_t identifier_proxy_map::find_slot(const identifier_key &key) const
+{
+  if (size_ == 0 || !is_same_type(key)) {
+    return slots_.size();
+  }
+  const std::size_t mask = slots_.size() - 1;
+  std::size_t pos = home_of(key.value);
+  while (slots_[pos].state != EMPTY) {
+    if (slots_[pos].state == OCCUPIED && matches(slots_[pos], key)) {
+      return pos;
+    }
+    pos = (pos + 1) & mask;
+  }
+  return slots_.size();
+}
+
+std::size_t identifier_proxy_map::home_of(std::uint64_t key) const
+{
+  return static_cast<std::size_t>(mix(key)) & (slots_.size() - 1);
+}
+
+bool identifier_proxy_map::is_same_type(const identifier_key &key) const
+{
+  if (key.type != type_) {
+    return false;
+  }
+  // a raw integral value matches any integral type
+  return key.value_type == nullptr || value_type_ == nullptr ||
+         key.value_type == value_type_ || *key.value_type == *value_type_;
+}
+
+bool identifier_proxy_map::matches(const slot &s, const identifier_key &key) const
+{
+  if (s.key != key.value) {
+    return false;
+  }
+  if (key.type == identifier_key::INTEGRAL) {
+    return true;
+  }
+  // equal hashes, compare the strings
+  return static_cast<const identifier<std::string>&>(*s.entry.first).reference() == *key.str;
+}
+
+void identifier_proxy_map::erase_slot(std::size_t pos)
+{
+  // leave a deleted marker, the probe sequences
+  // of the following entries pass over it
+  slots_[pos].entry = t_entry();
+  slots_[pos].state = DELETED;
+  --size_;
+  ++deleted_;
+}
+
+void identifier_proxy_map::rehash(std::size_t capacity)
+{
+  t_slot_vector slots(capacity);
+  slots_.swap(slots);
+  deleted_ = 0;
+  const std::size_t mask = slots_.size() - 1;
+  for (auto &s : slots) {
+    if (s.state != OCCUPIED) {
+      continue;
+    }
+    std::size_t pos = home_of(s.key);
+    while (slots_[pos].state != EMPTY) {
+      pos = (pos + 1) & mask;
+    }
+    slots_[pos] = std::move(s);
+  }
+}
+
+}
+}
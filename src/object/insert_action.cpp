@@ -79,7 +79,7 @@ insert_action::iterator insert_action::erase(insert_action::iterator i)
   return object_proxy_list_.erase(i);
 }
 
-void insert_action::restore(byte_buffer &, object_store *store)
+void insert_action::restore(byte_buffer &, object_store *store, object_serializer &)
 {
   // remove objects from object store
   for (insert_action::iterator i = begin(); i != end(); ++i) {
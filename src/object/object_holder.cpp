@@ -69,7 +69,7 @@ object_holder::~object_holder()
      * if proxy was created temporary
      * we can delete it here
      */
-    if (!proxy_->ostore() && proxy_->ptr_set_.empty()) {
+    if (!proxy_->ostore() && !proxy_->has_holders()) {
       delete proxy_;
     }
   }
@@ -160,7 +160,7 @@ const void*object_holder::ptr() const
 
 void* object_holder::lookup_object()
 {
-  if (proxy_ && proxy_->obj()) {
+  if (proxy_ && proxy_->load()) {
     if (proxy_->ostore()) {
       // Todo: callback to object store
 //      proxy_->ostore()->mark_modified(proxy_);
@@ -173,7 +173,7 @@ void* object_holder::lookup_object()
 
 void*object_holder::lookup_object() const
 {
-  return proxy_ ? proxy_->obj() : nullptr;
+  return proxy_ && proxy_->load() ? proxy_->obj() : nullptr;
 }
 
 bool object_holder::is_belongs_to() const
@@ -257,7 +257,7 @@ void object_holder::reset(object_proxy *proxy, cascade_type cascade, bool notify
      * if proxy was created temporary
      * we can delete it here
      */
-    if (proxy_ && !proxy_->ostore() && proxy_->ptr_set_.empty()) {
+    if (proxy_ && !proxy_->ostore() && !proxy_->has_holders()) {
       delete proxy_;
     }
   }
@@ -0,0 +1,118 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/object/object_id_map.hpp"
+
+namespace matador {
+
+namespace detail {
+
+const std::size_t object_id_map::PAGE_SIZE;
+
+object_proxy *object_id_map::insert(unsigned long id, object_proxy *proxy)
+{
+  if (!overflow_.empty()) {
+    // the id may have been put aside before
+    // the directory covered its page
+    auto i = overflow_.find(id);
+    if (i != overflow_.end()) {
+      return i->second;
+    }
+  }
+  const std::size_t page_index = id / PAGE_SIZE;
+  if (!in_directory(page_index)) {
+    overflow_.insert(std::make_pair(id, proxy));
+    ++size_;
+    return proxy;
+  }
+
+  if (page_index >= pages_.size()) {
+    pages_.resize(page_index + 1);
+  }
+  std::unique_ptr<page> &p = pages_[page_index];
+  if (!p) {
+    p.reset(new page);
+    ++page_count_;
+  }
+  object_proxy *&slot = p->proxies[id % PAGE_SIZE];
+  if (slot == nullptr) {
+    slot = proxy;
+    ++p->size;
+    ++size_;
+  }
+  return slot;
+}
+
+object_proxy *object_id_map::find(unsigned long id) const
+{
+  const std::size_t page_index = id / PAGE_SIZE;
+  if (page_index < pages_.size() && pages_[page_index]) {
+    object_proxy *proxy = pages_[page_index]->proxies[id % PAGE_SIZE];
+    if (proxy != nullptr) {
+      return proxy;
+    }
+  }
+  if (overflow_.empty()) {
+    return nullptr;
+  }
+  auto i = overflow_.find(id);
+  return i != overflow_.end() ? i->second : nullptr;
+}
+
+std::size_t object_id_map::erase(unsigned long id)
+{
+  const std::size_t page_index = id / PAGE_SIZE;
+  if (page_index < pages_.size() && pages_[page_index]) {
+    std::unique_ptr<page> &p = pages_[page_index];
+    object_proxy *&slot = p->proxies[id % PAGE_SIZE];
+    if (slot != nullptr) {
+      slot = nullptr;
+      --size_;
+      if (--p->size == 0) {
+        p.reset();
+        --page_count_;
+      }
+      return 1;
+    }
+  }
+  std::size_t count = overflow_.erase(id);
+  size_ -= count;
+  return count;
+}
+
+void object_id_map::clear()
+{
+  pages_.clear();
+  page_count_ = 0;
+  overflow_.clear();
+  size_ = 0;
+}
+
+std::size_t object_id_map::size() const
+{
+  return size_;
+}
+
+bool object_id_map::empty() const
+{
+  return size_ == 0;
+}
+
+std::size_t object_id_map::page_count() const
+{
+  return page_count_;
+}
+
+bool object_id_map::in_directory(std::size_t page_index) const
+{
+  if (page_index < pages_.size()) {
+    return true;
+  }
+  // grow the directory only up to a multiple
+  // of the pages needed for the current size
+  return page_index < 16 * (size_ / PAGE_SIZE + 1) + 256;
+}
+
+}
+}
@@ -0,0 +1,72 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/object/object_index.hpp"
+
+namespace matador {
+
+namespace detail {
+
+basic_object_index::basic_object_index(const std::string &field, index_type type)
+  : field_(field)
+  , type_(type)
+{}
+
+basic_object_index::~basic_object_index()
+{}
+
+const std::string &basic_object_index::field() const
+{
+  return field_;
+}
+
+index_type basic_object_index::type() const
+{
+  return type_;
+}
+
+void basic_object_index::insert(object_proxy *proxy)
+{
+  if (proxy->obj() == nullptr) {
+    // not loaded yet, index it on next lookup
+    modified_.insert(proxy);
+  } else {
+    insert_key(proxy);
+  }
+}
+
+void basic_object_index::remove(object_proxy *proxy)
+{
+  modified_.erase(proxy);
+  remove_key(proxy);
+}
+
+void basic_object_index::mark_modified(object_proxy *proxy)
+{
+  if (modified_.insert(proxy).second) {
+    remove_key(proxy);
+  }
+}
+
+void basic_object_index::clear()
+{
+  modified_.clear();
+  clear_keys();
+}
+
+void basic_object_index::refresh()
+{
+  auto i = modified_.begin();
+  while (i != modified_.end()) {
+    if ((*i)->obj() == nullptr) {
+      ++i;
+      continue;
+    }
+    insert_key(*i);
+    i = modified_.erase(i);
+  }
+}
+
+}
+}
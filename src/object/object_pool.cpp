@@ -0,0 +1,121 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/object/object_pool.hpp"
+
+#include <new>
+
+namespace matador {
+
+namespace detail {
+
+object_pool::object_pool(std::size_t element_size, std::size_t elements_per_slab)
+  : elements_per_slab_(elements_per_slab > 0 ? elements_per_slab : 1)
+{
+  // keep every element aligned like memory returned by new
+  const std::size_t alignment = alignof(std::max_align_t);
+  element_size = element_size < sizeof(free_element) ? sizeof(free_element) : element_size;
+  element_size_ = (element_size + alignment - 1) / alignment * alignment;
+}
+
+object_pool::~object_pool()
+{
+  free_slabs();
+}
+
+void *object_pool::allocate()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  void *p = nullptr;
+  if (free_ != nullptr) {
+    p = free_;
+    free_ = free_->next;
+  } else {
+    if (next_ == end_) {
+      add_slab();
+    }
+    p = next_;
+    next_ += element_size_;
+  }
+  ++size_;
+  return p;
+}
+
+void object_pool::deallocate(void *p)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto *element = static_cast<free_element*>(p);
+  element->next = free_;
+  free_ = element;
+  --size_;
+}
+
+bool object_pool::owns(const void *p) const
+{
+  const char *address = static_cast<const char*>(p);
+  const std::size_t slab_size = element_size_ * elements_per_slab_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto slab : slabs_) {
+    if (address >= slab && address < slab + slab_size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool object_pool::release()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (size_ > 0) {
+    return false;
+  }
+  free_slabs();
+  return true;
+}
+
+std::size_t object_pool::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+std::size_t object_pool::slab_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slabs_.size();
+}
+
+std::size_t object_pool::element_size() const
+{
+  return element_size_;
+}
+
+std::size_t object_pool::elements_per_slab() const
+{
+  return elements_per_slab_;
+}
+
+void object_pool::add_slab()
+{
+  const std::size_t slab_size = element_size_ * elements_per_slab_;
+  char *slab = static_cast<char*>(::operator new(slab_size));
+  slabs_.push_back(slab);
+  next_ = slab;
+  end_ = slab + slab_size;
+}
+
+void object_pool::free_slabs()
+{
+  for (auto slab : slabs_) {
+    ::operator delete(slab);
+  }
+  slabs_.clear();
+  free_ = nullptr;
+  next_ = nullptr;
+  end_ = nullptr;
+  size_ = 0;
+}
+
+}
+}
@@ -21,6 +21,15 @@ using namespace std;
 
 namespace matador {
 
+namespace {
+
+// every object_proxy is preceded by the slab allocator
+// it was allocated from or nullptr if it is on the heap
+const std::size_t proxy_header_size = alignof(object_proxy) > sizeof(detail::object_pool*)
+                                    ? alignof(object_proxy) : sizeof(detail::object_pool*);
+
+}
+
 object_proxy::object_proxy(const std::shared_ptr<basic_identifier> &pk)
   : primary_key_(pk)
 {}
@@ -32,17 +41,69 @@ object_proxy::~object_proxy()
 //    ostore_->delete_proxy(id());
   }
   if (obj_) {
-    deleter_(obj_);
+    ops_->destroy(obj_, object_pool_);
   }
   ostore_ = nullptr;
-  for (auto &ptr : ptr_set_) {
+  object_holder *ptr = holders_;
+  while (ptr) {
+    object_holder *next = ptr->next_holder_;
     ptr->proxy_ = nullptr;
+    ptr->prev_holder_ = nullptr;
+    ptr->next_holder_ = nullptr;
+    ptr = next;
   }
 }
 
+void *object_proxy::operator new(std::size_t size)
+{
+  return object_proxy::operator new(size, nullptr);
+}
+
+void *object_proxy::operator new(std::size_t size, detail::object_pool *pool)
+{
+  char *element = static_cast<char*>(pool == nullptr ? ::operator new(size + proxy_header_size) : pool->allocate());
+  *reinterpret_cast<detail::object_pool**>(element) = pool;
+  return element + proxy_header_size;
+}
+
+void object_proxy::operator delete(void *p)
+{
+  if (p == nullptr) {
+    return;
+  }
+  char *element = static_cast<char*>(p) - proxy_header_size;
+  detail::object_pool *pool = *reinterpret_cast<detail::object_pool**>(element);
+  if (pool == nullptr) {
+    ::operator delete(element);
+  } else {
+    pool->deallocate(element);
+  }
+}
+
+void object_proxy::operator delete(void *p, detail::object_pool *)
+{
+  // the pool is already stored in front of the proxy
+  object_proxy::operator delete(p);
+}
+
+std::size_t object_proxy::allocation_size()
+{
+  return sizeof(object_proxy) + proxy_header_size;
+}
+
+void object_proxy::object_allocator(detail::object_pool *pool)
+{
+  object_pool_ = pool;
+}
+
+detail::object_pool *object_proxy::object_allocator() const
+{
+  return object_pool_;
+}
+
 const char *object_proxy::classname() const
 {
-  return namer_();
+  return ops_->name();
 }
 
 object_store *object_proxy::ostore() const
@@ -55,6 +116,14 @@ prototype_node *object_proxy::node() const
   return node_;
 }
 
+bool object_proxy::load()
+{
+  if (obj_ == nullptr && node_ != nullptr && primary_key_) {
+    node_->load(this);
+  }
+  return obj_ != nullptr;
+}
+
 void object_proxy::link(object_proxy *successor)
 {
   // link serializable proxy before this node_
@@ -125,12 +194,35 @@ unsigned long object_proxy::reference_count() const
 
 void object_proxy::add(object_holder *ptr)
 {
-  ptr_set_.insert(ptr);
+  ptr->prev_holder_ = nullptr;
+  ptr->next_holder_ = holders_;
+  if (holders_) {
+    holders_->prev_holder_ = ptr;
+  }
+  holders_ = ptr;
 }
 
 bool object_proxy::remove(object_holder *ptr)
 {
-  return ptr_set_.erase(ptr) == 1;
+  if (ptr->prev_holder_) {
+    ptr->prev_holder_->next_holder_ = ptr->next_holder_;
+  } else if (holders_ == ptr) {
+    holders_ = ptr->next_holder_;
+  } else {
+    // holder isn't linked to this proxy
+    return false;
+  }
+  if (ptr->next_holder_) {
+    ptr->next_holder_->prev_holder_ = ptr->prev_holder_;
+  }
+  ptr->prev_holder_ = nullptr;
+  ptr->next_holder_ = nullptr;
+  return true;
+}
+
+bool object_proxy::has_holders() const
+{
+  return holders_ != nullptr;
 }
 
 bool object_proxy::valid() const
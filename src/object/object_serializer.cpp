@@ -50,10 +50,7 @@ void object_serializer::serialize(const char *, std::string &s)
   if (restore) {
     size_t len = 0;
     buffer_->release(&len, sizeof(len));
-    char *str = new char[len];
-    buffer_->release(str, len);
-    s.assign(str, len);
-    delete [] str;
+    s.assign(buffer_->view(len), len);
   } else {
     size_t len = s.size();
 
@@ -141,7 +141,16 @@ prototype_node* object_store::clear(prototype_node *node)
 
 size_t object_store::size() const
 {
-  return (size_t) (std::distance(begin(), end()));
+  return prototype_map_.size();
+}
+
+std::map<std::string, size_t> object_store::object_counts() const
+{
+  std::map<std::string, size_t> counts;
+  for (auto &&node : prototype_map_) {
+    counts.insert(std::make_pair(node.first, (size_t)node.second->size()));
+  }
+  return counts;
 }
 
 bool object_store::empty() const
@@ -207,23 +216,18 @@ void object_store::dump_objects(std::ostream &out) const
 
 object_proxy* object_store::find_proxy(unsigned long id) const
 {
-  t_object_proxy_map::const_iterator i = object_map_.find(id);
-  if (i == object_map_.end()) {
-    return nullptr;
-  } else {
-    return i->second;
-  }
+  return object_map_.find(id);
 }
 
 bool object_store::delete_proxy(unsigned long id)
 {
-  t_object_proxy_map::iterator i = object_map_.find(id);
-  if (i == object_map_.end()) {
+  object_proxy *proxy = object_map_.find(id);
+  if (proxy == nullptr) {
     return false;
-  } else if (i->second->linked()) {
+  } else if (proxy->linked()) {
     return false;
   } else {
-    object_map_.erase(i);
+    object_map_.erase(id);
     return true;
   }
 }
@@ -246,7 +250,7 @@ object_proxy* object_store::insert_proxy(object_proxy *proxy)
 
   node->insert(proxy);
 
-  return object_map_.insert(std::make_pair(proxy->id(), proxy)).first->second;
+  return object_map_.insert(proxy->id(), proxy);
 }
 
 void object_store::remove_proxy(object_proxy *proxy)
@@ -280,7 +284,7 @@ object_proxy* object_store::register_proxy(object_proxy *oproxy)
 
   oproxy->id(seq_.next());
 
-  return object_map_.insert(std::make_pair(oproxy->id(), oproxy)).first->second;
+  return object_map_.insert(oproxy->id(), oproxy);
 }
 
 sequencer_impl_ptr object_store::exchange_sequencer(const sequencer_impl_ptr &seq)
@@ -409,5 +413,9 @@ bool object_store::has_transaction() const
   return !transactions_.empty();
 }
 
+void object_store::forget_misses()
+{
+  ++miss_generation_;
+}
 
 }
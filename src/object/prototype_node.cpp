@@ -18,6 +18,8 @@
 #include "matador/object/prototype_node.hpp"
 #include "matador/object/object_exception.hpp"
 #include "matador/object/object_proxy.hpp"
+#include "matador/object/object_index.hpp"
+#include "matador/object/object_store.hpp"
 
 #include <algorithm>
 
@@ -55,6 +57,12 @@ prototype_node::size() const
   return count;
 }
 
+unsigned long
+prototype_node::subtree_size() const
+{
+  return subtree_count;
+}
+
 const char *prototype_node::type() const
 {
   return type_.c_str();
@@ -125,6 +133,11 @@ void prototype_node::insert(prototype_node *child)
 
 void prototype_node::insert(object_proxy *proxy)
 {
+  // find primary key
+  std::shared_ptr<basic_identifier> pk(proxy->primary_key_);
+  if (pk && pk->is_valid() && id_map_.find(pk) != id_map_.end()) {
+    throw_object_exception("object of type " << type_ << " with primary key " << *pk << " already exists");
+  }
   // check count of serializable in subtree
   if (count >= 2) {
 
@@ -152,11 +165,14 @@ void prototype_node::insert(object_proxy *proxy)
   proxy->node_ = this;
   // adjust size
   ++count;
-  // find and insert primary key
-  std::shared_ptr<basic_identifier> pk(proxy->primary_key_);
+  for (prototype_node *node = this; node != nullptr; node = node->parent) {
+    ++node->subtree_count;
+  }
+  // insert primary key
   if (pk) {
     id_map_.insert(std::make_pair(pk, proxy));
   }
+  insert_into_indexes(proxy);
 }
 
 void prototype_node::remove(object_proxy *proxy)
@@ -185,8 +201,13 @@ void prototype_node::remove(object_proxy *proxy)
     }
   }
 
+  remove_from_indexes(proxy);
+
   // adjust serializable count for node
   --count;
+  for (prototype_node *node = this; node != nullptr; node = node->parent) {
+    --node->subtree_count;
+  }
 }
 
 void prototype_node::clear(bool recursive)
@@ -197,15 +218,31 @@ void prototype_node::clear(bool recursive)
 
     while (op_first->next() != op_marker) {
       object_proxy *op = op_first->next_;
+      remove_from_indexes(op);
       // remove serializable proxy from list
       op->unlink();
       // delete serializable proxy and serializable
       delete op;
     }
     id_map_.clear();
+    for (prototype_node *node = this; node != nullptr; node = node->parent) {
+      node->subtree_count -= count;
+    }
     count = 0;
   }
 
+  // give the slabs back at once unless
+  // objects are still held elsewhere
+  if (object_allocator_ && object_allocator_->release()) {
+    // tags of freed objects must not match
+    // later heap objects at the same address
+    std::lock_guard<std::mutex> lock(created_mutex_);
+    created_.clear();
+  }
+  if (proxy_allocator_) {
+    proxy_allocator_->release();
+  }
+
   if (recursive) {
     prototype_node *current = first->next;
 
@@ -225,6 +262,39 @@ void prototype_node::unlink()
   prev = 0;
 }
 
+void prototype_node::enable_slab_allocation(std::size_t object_size, std::size_t objects_per_slab)
+{
+  if (!empty(true)) {
+    throw_object_exception("prototype node " << type_ << " isn't empty");
+  }
+  object_allocator_.reset(new detail::object_pool(object_size, objects_per_slab));
+  proxy_allocator_.reset(new detail::object_pool(object_proxy::allocation_size(), objects_per_slab));
+}
+
+bool prototype_node::has_slab_allocation() const
+{
+  return object_allocator_ != nullptr;
+}
+
+bool prototype_node::adopt(const void *obj)
+{
+  if (!object_allocator_) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(created_mutex_);
+  return created_.erase(obj) > 0;
+}
+
+detail::object_pool *prototype_node::object_allocator() const
+{
+  return object_allocator_.get();
+}
+
+detail::object_pool *prototype_node::proxy_allocator() const
+{
+  return proxy_allocator_.get();
+}
+
 prototype_node* prototype_node::next_node() const
 {
   // if we have a child, child is the next iterator to return
@@ -341,13 +411,93 @@ std::type_index prototype_node::type_index() const
 
 object_proxy *prototype_node::find_proxy(const std::shared_ptr<basic_identifier> &pk)
 {
-  auto i = std::find_if(id_map_.begin(), id_map_.end(), [pk](const detail::t_identifier_map::value_type &x) {
-    return *pk == *(x.first);
-  });
-//  t_primary_key_map::iterator i = primary_key_map.find(pk);
+  auto i = id_map_.find(pk);
   return (i != id_map_.end() ? i->second : nullptr);
 }
 
+object_proxy *prototype_node::find_proxy(unsigned long pk) const
+{
+  return id_map_.find_proxy(static_cast<std::uint64_t>(pk));
+}
+
+object_proxy *prototype_node::find_proxy(const std::string &pk) const
+{
+  return id_map_.find_proxy(pk);
+}
+
+object_proxy *prototype_node::find_proxy(const detail::identifier_key &key) const
+{
+  return id_map_.find_proxy(key);
+}
+
+void prototype_node::add_index(detail::basic_object_index *index)
+{
+  std::unique_ptr<detail::basic_object_index> idx(index);
+  if (indexes_.find(idx->field()) != indexes_.end()) {
+    throw_object_exception("index for field " << idx->field() << " of type " << type_ << " already exists");
+  }
+  // index all objects of this node and its children
+  for (object_proxy *proxy = op_first->next(); proxy != op_last; proxy = proxy->next()) {
+    idx->insert(proxy);
+  }
+  indexes_.insert(std::make_pair(idx->field(), std::move(idx)));
+}
+
+detail::basic_object_index *prototype_node::find_index(const std::string &field) const
+{
+  auto i = indexes_.find(field);
+  return (i != indexes_.end() ? i->second.get() : nullptr);
+}
+
+void prototype_node::mark_modified(object_proxy *proxy)
+{
+  for (prototype_node *node = this; node != nullptr; node = node->parent) {
+    for (auto &index : node->indexes_) {
+      index.second->mark_modified(proxy);
+    }
+  }
+}
+
+void prototype_node::insert_into_indexes(object_proxy *proxy)
+{
+  for (prototype_node *node = this; node != nullptr; node = node->parent) {
+    for (auto &index : node->indexes_) {
+      index.second->insert(proxy);
+    }
+  }
+}
+
+void prototype_node::remove_from_indexes(object_proxy *proxy)
+{
+  for (prototype_node *node = this; node != nullptr; node = node->parent) {
+    for (auto &index : node->indexes_) {
+      index.second->remove(proxy);
+    }
+  }
+}
+
+void prototype_node::object_loader(const t_object_loader &loader)
+{
+  object_loader_ = loader;
+}
+
+bool prototype_node::load(object_proxy *proxy)
+{
+  if (!object_loader_) {
+    return false;
+  }
+  // a remembered miss isn't selected again
+  // until the store forgets its misses
+  if (proxy->miss_generation_ == tree_->miss_generation_) {
+    return false;
+  }
+  if (!object_loader_(proxy)) {
+    proxy->miss_generation_ = tree_->miss_generation_;
+    return false;
+  }
+  return true;
+}
+
 void prototype_node::register_relation_endpoint(const std::type_index &tindex,
                                                 const std::shared_ptr<detail::basic_relation_endpoint> &endpoint)
 {
@@ -21,6 +21,16 @@ void transaction::null_observer::visit(delete_action *act)
   act->mark_deleted();
 }
 
+transaction::transaction_data::transaction_data(object_store &store, std::shared_ptr<observer> obsrvr)
+  : store_(store)
+  , inserter_(actions_)
+  , serializer_(new object_serializer)
+  , observer_(obsrvr)
+  , id_(transaction::sequencer_.next())
+{}
+
+transaction::transaction_data::~transaction_data() = default;
+
 transaction::transaction(matador::object_store &store)
   : transaction(store, std::make_shared<null_observer>())
 {}
@@ -76,12 +86,22 @@ void transaction::rollback()
      * clear insert action map
      *
      **************/
-    while (!transaction_data_->actions_.empty()) {
-      action_iterator i = transaction_data_->actions_.begin();
-      action_ptr a = *i;
-      transaction_data_->actions_.erase(i);
-      restore(a);
+    // the undo log is replayed from the first change
+    // to the last like the changes were recorded. A
+    // restored has_many owner relies on its items
+    // being restored afterwards. Each record reads its
+    // backup from its range of the object buffer.
+    // Records added while restoring are restored as well.
+    object_store *store = &transaction_data_->store_.get();
+    byte_buffer &buffer = transaction_data_->object_buffer_;
+    t_undo_log &undo_log = transaction_data_->undo_log_;
+    for (t_undo_log::size_type i = 0; i < undo_log.size(); ++i) {
+      undo_record rec = undo_log[i];
+      buffer.rewind(rec.begin, rec.end);
+      rec.act->restore(buffer, store, *transaction_data_->serializer_);
     }
+    // restored objects may be the ones missed references point to
+    store->forget_misses();
 
     if (commiting_) {
       transaction_data_->observer_->on_rollback();
@@ -95,19 +115,22 @@ void transaction::rollback()
 
 void transaction::backup(const action_ptr &a, const matador::object_proxy *proxy)
 {
-  a->backup(transaction_data_->object_buffer_);
+  byte_buffer::size_type begin = transaction_data_->object_buffer_.size();
+  a->backup(transaction_data_->object_buffer_, *transaction_data_->serializer_);
+  log(a, begin);
   transaction_data_->actions_.push_back(a);
   transaction_data_->id_action_index_map_.insert(std::make_pair(proxy->id(), transaction_data_->actions_.size() - 1));
 }
 
-void transaction::restore(const action_ptr &a)
+void transaction::log(const action_ptr &a, byte_buffer::size_type begin)
 {
-  a->restore(transaction_data_->object_buffer_, &transaction_data_->store_.get());
+  transaction_data_->undo_log_.emplace_back(a, begin, transaction_data_->object_buffer_.size());
 }
 
 void transaction::cleanup()
 {
   transaction_data_->actions_.clear();
+  transaction_data_->undo_log_.clear();
   transaction_data_->object_buffer_.clear();
   transaction_data_->id_action_index_map_.clear();
   transaction_data_->store_.get().pop_transaction();
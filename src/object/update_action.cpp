@@ -4,6 +4,7 @@
 
 #include "matador/object/update_action.hpp"
 #include "matador/object/action_visitor.hpp"
+#include "matador/object/object_proxy.hpp"
 
 namespace matador {
 
@@ -22,19 +23,40 @@ const object_proxy* update_action::proxy() const
   return proxy_;
 }
 
-void update_action::backup(byte_buffer &buffer)
+void update_action::backup(byte_buffer &buffer, object_serializer &serializer)
 {
-  backup_func_(buffer, this, *serializer_);
+  backup_func_(buffer, this, serializer);
 }
 
-void update_action::restore(byte_buffer &buffer, object_store *store)
+void update_action::restore(byte_buffer &buffer, object_store *store, object_serializer &serializer)
 {
-  restore_func_(buffer, this, store, *serializer_);
+  if (deleted_) {
+    // the backup was taken by this action
+    // but the object is restored as deleted
+    delete_action_->restore(buffer, store, serializer);
+    return;
+  }
+  restore_func_(buffer, this, store, serializer);
+  // restored values must be reindexed
+  if (proxy_->node()) {
+    proxy_->node()->mark_modified(proxy_);
+  }
 }
 
-delete_action *update_action::release_delete_action()
+std::shared_ptr<delete_action> update_action::release_delete_action()
 {
-  return delete_action_.release();
+  deleted_ = true;
+  return delete_action_;
 }
 
-}
\ No newline at end of file
+const detail::field_snapshot& update_action::snapshot() const
+{
+  return snapshot_;
+}
+
+bool update_action::is_backup_before_change() const
+{
+  return backup_before_change_;
+}
+
+}
@@ -21,11 +21,66 @@ std::string basic_table::name() const
   return node_.type();
 }
 
+void basic_table::fetch(connection &)
+{}
+
+void basic_table::merge(connection &conn, object_store &p)
+{
+  load(conn, p);
+}
+
+bool basic_table::load(connection &, object_store &, object_proxy *)
+{
+  return false;
+}
+
+bool basic_table::load(connection &conn, object_store &p, object_proxy *proxy, fetch_type)
+{
+  return load(conn, p, proxy);
+}
+
+std::size_t basic_table::load(connection &conn, object_store &p, std::shared_ptr<basic_identifier> &, std::size_t)
+{
+  if (!is_loaded_) {
+    load(conn, p);
+  }
+  return 0;
+}
+
+void basic_table::load_items(connection &conn, object_store &p, const std::shared_ptr<basic_identifier> &)
+{
+  if (!is_loaded_) {
+    load(conn, p);
+  }
+}
+
+void basic_table::insert(connection &conn, t_proxy_iterator first, t_proxy_iterator last)
+{
+  while (first != last) {
+    insert(conn, *first++);
+  }
+}
+
+void basic_table::update(connection &conn, object_proxy *proxy, const detail::field_snapshot &)
+{
+  update(conn, proxy);
+}
+
 bool basic_table::is_loaded() const
 {
   return is_loaded_;
 }
 
+void basic_table::batch_size(std::size_t size)
+{
+  batch_size_ = size;
+}
+
+std::size_t basic_table::batch_size() const
+{
+  return batch_size_;
+}
+
 prototype_node &basic_table::node()
 {
   return node_;
@@ -62,11 +117,22 @@ basic_table::insert_proxy(const std::shared_ptr<basic_identifier> &pk, object_pr
   return identifier_proxy_map_.insert(std::make_pair(pk, proxy)).first;
 }
 
+detail::t_identifier_map::iterator
+basic_table::insert_proxy(const detail::identifier_key &key, const std::shared_ptr<basic_identifier> &pk, object_proxy *proxy)
+{
+  return identifier_proxy_map_.insert(key, std::make_pair(pk, proxy)).first;
+}
+
 detail::t_identifier_map::iterator basic_table::find_proxy(const std::shared_ptr<basic_identifier> &pk)
 {
   return identifier_proxy_map_.find(pk);
 }
 
+detail::t_identifier_map::iterator basic_table::find_proxy(const detail::identifier_key &key)
+{
+  return identifier_proxy_map_.find(key);
+}
+
 detail::t_identifier_map::iterator basic_table::begin_proxy()
 {
   return identifier_proxy_map_.begin();
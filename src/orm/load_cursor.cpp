@@ -0,0 +1,46 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/orm/load_cursor.hpp"
+
+namespace matador {
+
+load_cursor::load_cursor(std::string table)
+  : table_(std::move(table))
+{}
+
+std::string load_cursor::table() const
+{
+  return table_;
+}
+
+std::size_t load_cursor::rows() const
+{
+  return rows_;
+}
+
+std::size_t load_cursor::chunks() const
+{
+  return chunks_;
+}
+
+bool load_cursor::finished() const
+{
+  return finished_;
+}
+
+std::shared_ptr<basic_identifier> load_cursor::last() const
+{
+  return last_;
+}
+
+void load_cursor::reset()
+{
+  last_.reset();
+  rows_ = 0;
+  chunks_ = 0;
+  finished_ = false;
+}
+
+}
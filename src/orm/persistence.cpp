@@ -4,13 +4,25 @@
 
 #include "matador/orm/persistence.hpp"
 
+#include "matador/object/object_exception.hpp"
+
+#include <algorithm>
+
 namespace matador {
 
 
-persistence::persistence(const std::string &dns)
+persistence::persistence(const std::string &dns, std::size_t min_pool_size, std::size_t max_pool_size)
   : connection_(dns)
+  , pool_(dns, min_pool_size, max_pool_size)
 {
+  connection_.schema_generation(pool_.schema_generation());
   connection_.open();
+  // drop prepared statements of closed pool connections
+  pool_.on_close([this](connection &conn) {
+    for (t_table_map::value_type &val : tables_) {
+      val.second->release(conn);
+    }
+  });
 }
 
 persistence::~persistence()
@@ -86,4 +98,62 @@ const connection &persistence::conn() const {
   return connection_;
 }
 
+connection_pool &persistence::pool()
+{
+  return pool_;
+}
+
+connection &persistence::load_conn()
+{
+  std::lock_guard<std::mutex> lock(session_conns_mutex_);
+  auto i = session_conns_.find(std::this_thread::get_id());
+  if (i == session_conns_.end()) {
+    return connection_;
+  }
+  return *i->second.back();
+}
+
+void persistence::lazy_loading(bool enable)
+{
+  if (enable && !lazy_loading_) {
+    // misses recorded while disabled aren't real misses
+    store_.forget_misses();
+  }
+  lazy_loading_ = enable;
+}
+
+bool persistence::lazy_loading() const
+{
+  return lazy_loading_;
+}
+
+void persistence::push_session_conn(connection &conn)
+{
+  std::lock_guard<std::mutex> lock(session_conns_mutex_);
+  // the object store isn't synchronized, so it is
+  // confined to the thread holding sessions
+  std::thread::id id = std::this_thread::get_id();
+  if (!session_conns_.empty() && session_conns_.count(id) == 0) {
+    throw_object_exception("persistence: object store is used by the sessions of another thread");
+  }
+  session_conns_[id].push_back(&conn);
+}
+
+void persistence::pop_session_conn(connection &conn)
+{
+  std::lock_guard<std::mutex> lock(session_conns_mutex_);
+  auto i = session_conns_.find(std::this_thread::get_id());
+  if (i == session_conns_.end()) {
+    return;
+  }
+  // sessions may be destroyed in any order
+  auto j = std::find(i->second.rbegin(), i->second.rend(), &conn);
+  if (j != i->second.rend()) {
+    i->second.erase(std::next(j).base());
+  }
+  if (i->second.empty()) {
+    session_conns_.erase(i);
+  }
+}
+
 }
\ No newline at end of file
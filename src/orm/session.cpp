@@ -4,34 +4,132 @@
 
 #include "matador/orm/session.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace matador {
 
 
 session::session(persistence &p)
   : persistence_(p)
+  , connection_(p.conn())
+  , observer_(new session_observer(*this))
+{
+  persistence_.push_session_conn(connection_);
+}
+
+session::session(persistence &p, connection_lease &&lease)
+  : persistence_(p)
+  , lease_(std::move(lease))
+  , connection_(*lease_)
   , observer_(new session_observer(*this))
 {
+  persistence_.push_session_conn(connection_);
+}
 
+session::~session()
+{
+  persistence_.pop_session_conn(connection_);
 }
 
 void session::load()
 {
-  prototype_iterator first = persistence_.store().begin();
-  prototype_iterator last = persistence_.store().end();
-  while (first != last) {
-    const prototype_node &node = (*first++);
-    if (node.is_abstract()) {
-      continue;
+  for (auto &table : tables_in_load_order()) {
+    load(table);
+  }
+}
+
+void session::load_parallel(std::size_t workers)
+{
+  std::vector<persistence::table_ptr> tables(tables_in_load_order());
+
+  // lease the worker connections up front, an exhausted
+  // pool limits the count of workers instead of blocking
+  std::vector<connection_lease> leases;
+  workers = std::min(workers, tables.size());
+  while (workers > 1 && leases.size() < workers) {
+    connection_lease lease(persistence_.pool().try_acquire());
+    if (!lease) {
+      break;
+    }
+    leases.push_back(std::move(lease));
+  }
+  if (leases.size() < 2) {
+    leases.clear();
+    for (auto &table : tables) {
+      load(table);
     }
+    return;
+  }
 
-    // find corresponding table and load entities
-    auto i = persistence_.find_table(node.type());
-    if (i == persistence_.end()) {
-      // Todo: replace with persistence exception
-      throw_object_exception("couldn't find table");
+  // read tables concurrently, each worker on its own connection
+  std::atomic<std::size_t> next(0);
+  std::mutex mutex;
+  std::exception_ptr error;
+
+  std::vector<std::thread> threads;
+  for (auto &lease : leases) {
+    connection &conn = *lease;
+    threads.emplace_back([&conn, &tables, &next, &mutex, &error]() {
+      try {
+        std::size_t i;
+        while ((i = next++) < tables.size()) {
+          tables[i]->fetch(conn);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        // stop the other workers
+        next = tables.size();
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  // insert objects in load order
+  for (auto &table : tables) {
+    table->merge(connection_, persistence_.store());
+  }
+}
+
+bool session::load(load_cursor &cursor, std::size_t chunk_size)
+{
+  if (cursor.finished_) {
+    return false;
+  }
+  if (chunk_size == 0) {
+    throw_object_exception("chunk size must be greater zero");
+  }
+  auto i = persistence_.find_table(cursor.table_);
+  if (i == persistence_.end()) {
+    throw_object_exception("couldn't find table " << cursor.table_);
+  }
+  std::size_t rows = i->second->load(connection_, persistence_.store(), cursor.last_, chunk_size);
+  cursor.rows_ += rows;
+  ++cursor.chunks_;
+  cursor.finished_ = rows < chunk_size;
+  return !cursor.finished_;
+}
+
+bool session::load(load_cursor &cursor, std::size_t chunk_size, const t_load_progress &progress)
+{
+  while (!cursor.finished_) {
+    load(cursor, chunk_size);
+    if (!progress(cursor)) {
+      break;
     }
-    load(i->second);
   }
+  return cursor.finished_;
 }
 
 transaction session::begin()
@@ -51,9 +149,36 @@ const object_store &session::store() const
   return persistence_.store();
 }
 
+connection &session::conn()
+{
+  return connection_;
+}
+
 void session::load(const persistence::table_ptr &table)
 {
-  table->load(persistence_.store());
+  table->load(connection_, persistence_.store());
+}
+
+std::vector<persistence::table_ptr> session::tables_in_load_order()
+{
+  std::vector<persistence::table_ptr> tables;
+  prototype_iterator first = persistence_.store().begin();
+  prototype_iterator last = persistence_.store().end();
+  while (first != last) {
+    const prototype_node &node = (*first++);
+    if (node.is_abstract()) {
+      continue;
+    }
+
+    // find corresponding table
+    auto i = persistence_.find_table(node.type());
+    if (i == persistence_.end()) {
+      // Todo: replace with persistence exception
+      throw_object_exception("couldn't find table");
+    }
+    tables.push_back(i->second);
+  }
+  return tables;
 }
 
 session::session_observer::session_observer(session &s)
@@ -66,17 +191,17 @@ void session::session_observer::on_begin()
 
 void session::session_observer::on_commit(transaction::t_action_vector &actions)
 {
-  session_.persistence_.conn().begin();
+  session_.connection_.begin();
 
   for (transaction::action_ptr &actptr : actions) {
     actptr->accept(this);
   }
-  session_.persistence_.conn().commit();
+  session_.connection_.commit();
 }
 
 void session::session_observer::on_rollback()
 {
-  session_.persistence_.conn().rollback();
+  session_.connection_.rollback();
 }
 
 void session::session_observer::visit(insert_action *act)
@@ -87,12 +212,7 @@ void session::session_observer::visit(insert_action *act)
     return;
   }
 
-  insert_action::const_iterator first = act->begin();
-  insert_action::const_iterator last = act->end();
-  while (first != last) {
-    i->second->insert((*first++));
-  }
-
+  i->second->insert(session_.connection_, act->begin(), act->end());
 }
 
 void session::session_observer::visit(update_action *act)
@@ -103,7 +223,13 @@ void session::session_observer::visit(update_action *act)
     return;
   }
 
-  i->second->update(act->proxy());
+  if (act->is_backup_before_change()) {
+    i->second->update(session_.connection_, act->proxy(), act->snapshot());
+  } else {
+    // the snapshot may already contain some of
+    // the changes, so the whole row is updated
+    i->second->update(session_.connection_, act->proxy());
+  }
 }
 
 void session::session_observer::visit(delete_action *act)
@@ -115,7 +241,7 @@ void session::session_observer::visit(delete_action *act)
     return;
   }
 
-  i->second->remove(act->proxy());
+  i->second->remove(session_.connection_, act->proxy());
 
   act->mark_deleted();
 }
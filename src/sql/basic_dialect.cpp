@@ -5,8 +5,13 @@
 #include "matador/sql/basic_dialect_compiler.hpp"
 #include "matador/sql/basic_dialect_linker.hpp"
 #include "matador/sql/sql.hpp"
+#include "matador/sql/token_structure.hpp"
 
 #include "matador/utils/string.hpp"
+#include "matador/utils/date.hpp"
+#include "matador/utils/time.hpp"
+
+#include <limits>
 
 namespace matador {
 
@@ -21,6 +26,13 @@ build_info::build_info(const sql &s, basic_dialect *d)
 
 }
 
+namespace {
+
+// the cache is dropped at once when it is full
+const std::size_t max_prepared_count = 1024;
+
+}
+
 basic_dialect::basic_dialect(detail::basic_dialect_compiler *compiler, detail::basic_dialect_linker *linker)
   : compiler_(compiler)
   , linker_(linker)
@@ -47,6 +59,28 @@ std::string basic_dialect::prepare(const sql &s)
 
 std::string basic_dialect::build(const sql &s, t_compile_type compile_type)
 {
+  // subqueries are built as part of their statement
+  bool is_statement = build_info_stack_.empty();
+  // values are linked into direct statements,
+  // only prepared statements are cached
+  bool is_cacheable = is_statement && compile_type == PREPARED;
+
+  std::string structure;
+  if (is_cacheable) {
+    structure = detail::token_structure::of(s);
+    auto i = prepared_.find(structure);
+    if (i != prepared_.end()) {
+      bind_count_ = i->second.bind_count;
+      column_count_ = i->second.column_count;
+      return i->second.result;
+    }
+  }
+
+  if (is_statement) {
+    bind_count_ = 0;
+    column_count_ = 0;
+  }
+
   compile_type_ = compile_type;
 
   push(s);
@@ -54,6 +88,16 @@ std::string basic_dialect::build(const sql &s, t_compile_type compile_type)
   link();
   std::string result(top().result);
   pop();
+
+  if (is_cacheable) {
+    if (prepared_.size() >= max_prepared_count) {
+      prepared_.clear();
+    }
+    prepared_statement &prepared = prepared_[structure];
+    prepared.result = result;
+    prepared.bind_count = bind_count_;
+    prepared.column_count = column_count_;
+  }
   return result;
 }
 
@@ -133,8 +177,27 @@ size_t basic_dialect::column_count() const
   return column_count_;
 }
 
+size_t basic_dialect::prepared_count() const
+{
+  return prepared_.size();
+}
+
+size_t basic_dialect::max_bind_count() const
+{
+  return std::numeric_limits<size_t>::max();
+}
+
+size_t basic_dialect::max_insert_rows() const
+{
+  return std::numeric_limits<size_t>::max();
+}
+
 std::string basic_dialect::prepare_identifier(const std::string &str)
 {
+  std::string::size_type pos = str.find('.');
+  if (pos != std::string::npos) {
+    return prepare_identifier(str.substr(0, pos)) + "." + prepare_identifier(str.substr(pos + 1));
+  }
   std::string result(str);
   escape_quotes_in_identifier(result);
   quote_identifier(result);
@@ -148,6 +211,20 @@ std::string basic_dialect::prepare_literal(const std::string &str) const
   return result;
 }
 
+std::string basic_dialect::date_literal(const matador::date &d) const
+{
+  char buffer[iso8601::DATE_SIZE];
+  to_iso8601(d, buffer);
+  return "'" + std::string(buffer) + "'";
+}
+
+std::string basic_dialect::time_literal(const matador::time &t) const
+{
+  char buffer[iso8601::TIME_SIZE];
+  to_iso8601(t, buffer);
+  return "'" + std::string(buffer) + "'";
+}
+
 void basic_dialect::quote_identifier(std::string &str)
 {
   str.insert(0, token_at(detail::token::START_QUOTE));
@@ -59,6 +59,10 @@ void basic_dialect_compiler::visit(const matador::detail::from &) { }
 
 void basic_dialect_compiler::visit(const matador::detail::where &) { }
 
+void basic_dialect_compiler::visit(const matador::detail::join &) { }
+
+void basic_dialect_compiler::visit(const matador::detail::on &) { }
+
 void basic_dialect_compiler::visit(const matador::detail::basic_condition &) { }
 
 void basic_dialect_compiler::visit(const matador::detail::basic_column_condition &) { }
@@ -96,18 +96,25 @@ void basic_dialect_linker::visit(const matador::detail::remove &del)
 
 void basic_dialect_linker::visit(const matador::detail::values &values)
 {
-  dialect().append_to_result(token_string(values.type) + " (");
+  dialect().append_to_result(token_string(values.type) + " ");
 
-  if (values.values_.size() > 1) {
-    std::for_each(values.values_.begin(), values.values_.end() - 1, [&](const std::shared_ptr<detail::basic_value> &val) {
-      val->accept(*this);
+  for (std::size_t row = 0; row < values.rows; ++row) {
+    if (row > 0) {
       dialect().append_to_result(", ");
-    });
-  }
-  if (!values.values_.empty()) {
-    values.values_.back()->accept(*this);
+    }
+    dialect().append_to_result("(");
+    if (values.values_.size() > 1) {
+      std::for_each(values.values_.begin(), values.values_.end() - 1, [&](const std::shared_ptr<detail::basic_value> &val) {
+        val->accept(*this);
+        dialect().append_to_result(", ");
+      });
+    }
+    if (!values.values_.empty()) {
+      values.values_.back()->accept(*this);
+    }
+    dialect().append_to_result(")");
   }
-  dialect().append_to_result(") ");
+  dialect().append_to_result(" ");
 }
 
 void basic_dialect_linker::visit(const matador::detail::basic_value &val)
@@ -161,6 +168,18 @@ void basic_dialect_linker::visit(const matador::detail::where &where)
   dialect().append_to_result(" ");
 }
 
+void basic_dialect_linker::visit(const matador::detail::join &join)
+{
+  dialect().append_to_result(token_string(join.type) + " " + dialect_->prepare_identifier(join.table) + " ");
+}
+
+void basic_dialect_linker::visit(const matador::detail::on &on)
+{
+  dialect().append_to_result(token_string(on.type) + " ");
+  on.cond->accept(*this);
+  dialect().append_to_result(" ");
+}
+
 void basic_dialect_linker::visit(const matador::detail::basic_condition &cond)
 {
   dialect().append_to_result(cond.evaluate(dialect()));
@@ -1,4 +1,5 @@
 #include "matador/sql/condition.hpp"
+#include "matador/sql/dialect_token.hpp"
 
 namespace matador {
 
@@ -7,6 +8,24 @@ namespace detail {
 std::array<std::string, basic_condition::num_operands>
   basic_condition::operands = { {"=", "<>", "<", "<=", ">", ">=", "OR", "AND", "NOT"} };
 
+void basic_condition::serialize_values(serializer &) {}
+
+}
+
+void condition<column, detail::basic_query>::serialize_values(serializer &srlzr)
+{
+  for (auto &tkn : query_.stmt().token_list_) {
+    if (tkn->type == detail::token::WHERE) {
+      static_cast<detail::where&>(*tkn).cond->serialize_values(srlzr);
+    }
+  }
+}
+
+void condition<column, detail::basic_query>::structure(std::string &out) const
+{
+  detail::token_structure::write_identifier(out, field_.name);
+  out.append(" IN ");
+  detail::token_structure(out).write(query_.stmt());
 }
 
 condition<column, detail::basic_query> in(const matador::column &f, detail::basic_query &q)
@@ -2,12 +2,26 @@
 #include "matador/sql/connection.hpp"
 #include "matador/sql/column.hpp"
 #include "matador/sql/value.hpp"
+#include "matador/sql/basic_dialect.hpp"
+#include "matador/sql/sql.hpp"
+
+#include <algorithm>
+#include <cctype>
 
 namespace matador {
 
-connection::connection() {}
+namespace {
+const std::size_t DEFAULT_PREPARED_CACHE_CAPACITY = 32;
+}
+
+connection::connection()
+  : cache_(std::make_shared<detail::statement_cache>(DEFAULT_PREPARED_CACHE_CAPACITY))
+  , schema_generation_(std::make_shared<std::atomic<std::size_t>>(0))
+{}
 
 connection::connection(const std::string &dns)
+  : cache_(std::make_shared<detail::statement_cache>(DEFAULT_PREPARED_CACHE_CAPACITY))
+  , schema_generation_(std::make_shared<std::atomic<std::size_t>>(0))
 {
   parse_dns(dns);
   impl_.reset(create_connection(type_));
@@ -16,6 +30,10 @@ connection::connection(const std::string &dns)
 connection::connection(const connection &x)
   : type_(x.type_)
   , dns_(x.dns_)
+  , cache_(std::make_shared<detail::statement_cache>(x.prepared_cache_capacity()))
+  , stream_results_(x.stream_results_)
+  , schema_generation_(x.schema_generation_)
+  , schema_cache_generation_(x.schema_generation_->load())
 {
   init_from_foreign_connection(x);
 }
@@ -24,6 +42,11 @@ connection::connection(connection &&x)
   : type_(std::move(x.type_))
   , dns_(std::move(x.dns_))
   , impl_(std::move(x.impl_))
+  , cache_(std::move(x.cache_))
+  , stream_results_(x.stream_results_)
+  , schema_cache_(std::move(x.schema_cache_))
+  , schema_generation_(x.schema_generation_)
+  , schema_cache_generation_(x.schema_cache_generation_)
 {}
 
 connection &connection::operator=(const connection &x)
@@ -31,6 +54,10 @@ connection &connection::operator=(const connection &x)
   type_ = x.type_;
   dns_ = x.dns_;
 
+  cache_ = std::make_shared<detail::statement_cache>(x.prepared_cache_capacity());
+  stream_results_ = x.stream_results_;
+  schema_cache_.clear();
+  schema_generation(x.schema_generation_);
   init_from_foreign_connection(x);
 
   return *this;
@@ -38,9 +65,15 @@ connection &connection::operator=(const connection &x)
 
 connection &connection::operator=(connection &&x)
 {
+  drop_cache();
   type_ = std::move(x.type_);
   dns_ = std::move(x.dns_);
   impl_ = std::move(x.impl_);
+  cache_ = std::move(x.cache_);
+  stream_results_ = x.stream_results_;
+  schema_cache_ = std::move(x.schema_cache_);
+  schema_generation_ = x.schema_generation_;
+  schema_cache_generation_ = x.schema_cache_generation_;
   return *this;
 }
 
@@ -49,6 +82,7 @@ connection::~connection()
   if (!impl_) {
     return;
   }
+  drop_cache();
   impl_->close();
   connection_factory::instance().destroy(type_, impl_.release());
 }
@@ -69,9 +103,12 @@ void connection::open()
     return;
   } else {
     if (impl_) {
+      drop_cache();
+      schema_cache_.clear();
       connection_factory::instance().destroy(type_, impl_.release());
     }
     impl_.reset(create_connection(type_));
+    impl_->stream_results(stream_results_);
     impl_->open(dns_);
   }
 }
@@ -83,6 +120,8 @@ bool connection::is_open() const
 
 void connection::close()
 {
+  drop_cache();
+  schema_cache_.clear();
   impl_->close();
 }
 
@@ -131,15 +170,92 @@ bool connection::is_valid() const
   return !type_.empty() && !dns_.empty();
 }
 
+void connection::stream_results(bool enable)
+{
+  stream_results_ = enable;
+  if (impl_) {
+    impl_->stream_results(enable);
+  }
+}
+
+bool connection::streams_results() const
+{
+  return stream_results_;
+}
+
+void connection::prepared_cache_capacity(std::size_t capacity)
+{
+  cache_->capacity(capacity);
+}
+
+std::size_t connection::prepared_cache_capacity() const
+{
+  return cache_ ? cache_->capacity() : 0;
+}
+
+std::size_t connection::prepared_cache_size() const
+{
+  return cache_ ? cache_->size() : 0;
+}
+
+std::size_t connection::prepared_cache_hits() const
+{
+  return cache_ ? cache_->hits() : 0;
+}
+
+std::size_t connection::prepared_cache_misses() const
+{
+  return cache_ ? cache_->misses() : 0;
+}
+
+void connection::refresh_schema()
+{
+  schema_cache_.clear();
+}
+
+void connection::refresh_schema(const std::string &tablename)
+{
+  schema_cache_.erase(tablename);
+}
+
+std::size_t connection::schema_cache_size() const
+{
+  // descriptions of an outdated generation are dropped on the next lookup
+  return schema_generation_->load() == schema_cache_generation_ ? schema_cache_.size() : 0;
+}
+
+connection::t_schema_generation connection::schema_generation() const
+{
+  return schema_generation_;
+}
+
+void connection::schema_generation(const t_schema_generation &generation)
+{
+  schema_generation_ = generation;
+  schema_cache_.clear();
+  schema_cache_generation_ = schema_generation_->load();
+}
+
+detail::statement_impl *connection::prepare_statement(const matador::sql &sql)
+{
+  detail::statement_impl *stmt = cache_->acquire(impl_->dialect()->prepare(sql));
+  if (stmt == nullptr) {
+    stmt = impl_->prepare(sql);
+    cache_->attach(stmt);
+  }
+  stmt->stream_results(impl_->streams_results());
+  return stmt;
+}
+
 detail::basic_value* create_default_value(data_type type);
 
 void connection::prepare_prototype_row(row &prototype, const std::string &tablename)
 {
-  if (!impl_->exists(tablename)) {
+  const std::vector<field> *fields = describe_cached(tablename);
+  if (fields == nullptr) {
     return;
   }
-  auto fields = impl_->describe(tablename);
-  for (auto &&f : fields) {
+  for (auto &&f : *fields) {
     if (!prototype.has_column(f.name())) {
       continue;
     };
@@ -150,6 +266,26 @@ void connection::prepare_prototype_row(row &prototype, const std::string &tablen
     prototype.set(f.name(), value);
 //    prototype.set(f.name(), std::make_shared<null_value>());
   }
+  // columns of joined tables are qualified with their table name
+  for (std::size_t i = 0; i < prototype.size(); ++i) {
+    const std::string &name = prototype.column(i);
+    std::string::size_type pos = name.find('.');
+    if (pos == std::string::npos) {
+      continue;
+    }
+    const std::vector<field> *joined_fields = describe_cached(name.substr(0, pos));
+    if (joined_fields == nullptr) {
+      continue;
+    }
+    const std::string column_name = name.substr(pos + 1);
+    auto f = std::find_if(joined_fields->begin(), joined_fields->end(), [&column_name](const field &fld) {
+      return fld.name() == column_name;
+    });
+    if (f != joined_fields->end()) {
+      std::shared_ptr<detail::basic_value> value(create_default_value(f->type()));
+      prototype.set(name, value);
+    }
+  }
   // default value for count(*)
   if (prototype.has_column(matador::columns::count_all().name)) {
     std::shared_ptr<detail::basic_value> value(create_default_value(data_type::type_int));
@@ -195,6 +331,89 @@ detail::basic_value* create_default_value(data_type type)
   }
 }
 
+const std::vector<field> *connection::describe_cached(const std::string &tablename)
+{
+  // another connection changed the schema
+  std::size_t generation = schema_generation_->load();
+  if (generation != schema_cache_generation_) {
+    schema_cache_.clear();
+    schema_cache_generation_ = generation;
+  }
+  auto i = schema_cache_.find(tablename);
+  if (i != schema_cache_.end()) {
+    return &i->second;
+  }
+  // tables which don't exist aren't cached,
+  // they may be created from outside
+  if (!impl_->exists(tablename)) {
+    return nullptr;
+  }
+  i = schema_cache_.insert(std::make_pair(tablename, impl_->describe(tablename))).first;
+  return &i->second;
+}
+
+void connection::schema_changed(const matador::sql &stmt)
+{
+  if (stmt.command() == t_query_command::CREATE || stmt.command() == t_query_command::DROP) {
+    increment_schema_generation();
+  }
+}
+
+namespace {
+
+bool is_schema_keyword(const std::string &stmt, std::string::size_type pos)
+{
+  // the ctype functions are only defined for unsigned char values
+  auto last = std::find_if_not(stmt.begin() + pos, stmt.end(), [](char c) { return std::isalpha((unsigned char)c) != 0; });
+  std::string keyword(stmt.begin() + pos, last);
+  std::transform(keyword.begin(), keyword.end(), keyword.begin(), [](char c) { return (char)std::toupper((unsigned char)c); });
+  return keyword == "CREATE" || keyword == "DROP" || keyword == "ALTER" || keyword == "RENAME";
+}
+
+}
+
+void connection::schema_changed(const std::string &stmt)
+{
+  // classify each statement of the string, a
+  // semicolon inside quotes doesn't end one
+  bool statement_start = true;
+  char quote = 0;
+  for (std::string::size_type i = 0; i < stmt.size(); ++i) {
+    char c = stmt[i];
+    if (quote != 0) {
+      if (c == quote) {
+        quote = 0;
+      }
+    } else if (c == ';') {
+      statement_start = true;
+    } else if (statement_start && std::isspace((unsigned char)c) == 0) {
+      statement_start = false;
+      if (is_schema_keyword(stmt, i)) {
+        increment_schema_generation();
+        return;
+      }
+    } else if (c == '\'' || c == '"' || c == '`') {
+      quote = c;
+    }
+  }
+}
+
+void connection::increment_schema_generation()
+{
+  schema_cache_.clear();
+  schema_cache_generation_ = ++(*schema_generation_);
+}
+
+void connection::drop_cache()
+{
+  if (!cache_) {
+    return;
+  }
+  // statements of a closed connection must not be
+  // reused, they are deleted once they are released
+  cache_ = std::make_shared<detail::statement_cache>(cache_->capacity());
+}
+
 connection_impl *connection::create_connection(const std::string &type) const
 {
   // try to create sql implementation
@@ -205,6 +424,7 @@ void connection::init_from_foreign_connection(const connection &foreign_connecti
 {
   if (is_valid()) {
     impl_.reset(create_connection(type_));
+    impl_->stream_results(stream_results_);
 
     if (foreign_connection.is_open()) {
       open();
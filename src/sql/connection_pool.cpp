@@ -0,0 +1,305 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/sql/connection_pool.hpp"
+#include "matador/sql/sql_exception.hpp"
+
+#include <algorithm>
+
+namespace matador {
+
+connection_lease::connection_lease(connection_pool *pool, connection *conn)
+  : pool_(pool)
+  , conn_(conn)
+{}
+
+connection_lease::connection_lease(connection_lease &&x) noexcept
+  : pool_(x.pool_)
+  , conn_(x.conn_)
+{
+  x.pool_ = nullptr;
+  x.conn_ = nullptr;
+}
+
+connection_lease &connection_lease::operator=(connection_lease &&x) noexcept
+{
+  if (this != &x) {
+    release();
+    std::swap(pool_, x.pool_);
+    std::swap(conn_, x.conn_);
+  }
+  return *this;
+}
+
+connection_lease::~connection_lease()
+{
+  release();
+}
+
+void connection_lease::release()
+{
+  if (pool_ && conn_) {
+    pool_->release(conn_);
+  }
+  pool_ = nullptr;
+  conn_ = nullptr;
+}
+
+connection *connection_lease::get() const
+{
+  return conn_;
+}
+
+connection *connection_lease::operator->() const
+{
+  return conn_;
+}
+
+connection &connection_lease::operator*() const
+{
+  return *conn_;
+}
+
+connection_lease::operator bool() const
+{
+  return conn_ != nullptr;
+}
+
+connection_pool::connection_pool(const std::string &dns, std::size_t min_size, std::size_t max_size, std::chrono::seconds idle_timeout)
+  : dns_(dns)
+  , min_size_(min_size)
+  , max_size_(max_size)
+  , idle_timeout_(idle_timeout)
+  , schema_generation_(std::make_shared<std::atomic<std::size_t>>(0))
+{
+  if (max_size_ == 0) {
+    throw sql_exception("connection_pool", "maximum size must be greater zero");
+  }
+  if (min_size_ > max_size_) {
+    throw sql_exception("connection_pool", "minimum size must not be greater than maximum size");
+  }
+  for (std::size_t i = 0; i < min_size_; ++i) {
+    connections_.push_back(open_connection());
+    idle_.push_back({connections_.back().get(), clock::now()});
+  }
+}
+
+connection_pool::~connection_pool()
+{
+  idle_.clear();
+  connections_.clear();
+}
+
+connection_lease connection_pool::acquire()
+{
+  close_expired();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  available_.wait(lock, [this]() {
+    return !idle_.empty() || connections_.size() + pending_ < max_size_;
+  });
+
+  return lease(lock);
+}
+
+connection_lease connection_pool::try_acquire()
+{
+  close_expired();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (idle_.empty() && connections_.size() + pending_ >= max_size_) {
+    return connection_lease();
+  }
+
+  return lease(lock);
+}
+
+connection_lease connection_pool::lease(std::unique_lock<std::mutex> &lock)
+{
+  if (!idle_.empty()) {
+    // take the most recently used connection
+    connection *conn = idle_.back().conn;
+    idle_.pop_back();
+    lock.unlock();
+    return connection_lease(this, check(conn));
+  }
+
+  // open a new connection outside the lock
+  ++pending_;
+  lock.unlock();
+  std::unique_ptr<connection> conn;
+  try {
+    conn = open_connection();
+  } catch (...) {
+    lock.lock();
+    --pending_;
+    available_.notify_one();
+    throw;
+  }
+  lock.lock();
+  --pending_;
+  connections_.push_back(std::move(conn));
+  return connection_lease(this, connections_.back().get());
+}
+
+void connection_pool::shrink()
+{
+  close_expired();
+}
+
+void connection_pool::on_close(const t_close_callback &callback)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  close_callbacks_.push_back(callback);
+}
+
+std::size_t connection_pool::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return connections_.size();
+}
+
+std::size_t connection_pool::idle() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idle_.size();
+}
+
+std::size_t connection_pool::min_size() const
+{
+  return min_size_;
+}
+
+std::size_t connection_pool::max_size() const
+{
+  return max_size_;
+}
+
+std::chrono::seconds connection_pool::idle_timeout() const
+{
+  return idle_timeout_;
+}
+
+std::string connection_pool::dns() const
+{
+  return dns_;
+}
+
+connection::t_schema_generation connection_pool::schema_generation() const
+{
+  return schema_generation_;
+}
+
+void connection_pool::release(connection *conn)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  idle_.push_back({conn, clock::now()});
+  available_.notify_one();
+}
+
+std::unique_ptr<connection> connection_pool::open_connection() const
+{
+  std::unique_ptr<connection> conn(new connection(dns_));
+  conn->schema_generation(schema_generation_);
+  conn->open();
+  return conn;
+}
+
+bool connection_pool::is_healthy(connection &conn) const
+{
+  if (!conn.is_open()) {
+    return false;
+  }
+  try {
+    conn.execute("SELECT 1");
+  } catch (std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+connection *connection_pool::check(connection *conn)
+{
+  if (is_healthy(*conn)) {
+    return conn;
+  }
+  // reopen broken connection; all prepared
+  // statements of the connection are invalid
+  notify_close(*conn);
+  try {
+    conn->close();
+    conn->open();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    close(conn);
+    available_.notify_one();
+    throw;
+  }
+  return conn;
+}
+
+void connection_pool::close_expired()
+{
+  t_connection_vector expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    expired = take_expired(clock::now());
+  }
+  // the expired connections aren't known to the
+  // pool anymore and are closed on destruction
+  for (auto &conn : expired) {
+    notify_close(*conn);
+  }
+}
+
+connection_pool::t_connection_vector connection_pool::take_expired(clock::time_point now)
+{
+  t_connection_vector expired;
+  auto first = idle_.begin();
+  while (first != idle_.end() && connections_.size() > min_size_) {
+    if (now - first->last_used > idle_timeout_) {
+      expired.push_back(take(first->conn));
+      first = idle_.erase(first);
+    } else {
+      ++first;
+    }
+  }
+  return expired;
+}
+
+std::unique_ptr<connection> connection_pool::take(connection *conn)
+{
+  std::unique_ptr<connection> taken;
+  auto i = std::find_if(connections_.begin(), connections_.end(), [conn](const std::unique_ptr<connection> &c) {
+    return c.get() == conn;
+  });
+  if (i != connections_.end()) {
+    taken = std::move(*i);
+    connections_.erase(i);
+  }
+  return taken;
+}
+
+void connection_pool::close(connection *conn)
+{
+  take(conn);
+}
+
+void connection_pool::notify_close(connection &conn)
+{
+  std::vector<t_close_callback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks = close_callbacks_;
+  }
+  // the callbacks take locks of their own, so they
+  // are called without holding the lock of the pool
+  for (auto &callback : callbacks) {
+    callback(conn);
+  }
+}
+
+}
@@ -150,5 +150,19 @@ void where::accept(token_visitor &visitor)
   visitor.visit(*this);
 }
 
+join::join(const std::string &t, t_token join_type)
+  : token(join_type), table(t)
+{}
+
+void join::accept(token_visitor &visitor)
+{
+  visitor.visit(*this);
+}
+
+void on::accept(token_visitor &visitor)
+{
+  visitor.visit(*this);
+}
+
 }
 }
\ No newline at end of file
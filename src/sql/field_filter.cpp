@@ -0,0 +1,148 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/sql/field_filter.hpp"
+
+namespace matador {
+namespace detail {
+
+field_filter::field_filter(serializer &target, const std::vector<bool> &fields)
+  : target_(target)
+  , fields_(fields)
+{}
+
+void field_filter::serialize(const char *id, char &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, short &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, int &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, long &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, unsigned char &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, unsigned short &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, unsigned int &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, unsigned long &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, bool &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, float &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, double &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, char *x, size_t s)
+{
+  if (selected()) {
+    target_.serialize(id, x, s);
+  }
+}
+
+void field_filter::serialize(const char *id, std::string &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, varchar_base &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, time &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, date &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, basic_identifier &x)
+{
+  if (selected()) {
+    target_.serialize(id, x);
+  }
+}
+
+void field_filter::serialize(const char *id, identifiable_holder &x, cascade_type cascade)
+{
+  if (selected()) {
+    target_.serialize(id, x, cascade);
+  }
+}
+
+bool field_filter::selected()
+{
+  const std::size_t index = index_++;
+  return index < fields_.size() && fields_[index];
+}
+
+}
+}
@@ -17,8 +17,75 @@
 
 #include "matador/sql/row.hpp"
 
+#include <stdexcept>
+
 namespace matador {
 
+namespace detail {
+
+bool row_schema::add(const std::string &column)
+{
+  if (!indices_.insert(std::make_pair(column, columns_.size())).second) {
+    return false;
+  }
+  columns_.push_back(column);
+  return true;
+}
+
+bool row_schema::has(const std::string &column) const
+{
+  return indices_.find(column) != indices_.end();
+}
+
+std::size_t row_schema::index_of(const std::string &column) const
+{
+  return indices_.at(column);
+}
+
+const std::string &row_schema::column(std::size_t index) const
+{
+  return columns_.at(index);
+}
+
+std::size_t row_schema::size() const
+{
+  return columns_.size();
+}
+
+/*
+ * Assigns the value of a basic value to a row
+ * value by serializing the basic value into it
+ */
+class row_value_assigner : public serializer
+{
+public:
+  explicit row_value_assigner(row_value &val) : value_(val) {}
+
+  void serialize(const char *, char &x) override { value_.assign(x); }
+  void serialize(const char *, short &x) override { value_.assign(x); }
+  void serialize(const char *, int &x) override { value_.assign(x); }
+  void serialize(const char *, long &x) override { value_.assign(x); }
+  void serialize(const char *, unsigned char &x) override { value_.assign(x); }
+  void serialize(const char *, unsigned short &x) override { value_.assign(x); }
+  void serialize(const char *, unsigned int &x) override { value_.assign(x); }
+  void serialize(const char *, unsigned long &x) override { value_.assign(x); }
+  void serialize(const char *, bool &x) override { value_.assign(x); }
+  void serialize(const char *, float &x) override { value_.assign(x); }
+  void serialize(const char *, double &x) override { value_.assign(x); }
+  void serialize(const char *, char *x, size_t) override { value_.assign(x); }
+  void serialize(const char *, std::string &x) override { value_.assign(x); }
+  void serialize(const char *, varchar_base &x) override { value_.assign(x); }
+  void serialize(const char *, time &x) override { value_.assign(x); }
+  void serialize(const char *, date &x) override { value_.assign(x); }
+  void serialize(const char *, basic_identifier &) override {}
+  void serialize(const char *, identifiable_holder &, cascade_type) override {}
+
+private:
+  row_value &value_;
+};
+
+}
+
 row::row()
 {}
 
@@ -32,27 +99,63 @@ bool row::add_column(const std::string &column)
 
 bool row::add_column(const std::string &column, const std::shared_ptr<detail::basic_value> &value)
 {
-  if (has_column(column)) {
+  if (!schema_) {
+    schema_ = std::make_shared<detail::row_schema>();
+  } else if (schema_.use_count() > 1) {
+    if (schema_->has(column)) {
+      return false;
+    }
+    // the schema is shared with other rows
+    schema_ = std::make_shared<detail::row_schema>(*schema_);
+  }
+  if (!schema_->add(column)) {
     return false;
   }
-
-  columns_.push_back(column);
-  return values_.insert({column, value}).second;
+  values_.emplace_back();
+  set(column, value);
+  return true;
 }
 
 bool row::has_column(const std::string &column) const
 {
-  return values_.find(column) != values_.end();
+  return schema_ && schema_->has(column);
+}
+
+std::size_t row::index_of(const std::string &column) const
+{
+  if (!schema_) {
+    throw std::out_of_range("row: unknown column " + column);
+  }
+  return schema_->index_of(column);
+}
+
+const std::string &row::column(std::size_t index) const
+{
+  if (!schema_ || index >= schema_->size()) {
+    throw std::out_of_range("row: invalid column index");
+  }
+  return schema_->column(index);
+}
+
+std::size_t row::size() const
+{
+  return values_.size();
 }
 
 void row::set(const std::string &column, const std::shared_ptr<detail::basic_value> &value)
 {
-  values_.at(column) = value;
+  detail::row_value &val = values_[index_of(column)];
+  if (!value || dynamic_cast<null_value*>(value.get()) != nullptr) {
+    val.clear();
+    return;
+  }
+  detail::row_value_assigner assigner(val);
+  value->serialize(column.c_str(), assigner);
 }
 
 void row::clear()
 {
-  columns_.clear();
+  schema_.reset();
   values_.clear();
 }
 
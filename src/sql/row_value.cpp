@@ -0,0 +1,477 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/sql/row_value.hpp"
+
+#include "matador/utils/string.hpp"
+
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <utility>
+
+namespace matador {
+
+namespace detail {
+
+row_value::row_value()
+  : long_(0)
+{}
+
+row_value::~row_value()
+{
+  reset(data_type::type_null);
+}
+
+row_value::row_value(const row_value &x)
+  : long_(0)
+{
+  copy(x);
+}
+
+row_value::row_value(row_value &&x) noexcept
+  : long_(0)
+{
+  move(std::move(x));
+}
+
+row_value &row_value::operator=(const row_value &x)
+{
+  if (this != &x) {
+    copy(x);
+  }
+  return *this;
+}
+
+row_value &row_value::operator=(row_value &&x) noexcept
+{
+  if (this != &x) {
+    move(std::move(x));
+  }
+  return *this;
+}
+
+data_type row_value::type() const
+{
+  return type_;
+}
+
+bool row_value::is_null() const
+{
+  return type_ == data_type::type_null;
+}
+
+void row_value::assign(char x)
+{
+  reset(data_type::type_char);
+  char_ = x;
+}
+
+void row_value::assign(short x)
+{
+  reset(data_type::type_short);
+  short_ = x;
+}
+
+void row_value::assign(int x)
+{
+  reset(data_type::type_int);
+  int_ = x;
+}
+
+void row_value::assign(long x)
+{
+  reset(data_type::type_long);
+  long_ = x;
+}
+
+void row_value::assign(unsigned char x)
+{
+  reset(data_type::type_unsigned_char);
+  unsigned_char_ = x;
+}
+
+void row_value::assign(unsigned short x)
+{
+  reset(data_type::type_unsigned_short);
+  unsigned_short_ = x;
+}
+
+void row_value::assign(unsigned int x)
+{
+  reset(data_type::type_unsigned_int);
+  unsigned_int_ = x;
+}
+
+void row_value::assign(unsigned long x)
+{
+  reset(data_type::type_unsigned_long);
+  unsigned_long_ = x;
+}
+
+void row_value::assign(bool x)
+{
+  reset(data_type::type_bool);
+  bool_ = x;
+}
+
+void row_value::assign(float x)
+{
+  reset(data_type::type_float);
+  float_ = x;
+}
+
+void row_value::assign(double x)
+{
+  reset(data_type::type_double);
+  double_ = x;
+}
+
+void row_value::assign(const char *x)
+{
+  assign(std::string(x != nullptr ? x : ""));
+}
+
+void row_value::assign(const std::string &x)
+{
+  if (type_ == data_type::type_text) {
+    text_ = x;
+    return;
+  }
+  reset(data_type::type_null);
+  new (&text_) std::string(x);
+  type_ = data_type::type_text;
+}
+
+void row_value::assign(const varchar_base &x)
+{
+  if (type_ == data_type::type_varchar) {
+    varchar_ = x;
+    return;
+  }
+  reset(data_type::type_null);
+  new (&varchar_) varchar_base(x);
+  type_ = data_type::type_varchar;
+}
+
+void row_value::assign(const date &x)
+{
+  if (type_ == data_type::type_date) {
+    date_ = x;
+    return;
+  }
+  reset(data_type::type_null);
+  new (&date_) date(x);
+  type_ = data_type::type_date;
+}
+
+void row_value::assign(const time &x)
+{
+  if (type_ == data_type::type_time) {
+    time_ = x;
+    return;
+  }
+  reset(data_type::type_null);
+  new (&time_) time(x);
+  type_ = data_type::type_time;
+}
+
+void row_value::clear()
+{
+  reset(data_type::type_null);
+}
+
+void row_value::serialize(const char *id, serializer &srlzr)
+{
+  switch (type_) {
+    case data_type::type_char:
+      srlzr.serialize(id, char_);
+      break;
+    case data_type::type_short:
+      srlzr.serialize(id, short_);
+      break;
+    case data_type::type_int:
+      srlzr.serialize(id, int_);
+      break;
+    case data_type::type_long:
+      srlzr.serialize(id, long_);
+      break;
+    case data_type::type_unsigned_char:
+      srlzr.serialize(id, unsigned_char_);
+      break;
+    case data_type::type_unsigned_short:
+      srlzr.serialize(id, unsigned_short_);
+      break;
+    case data_type::type_unsigned_int:
+      srlzr.serialize(id, unsigned_int_);
+      break;
+    case data_type::type_unsigned_long:
+      srlzr.serialize(id, unsigned_long_);
+      break;
+    case data_type::type_bool:
+      srlzr.serialize(id, bool_);
+      break;
+    case data_type::type_float:
+      srlzr.serialize(id, float_);
+      break;
+    case data_type::type_double:
+      srlzr.serialize(id, double_);
+      break;
+    case data_type::type_varchar:
+      srlzr.serialize(id, varchar_);
+      break;
+    case data_type::type_date:
+      srlzr.serialize(id, date_);
+      break;
+    case data_type::type_time:
+      srlzr.serialize(id, time_);
+      break;
+    case data_type::type_null:
+      assign(std::string());
+      srlzr.serialize(id, text_);
+      break;
+    default:
+      srlzr.serialize(id, text_);
+      break;
+  }
+}
+
+std::string row_value::str() const
+{
+  std::stringstream str;
+  switch (type_) {
+    case data_type::type_char:
+      str << "'" << char_ << "'";
+      break;
+    case data_type::type_short:
+      str << short_;
+      break;
+    case data_type::type_int:
+      str << int_;
+      break;
+    case data_type::type_long:
+      str << long_;
+      break;
+    case data_type::type_unsigned_char:
+      str << unsigned_char_;
+      break;
+    case data_type::type_unsigned_short:
+      str << unsigned_short_;
+      break;
+    case data_type::type_unsigned_int:
+      str << unsigned_int_;
+      break;
+    case data_type::type_unsigned_long:
+      str << unsigned_long_;
+      break;
+    case data_type::type_bool:
+      str << bool_;
+      break;
+    case data_type::type_float:
+      str << float_;
+      break;
+    case data_type::type_double:
+      str << double_;
+      break;
+    case data_type::type_text:
+      str << "'" << text_ << "'";
+      break;
+    case data_type::type_varchar:
+      str << "'" << varchar_.str() << "'";
+      break;
+    case data_type::type_date:
+      str << "'" << matador::to_string(date_) << "'";
+      break;
+    case data_type::type_time: {
+      char buffer[iso8601::TIME_SIZE];
+      to_iso8601(time_, buffer);
+      str << "'" << buffer << "'";
+      break;
+    }
+    default:
+      str << "NULL";
+      break;
+  }
+  return str.str();
+}
+
+void row_value::get(char &x) const
+{
+  check(data_type::type_char);
+  x = char_;
+}
+
+void row_value::get(short &x) const
+{
+  check(data_type::type_short);
+  x = short_;
+}
+
+void row_value::get(int &x) const
+{
+  check(data_type::type_int);
+  x = int_;
+}
+
+void row_value::get(long &x) const
+{
+  check(data_type::type_long);
+  x = long_;
+}
+
+void row_value::get(unsigned char &x) const
+{
+  check(data_type::type_unsigned_char);
+  x = unsigned_char_;
+}
+
+void row_value::get(unsigned short &x) const
+{
+  check(data_type::type_unsigned_short);
+  x = unsigned_short_;
+}
+
+void row_value::get(unsigned int &x) const
+{
+  check(data_type::type_unsigned_int);
+  x = unsigned_int_;
+}
+
+void row_value::get(unsigned long &x) const
+{
+  check(data_type::type_unsigned_long);
+  x = unsigned_long_;
+}
+
+void row_value::get(bool &x) const
+{
+  check(data_type::type_bool);
+  x = bool_;
+}
+
+void row_value::get(float &x) const
+{
+  check(data_type::type_float);
+  x = float_;
+}
+
+void row_value::get(double &x) const
+{
+  check(data_type::type_double);
+  x = double_;
+}
+
+void row_value::get(const char *&x) const
+{
+  if (!is_text()) {
+    throw std::bad_cast();
+  }
+  x = type_ == data_type::type_text ? text_.c_str() : varchar_.c_str();
+}
+
+void row_value::get(std::string &x) const
+{
+  if (!is_text()) {
+    throw std::bad_cast();
+  }
+  x = type_ == data_type::type_text ? text_ : varchar_.str();
+}
+
+void row_value::get(varchar_base &x) const
+{
+  if (!is_text()) {
+    throw std::bad_cast();
+  }
+  x.assign(type_ == data_type::type_text ? text_ : varchar_.str());
+}
+
+void row_value::get(date &x) const
+{
+  check(data_type::type_date);
+  x = date_;
+}
+
+void row_value::get(time &x) const
+{
+  check(data_type::type_time);
+  x = time_;
+}
+
+void row_value::check(data_type type) const
+{
+  if (type_ != type) {
+    throw std::bad_cast();
+  }
+}
+
+bool row_value::is_text() const
+{
+  return type_ == data_type::type_text || type_ == data_type::type_varchar;
+}
+
+void row_value::copy(const row_value &x)
+{
+  switch (x.type_) {
+    case data_type::type_text:
+      assign(x.text_);
+      break;
+    case data_type::type_varchar:
+      assign(x.varchar_);
+      break;
+    case data_type::type_date:
+      assign(x.date_);
+      break;
+    case data_type::type_time:
+      assign(x.time_);
+      break;
+    default:
+      reset(x.type_);
+      // trivial values are copied bitwise
+      std::memcpy(static_cast<void*>(&long_), static_cast<const void*>(&x.long_), sizeof(double) > sizeof(long) ? sizeof(double) : sizeof(long));
+      break;
+  }
+}
+
+void row_value::move(row_value &&x) noexcept
+{
+  switch (x.type_) {
+    case data_type::type_text:
+      reset(data_type::type_null);
+      new (&text_) std::string(std::move(x.text_));
+      type_ = data_type::type_text;
+      break;
+    case data_type::type_varchar:
+      reset(data_type::type_null);
+      new (&varchar_) varchar_base(std::move(x.varchar_));
+      type_ = data_type::type_varchar;
+      break;
+    default:
+      copy(x);
+      break;
+  }
+}
+
+void row_value::reset(data_type type)
+{
+  switch (type_) {
+    case data_type::type_text:
+      text_.~basic_string();
+      break;
+    case data_type::type_varchar:
+      varchar_.~varchar_base();
+      break;
+    case data_type::type_date:
+      date_.~date();
+      break;
+    case data_type::type_time:
+      time_.~time();
+      break;
+    default:
+      break;
+  }
+  type_ = type;
+}
+
+}
+}
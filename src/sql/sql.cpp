@@ -53,6 +53,11 @@ void sql::reset(t_query_command command_type)
   token_list_.clear();
 }
 
+t_query_command sql::command() const
+{
+  return command_type_;
+}
+
 unsigned int sql::type_size(data_type type)
 {
   switch(type) {
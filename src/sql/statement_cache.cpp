@@ -0,0 +1,126 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/sql/statement_cache.hpp"
+#include "matador/sql/statement_impl.hpp"
+
+namespace matador {
+
+namespace detail {
+
+statement_cache::statement_cache(std::size_t capacity)
+  : capacity_(capacity)
+{}
+
+statement_cache::~statement_cache()
+{
+  clear();
+}
+
+statement_impl *statement_cache::acquire(const std::string &sql)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto i = index_.find(sql);
+  if (i == index_.end()) {
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  statement_impl *stmt = i->second->stmt;
+  entries_.erase(i->second);
+  index_.erase(i);
+  stmt->reset();
+  return stmt;
+}
+
+void statement_cache::attach(statement_impl *stmt)
+{
+  stmt->cache_ = shared_from_this();
+}
+
+void statement_cache::capacity(std::size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  evict();
+}
+
+std::size_t statement_cache::capacity() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return capacity_;
+}
+
+std::size_t statement_cache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t statement_cache::hits() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+std::size_t statement_cache::misses() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+void statement_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &e : entries_) {
+    delete e.stmt;
+  }
+  entries_.clear();
+  index_.clear();
+}
+
+void statement_cache::release(statement_impl *stmt)
+{
+  std::shared_ptr<statement_cache> cache(stmt->cache_.lock());
+  if (cache) {
+    cache->put(stmt);
+  } else {
+    delete stmt;
+  }
+}
+
+void statement_cache::detach(statement_impl *stmt)
+{
+  stmt->cache_.reset();
+}
+
+void statement_cache::put(statement_impl *stmt)
+{
+  // release all locks held by the statement
+  stmt->reset();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.push_front({stmt->str(), stmt});
+  index_.insert(std::make_pair(stmt->str(), entries_.begin()));
+  evict();
+}
+
+void statement_cache::evict()
+{
+  while (entries_.size() > capacity_) {
+    auto &e = entries_.back();
+    auto range = index_.equal_range(e.sql);
+    for (auto i = range.first; i != range.second; ++i) {
+      if (i->second->stmt == e.stmt) {
+        index_.erase(i);
+        break;
+      }
+    }
+    delete e.stmt;
+    entries_.pop_back();
+  }
+}
+
+}
+}
@@ -20,6 +20,16 @@ void statement_impl::str(const std::string &s)
   sql_ = s;
 }
 
+void statement_impl::stream_results(bool enable)
+{
+  stream_results_ = enable;
+}
+
+bool statement_impl::streams_results() const
+{
+  return stream_results_;
+}
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,274 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "matador/sql/token_structure.hpp"
+#include "matador/sql/dialect_token.hpp"
+#include "matador/sql/column.hpp"
+#include "matador/sql/sql.hpp"
+
+
+namespace matador {
+
+namespace detail {
+
+token_structure::token_structure(std::string &out)
+  : out_(out)
+{}
+
+void token_structure::write(const sql &s)
+{
+  out_ += '(';
+  for (auto &tokptr : s.token_list_) {
+    tokptr->accept(*this);
+  }
+  out_ += ')';
+}
+
+std::string token_structure::of(const sql &s)
+{
+  std::string out;
+  token_structure structure(out);
+  structure.write(s);
+  return out;
+}
+
+void token_structure::write_identifier(std::string &out, const std::string &identifier)
+{
+  out.append(std::to_string(identifier.size())).append(":").append(identifier);
+}
+
+void token_structure::visit(const matador::detail::create &create)
+{
+  write(create.type);
+  write(create.table);
+}
+
+void token_structure::visit(const matador::detail::drop &drop)
+{
+  write(drop.type);
+  write(drop.table);
+}
+
+void token_structure::visit(const matador::detail::select &select)
+{
+  write(select.type);
+}
+
+void token_structure::visit(const matador::detail::distinct &distinct)
+{
+  write(distinct.type);
+}
+
+void token_structure::visit(const matador::detail::update &update)
+{
+  write(update.type);
+}
+
+void token_structure::visit(const matador::detail::tablename &tab)
+{
+  write(tab.type);
+  write(tab.tab);
+}
+
+void token_structure::visit(const matador::detail::set &set)
+{
+  write(set.type);
+}
+
+void token_structure::visit(const matador::columns &cols)
+{
+  write(cols.type);
+  write_number(cols.with_brackets_);
+  out_ += '[';
+  for (auto &col : cols.columns_) {
+    col->accept(*this);
+  }
+  out_ += ']';
+}
+
+void token_structure::visit(const matador::column &col)
+{
+  write(col.type);
+  write(col.name);
+  write_number(col.skip_quotes);
+}
+
+void token_structure::visit(const matador::detail::typed_column &col)
+{
+  visit(static_cast<const matador::column&>(col));
+  out_ += 't';
+  write_number((std::size_t)col.type);
+}
+
+void token_structure::visit(const matador::detail::typed_identifier_column &col)
+{
+  visit(static_cast<const matador::column&>(col));
+  out_ += 'i';
+  write_number((std::size_t)col.type);
+}
+
+void token_structure::visit(const matador::detail::typed_varchar_column &col)
+{
+  visit(static_cast<const matador::column&>(col));
+  out_ += 'v';
+  write_number((std::size_t)col.type);
+  out_ += ',';
+  write_number(col.size);
+}
+
+void token_structure::visit(const matador::detail::identifier_varchar_column &col)
+{
+  visit(static_cast<const matador::column&>(col));
+  out_ += "iv";
+  write_number((std::size_t)col.type);
+  out_ += ',';
+  write_number(col.size);
+}
+
+void token_structure::visit(const matador::detail::basic_value_column &col)
+{
+  visit(static_cast<const matador::column&>(col));
+  out_ += '=';
+  col.value_->accept(*this);
+}
+
+void token_structure::visit(const matador::detail::from &from)
+{
+  write(from.type);
+  write(from.table);
+}
+
+void token_structure::visit(const matador::detail::where &where)
+{
+  write(where.type);
+  where.cond->accept(*this);
+}
+
+void token_structure::visit(const matador::detail::join &join)
+{
+  write(join.type);
+  write(join.table);
+}
+
+void token_structure::visit(const matador::detail::on &on)
+{
+  write(on.type);
+  on.cond->accept(*this);
+}
+
+void token_structure::visit(const matador::detail::basic_condition &cond)
+{
+  out_ += '{';
+  cond.structure(out_);
+  out_ += '}';
+}
+
+void token_structure::visit(const matador::detail::basic_column_condition &cond)
+{
+  visit(static_cast<const matador::detail::basic_condition&>(cond));
+}
+
+void token_structure::visit(const matador::detail::basic_in_condition &cond)
+{
+  visit(static_cast<const matador::detail::basic_condition&>(cond));
+}
+
+void token_structure::visit(const matador::detail::order_by &by)
+{
+  write(by.type);
+  write(by.column);
+}
+
+void token_structure::visit(const matador::detail::asc &asc)
+{
+  write(asc.type);
+}
+
+void token_structure::visit(const matador::detail::desc &desc)
+{
+  write(desc.type);
+}
+
+void token_structure::visit(const matador::detail::group_by &by)
+{
+  write(by.type);
+  write(by.column);
+}
+
+void token_structure::visit(const matador::detail::insert &insert)
+{
+  write(insert.type);
+  write(insert.table);
+}
+
+void token_structure::visit(const matador::detail::values &values)
+{
+  write(values.type);
+  write_number(values.rows);
+  out_ += 'x';
+  write_number(values.values_.size());
+}
+
+void token_structure::visit(const matador::detail::basic_value &)
+{
+  // values are bound to a placeholder
+  out_ += '?';
+}
+
+void token_structure::visit(const matador::detail::remove &remove)
+{
+  write(remove.type);
+}
+
+void token_structure::visit(const matador::detail::top &top)
+{
+  write(top.type);
+  write_number(top.limit_);
+}
+
+void token_structure::visit(const matador::detail::as &alias)
+{
+  write(alias.type);
+  write(alias.alias);
+}
+
+void token_structure::visit(const matador::detail::begin &begin)
+{
+  write(begin.type);
+}
+
+void token_structure::visit(const matador::detail::commit &commit)
+{
+  write(commit.type);
+}
+
+void token_structure::visit(const matador::detail::rollback &rollback)
+{
+  write(rollback.type);
+}
+
+void token_structure::visit(matador::detail::query &q)
+{
+  write(q.type);
+  write(q.sql_);
+}
+
+void token_structure::write(token::t_token type)
+{
+  out_ += ';';
+  write_number((std::size_t)type);
+}
+
+void token_structure::write(const std::string &identifier)
+{
+  write_identifier(out_, identifier);
+}
+
+void token_structure::write_number(std::size_t number)
+{
+  out_.append(std::to_string(number));
+}
+
+}
+}
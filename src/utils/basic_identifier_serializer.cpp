@@ -106,10 +106,7 @@ void basic_identifier_serializer::serialize(const char *, std::string &x)
   if (restore_) {
     size_t len = 0;
     buffer_->release(&len, sizeof(len));
-    char *str = new char[len];
-    buffer_->release(str, len);
-    x.assign(str, len);
-    delete [] str;
+    x.assign(buffer_->view(len), len);
   } else {
     size_t len = x.size();
 
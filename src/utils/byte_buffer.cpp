@@ -17,84 +17,75 @@
 
 #include "matador/utils/byte_buffer.hpp"
 
+#include <stdexcept>
+#include <string>
+
 namespace matador {
 
-byte_buffer::byte_buffer()
+void byte_buffer::reserve(byte_buffer::size_type size)
 {
-  chunk_list_.push_back(buffer_chunk());
+  if (size > data_.size()) {
+    data_.resize(size);
+  }
 }
 
-byte_buffer::~byte_buffer()
-{}
+byte_buffer::size_type byte_buffer::size() const
+{
+  return write_cursor_ - read_cursor_;
+}
 
-void byte_buffer::append(const void *bytes, byte_buffer::size_type size)
+const char *byte_buffer::data() const
 {
-  const char *ptr = (const char*)bytes;
-  size_type bytes_written = 0;
-  while (chunk_list_.back().available() < size) {
-    buffer_chunk &chunk = chunk_list_.back();
-    // copy first part of bytes
-    std::copy(ptr+bytes_written, ptr+bytes_written+chunk.available(), &chunk.data[chunk.write_cursor]);
-    // adjust remaining size
-    size -= chunk.available();
-    // adjust written bytes
-    bytes_written += chunk.available();
-    // adjust cursor
-    chunk.write_cursor += chunk.available();
-    // append new buffer chunk
-    chunk_list_.push_back(buffer_chunk());
-  }
-  if (size > 0) {
-    buffer_chunk &chunk = chunk_list_.back();
-    // append remaining bytes
-    std::copy(ptr+bytes_written, ptr+bytes_written+size, &chunk.data[chunk.write_cursor]);
-    chunk.write_cursor += size;
-  }
+  return data_.data() + read_cursor_;
 }
 
-void byte_buffer::release(void *bytes, byte_buffer::size_type size)
+byte_buffer::size_type byte_buffer::capacity() const
 {
-  char *ptr = (char*)bytes;
-  size_type bytes_read = 0;
-  while (!chunk_list_.empty() && chunk_list_.front().used() <= size) {
-    buffer_chunk &chunk = chunk_list_.front();
-    // available bytes are not enough
-    // copy first part
-    std::copy(chunk.data.begin()+chunk.read_cursor, chunk.data.begin()+chunk.read_cursor+chunk.used(), ptr+bytes_read);
-    // adjust remaining size
-    size -= chunk.used();
-    // adjust bytes read
-    bytes_read += chunk.used();
-    // pop back
-    chunk_list_.pop_front();
-    // get next chunk
-  }
-  if (size > 0) {
-    buffer_chunk &chunk = chunk_list_.front();
-    // copy rest of bytes
-    std::copy(chunk.data.begin()+chunk.read_cursor, chunk.data.begin()+chunk.read_cursor+size, ptr+bytes_read);
-    // adjust read cursor
-    chunk.read_cursor += size;
-  }
-  if (chunk_list_.empty()) {
-    chunk_list_.push_back(buffer_chunk());
+  return data_.size();
+}
+
+bool byte_buffer::empty() const
+{
+  return read_cursor_ == write_cursor_;
+}
+
+void byte_buffer::clear()
+{
+  read_cursor_ = 0;
+  write_cursor_ = 0;
+}
+
+void byte_buffer::rewind(byte_buffer::size_type begin, byte_buffer::size_type end)
+{
+  if (begin > end || end > data_.size()) {
+    throw std::out_of_range("byte_buffer: can't rewind to bytes " + std::to_string(begin) + " to " + std::to_string(end) + " of " + std::to_string(data_.size()) + " bytes");
   }
+  read_cursor_ = begin;
+  write_cursor_ = end;
 }
 
-byte_buffer::size_type byte_buffer::size() const
+void byte_buffer::grow(byte_buffer::size_type size)
 {
-  return (chunk_list_.size() * BUF_SIZE) - chunk_list_.back().available() - chunk_list_.front().released();
-  if (chunk_list_.size() == 1) {
-    return BUF_SIZE - chunk_list_.front().available();
+  const size_type used = write_cursor_ - read_cursor_;
+  if (read_cursor_ > 0 && used + size <= data_.size()) {
+    // enough space once the released bytes are dropped
+    std::memmove(data_.data(), data_.data() + read_cursor_, used);
   } else {
-    return (chunk_list_.size() * BUF_SIZE) - chunk_list_.back().available();
+    size_type capacity = data_.empty() ? 1024 : data_.size();
+    while (capacity < used + size) {
+      capacity *= 2;
+    }
+    std::vector<char> data(capacity);
+    std::memcpy(data.data(), data_.data() + read_cursor_, used);
+    data_.swap(data);
   }
+  read_cursor_ = 0;
+  write_cursor_ = used;
 }
 
-void byte_buffer::clear()
+void byte_buffer::throw_out_of_range(byte_buffer::size_type size) const
 {
-  chunk_list_.clear();
-  chunk_list_.push_back(buffer_chunk());
+  throw std::out_of_range("byte_buffer: can't release " + std::to_string(size) + " of " + std::to_string(this->size()) + " bytes");
 }
 
 }
@@ -3,6 +3,7 @@
 //
 
 #include "matador/utils/string.hpp"
+#include "matador/utils/date.hpp"
 #include "matador/utils/time.hpp"
 
 #include <stdexcept>
@@ -124,4 +125,117 @@ std::string to_string(const matador::date &x, const char *format)
   return buffer;
 }
 
+const std::size_t iso8601::DATE_SIZE;
+const std::size_t iso8601::TIME_SIZE;
+
+namespace {
+
+void write_digits(char *buffer, int value, int count)
+{
+  for (int i = count - 1; i >= 0; --i) {
+    buffer[i] = (char)('0' + value % 10);
+    value /= 10;
+  }
+}
+
+bool read_digits(const char *str, int count, int &value)
+{
+  value = 0;
+  for (int i = 0; i < count; ++i) {
+    if (str[i] < '0' || str[i] > '9') {
+      return false;
+    }
+    value = value * 10 + (str[i] - '0');
+  }
+  return true;
+}
+
+void write_date(char *buffer, int year, int month, int day)
+{
+  write_digits(buffer, year, 4);
+  buffer[4] = '-';
+  write_digits(buffer + 5, month, 2);
+  buffer[7] = '-';
+  write_digits(buffer + 8, day, 2);
+}
+
+bool read_date(const char *str, std::size_t len, int &year, int &month, int &day)
+{
+  return len >= 10 &&
+         read_digits(str, 4, year) && str[4] == '-' &&
+         read_digits(str + 5, 2, month) && str[7] == '-' &&
+         read_digits(str + 8, 2, day);
+}
+
+}
+
+std::size_t to_iso8601(const matador::date &x, char *buffer)
+{
+  write_date(buffer, x.year(), x.month(), x.day());
+  buffer[10] = '\0';
+  return 10;
+}
+
+std::size_t to_iso8601(const matador::time &x, char *buffer, char separator, bool with_millis)
+{
+  write_date(buffer, x.year(), x.month(), x.day());
+  buffer[10] = separator;
+  write_digits(buffer + 11, x.hour(), 2);
+  buffer[13] = ':';
+  write_digits(buffer + 14, x.minute(), 2);
+  buffer[16] = ':';
+  write_digits(buffer + 17, x.second(), 2);
+  if (!with_millis) {
+    buffer[19] = '\0';
+    return 19;
+  }
+  buffer[19] = '.';
+  write_digits(buffer + 20, x.milli_second(), 3);
+  buffer[23] = '\0';
+  return 23;
+}
+
+void from_iso8601(const char *str, std::size_t len, matador::date &x)
+{
+  int year, month, day;
+  if (!read_date(str, len, year, month, day)) {
+    throw std::logic_error("error parsing date");
+  }
+  x.set(day, month, year);
+}
+
+void from_iso8601(const char *str, std::size_t len, matador::time &x)
+{
+  struct tm tm;
+  memset(&tm, 0, sizeof(struct tm));
+  int year, month, day;
+  if (!read_date(str, len, year, month, day) || len < 19 || (str[10] != 'T' && str[10] != ' ') ||
+      !read_digits(str + 11, 2, tm.tm_hour) || str[13] != ':' ||
+      !read_digits(str + 14, 2, tm.tm_min) || str[16] != ':' ||
+      !read_digits(str + 17, 2, tm.tm_sec)) {
+    throw std::logic_error("error parsing time");
+  }
+  // the fraction is scaled by its number of digits
+  long usec = 0;
+  if (len > 20 && str[19] == '.') {
+    long scale = 100000;
+    for (std::size_t i = 20; i < len && str[i] >= '0' && str[i] <= '9' && scale > 0; ++i) {
+      usec += (str[i] - '0') * scale;
+      scale /= 10;
+    }
+  }
+  tm.tm_year = year - 1900;
+  tm.tm_mon = month - 1;
+  tm.tm_mday = day;
+
+  struct timeval tv;
+#ifdef _MSC_VER
+  tv.tv_sec = (long)time::to_time_t(tm);
+#else
+  tv.tv_sec = time::to_time_t(tm);
+#endif
+  tv.tv_usec = usec;
+  x.set(tv);
+}
+
 }
@@ -182,18 +182,48 @@ time time::parse(const std::string &tstr, const char *format)
     }
   }
 
-  tm.tm_isdst = date::is_daylight_saving(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
   struct timeval tv;
 #ifdef _MSC_VER
-  tv.tv_sec = (long)mktime(&tm);
+  tv.tv_sec = (long)to_time_t(tm);
   tv.tv_usec = usec;
 #else
-  tv.tv_sec = mktime(&tm);
+  tv.tv_sec = to_time_t(tm);
   tv.tv_usec = usec;
 #endif
   return matador::time(tv);
 }
 
+time_t time::to_time_t(struct tm &t)
+{
+  // let mktime apply the rules of the local time zone,
+  // date::is_daylight_saving() only knows the european
+  // rules and is wrong in other time zones and in UTC
+  struct tm guess = t;
+  guess.tm_isdst = -1;
+  time_t result = mktime(&guess);
+  if (guess.tm_hour != t.tm_hour || guess.tm_min != t.tm_min) {
+    // the time is skipped by the switch to daylight
+    // saving time, read it with the offset before
+    guess = t;
+    guess.tm_isdst = 0;
+    result = mktime(&guess);
+  } else {
+    // the time is repeated by the switch back if it
+    // exists with the other offset too, mktime picks
+    // either one so always take the earlier
+    struct tm other = t;
+    other.tm_isdst = guess.tm_isdst > 0 ? 0 : 1;
+    time_t alternative = mktime(&other);
+    if (other.tm_isdst != guess.tm_isdst && other.tm_hour == t.tm_hour &&
+        other.tm_min == t.tm_min && alternative < result) {
+      guess = other;
+      result = alternative;
+    }
+  }
+  t = guess;
+  return result;
+}
+
 void time::set(int year, int month, int day, int hour, int min, int sec, long millis)
 {
   throw_invalid_date(day, month, year);
@@ -210,13 +240,12 @@ void time::set(int year, int month, int day, int hour, int min, int sec, long mi
   t.tm_hour = hour;
   t.tm_min = min;
   t.tm_sec = sec;
-  t.tm_isdst = date::is_daylight_saving(year, month, day);
 
 #ifdef _MSC_VER
-  time_t tt = mktime(&t);
+  time_t tt = to_time_t(t);
   this->time_.tv_sec = (long)tt;
 #else
-  this->time_.tv_sec = mktime(&t);
+  this->time_.tv_sec = to_time_t(t);
 #endif
   this->time_.tv_usec = millis * 1000;
 
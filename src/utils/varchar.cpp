@@ -23,7 +23,7 @@ varchar_base::varchar_base(const varchar_base &x)
   , data_(x.data_)
 {}
 
-varchar_base::varchar_base(varchar_base &&x)
+varchar_base::varchar_base(varchar_base &&x) noexcept
   : capacity_(x.capacity_)
   , data_(std::move(x.data_))
 {
@@ -37,7 +37,7 @@ varchar_base& varchar_base::operator=(const varchar_base &x)
   return *this;
 }
 
-varchar_base &varchar_base::operator=(varchar_base &&x)
+varchar_base &varchar_base::operator=(varchar_base &&x) noexcept
 {
   data_ = std::move(x.data_);
   capacity_ = x.capacity_;
@@ -4,6 +4,8 @@
 #include "matador/object/object_expression.hpp"
 #include "matador/object/object_view.hpp"
 #include "matador/object/generic_access.hpp"
+#include "matador/object/object_id_map.hpp"
+#include "matador/object/object_proxy_accessor.hpp"
 
 #include "matador/utils/algorithm.hpp"
 
@@ -46,6 +48,11 @@ ObjectStoreTestUnit::ObjectStoreTestUnit()
   add_test("belongs_to_many", std::bind(&ObjectStoreTestUnit::test_belongs_to_many, this), "test belongs to many behaviour");
   add_test("observer", std::bind(&ObjectStoreTestUnit::test_observer, this), "test observer functionality");
   add_test("attach_has_many", std::bind(&ObjectStoreTestUnit::test_attach_has_many, this), "test attach has many");
+  add_test("secondary_index", std::bind(&ObjectStoreTestUnit::test_secondary_index, this), "test secondary object indexes");
+  add_test("object_count", std::bind(&ObjectStoreTestUnit::test_object_count, this), "test object counts");
+  add_test("holder_list", std::bind(&ObjectStoreTestUnit::test_holder_list, this), "test object holder bookkeeping");
+  add_test("slab_allocation", std::bind(&ObjectStoreTestUnit::test_slab_allocation, this), "test slab allocation of objects and proxies");
+  add_test("object_id_map", std::bind(&ObjectStoreTestUnit::test_object_id_map, this), "test object id map");
 }
 
 struct basic_test_pair
@@ -1255,3 +1262,294 @@ void ObjectStoreTestUnit::test_attach_has_many()
 
   UNIT_ASSERT_FALSE(node == ostore_.end(), "node must be valid");
 }
+
+void ObjectStoreTestUnit::test_secondary_index()
+{
+  ostore_.attach<person>("person");
+  ostore_.attach<student, person>("student");
+
+  auto george = ostore_.insert(new person("george", matador::date(12, 3, 1980), 180));
+  auto jane = ostore_.insert(new person("jane", matador::date(1, 8, 1987), 165));
+
+  ostore_.create_index<person, std::string>("name");
+  ostore_.create_index<person, unsigned int>("height", index_type::ORDERED);
+
+  UNIT_ASSERT_EXCEPTION((ostore_.create_index<person, std::string>("name")), object_exception, "index for field name of type person already exists", "index must not be created twice");
+  UNIT_ASSERT_EXCEPTION((ostore_.create_index<person, std::string>("color")), object_exception, "couldn't find field color of type person", "unknown field must not be indexed");
+
+  auto tom = ostore_.insert(new student("tom", matador::date(5, 5, 1995), 175));
+  ostore_.insert(new person("otto", matador::date(7, 2, 1972), 190));
+
+  object_view<person> persons(ostore_);
+
+  auto result = persons.find_by("name", "george");
+  UNIT_ASSERT_EQUAL(result.size(), 1UL, "expected one person");
+  UNIT_EXPECT_EQUAL(result.front()->name(), "george", "expected george");
+
+  // derived objects are indexed by the base node
+  result = persons.find_by("name", "tom");
+  UNIT_ASSERT_EQUAL(result.size(), 1UL, "expected one student");
+  UNIT_EXPECT_EQUAL(result.front()->id(), tom->id(), "expected tom");
+
+  result = persons.range<unsigned int>("height", 170, 185);
+  UNIT_ASSERT_EQUAL(result.size(), 2UL, "expected two persons");
+  UNIT_EXPECT_EQUAL(result[0]->name(), "tom", "expected tom first");
+  UNIT_EXPECT_EQUAL(result[1]->name(), "george", "expected george second");
+
+  // unindexed field falls back to a scan
+  result = persons.find_by<matador::date>("birthdate", matador::date(1, 8, 1987));
+  UNIT_ASSERT_EQUAL(result.size(), 1UL, "expected one person");
+  UNIT_EXPECT_EQUAL(result.front()->name(), "jane", "expected jane");
+
+  // outside of a transaction the change is announced
+  ostore_.mark_modified(george);
+  george->name("georgina");
+  george->height(160);
+
+  UNIT_EXPECT_TRUE(persons.find_by("name", "george").empty(), "george must not be found");
+  UNIT_EXPECT_EQUAL(persons.find_by("name", "georgina").size(), 1UL, "expected georgina");
+
+  result = persons.range<unsigned int>("height", 150, 170);
+  UNIT_ASSERT_EQUAL(result.size(), 2UL, "expected two persons");
+  UNIT_EXPECT_EQUAL(result[0]->name(), "georgina", "expected georgina first");
+  UNIT_EXPECT_EQUAL(result[1]->name(), "jane", "expected jane second");
+
+  {
+    matador::transaction tr(ostore_);
+    tr.begin();
+    // within a transaction the non const access marks the object
+    jane->name("janet");
+
+    UNIT_EXPECT_EQUAL(persons.find_by("name", "janet").size(), 1UL, "expected janet");
+
+    tr.rollback();
+  }
+
+  UNIT_EXPECT_TRUE(persons.find_by("name", "janet").empty(), "janet must not be found");
+  UNIT_EXPECT_EQUAL(persons.find_by("name", "jane").size(), 1UL, "expected jane");
+
+  ostore_.remove(tom);
+
+  UNIT_EXPECT_TRUE(persons.find_by("name", "tom").empty(), "tom must not be found");
+  UNIT_EXPECT_EQUAL(persons.range<unsigned int>("height", 0, 200).size(), 3UL, "expected three persons");
+
+  object_view<person> only_persons(ostore_, true);
+  ostore_.insert(new student("tim", matador::date(5, 5, 1996), 172));
+
+  UNIT_EXPECT_EQUAL(persons.find_by("name", "tim").size(), 1UL, "expected tim");
+  UNIT_EXPECT_TRUE(only_persons.find_by("name", "tim").empty(), "student tim must be skipped");
+}
+
+void ObjectStoreTestUnit::test_object_count()
+{
+  ostore_.attach<person>("person");
+  ostore_.attach<student, person>("student");
+  ostore_.attach<course>("course");
+
+  object_view<person> persons(ostore_);
+  object_view<person> only_persons(ostore_, true);
+  object_view<student> students(ostore_);
+
+  UNIT_ASSERT_EQUAL(persons.size(), 0UL, "view must be empty");
+  UNIT_ASSERT_EQUAL(ostore_.object_count<person>(), 0UL, "there must be no persons");
+
+  auto george = ostore_.insert(new person("george", matador::date(12, 3, 1980), 180));
+  ostore_.insert(new person("jane", matador::date(1, 8, 1987), 165));
+  auto tom = ostore_.insert(new student("tom", matador::date(5, 5, 1995), 175));
+  ostore_.insert(new student("tim", matador::date(5, 5, 1996), 172));
+  ostore_.insert(new person("otto", matador::date(7, 2, 1972), 190));
+
+  UNIT_ASSERT_EQUAL(persons.size(), 5UL, "expected five persons");
+  UNIT_ASSERT_EQUAL(persons.size(), (size_t)std::distance(persons.begin(), persons.end()), "size must match iteration");
+  UNIT_ASSERT_EQUAL(only_persons.size(), 3UL, "expected three plain persons");
+  UNIT_ASSERT_EQUAL(only_persons.size(), (size_t)std::distance(only_persons.begin(), only_persons.end()), "size must match iteration");
+  UNIT_ASSERT_EQUAL(students.size(), 2UL, "expected two students");
+  UNIT_ASSERT_EQUAL(ostore_.object_count<person>(), 5UL, "expected five persons");
+  UNIT_ASSERT_EQUAL(ostore_.object_count<student>(), 2UL, "expected two students");
+  UNIT_ASSERT_EQUAL(ostore_.object_count<course>(), 0UL, "expected no courses");
+
+  auto counts = ostore_.object_counts();
+  UNIT_ASSERT_EQUAL(counts.size(), ostore_.size(), "expected counts for all types");
+  UNIT_EXPECT_EQUAL(counts["person"], 3UL, "expected three plain persons");
+  UNIT_EXPECT_EQUAL(counts["student"], 2UL, "expected two students");
+  UNIT_EXPECT_EQUAL(counts["course"], 0UL, "expected no courses");
+
+  ostore_.remove(tom);
+  ostore_.remove(george);
+
+  UNIT_ASSERT_EQUAL(persons.size(), 3UL, "expected three persons");
+  UNIT_ASSERT_EQUAL(only_persons.size(), 2UL, "expected two plain persons");
+  UNIT_ASSERT_EQUAL(students.size(), 1UL, "expected one student");
+
+  ostore_.clear(ostore_.find<student>());
+
+  UNIT_ASSERT_EQUAL(persons.size(), 2UL, "expected two persons");
+  UNIT_ASSERT_EQUAL(students.size(), 0UL, "expected no students");
+
+  ostore_.clear();
+
+  UNIT_ASSERT_EQUAL(persons.size(), 0UL, "expected no persons");
+  UNIT_ASSERT_EQUAL(ostore_.object_count<person>(), 0UL, "expected no persons");
+}
+
+void ObjectStoreTestUnit::test_holder_list()
+{
+  ostore_.attach<person>("person");
+
+  auto george = ostore_.insert(new person("george", matador::date(12, 3, 1980), 180));
+  auto jane = ostore_.insert(new person("jane", matador::date(1, 8, 1987), 165));
+
+  std::vector<object_ptr<person>> copies(10, george);
+  copies.push_back(jane);
+
+  UNIT_ASSERT_EQUAL(copies.front().get(), george.get(), "copy must point to george");
+  UNIT_ASSERT_EQUAL(copies.back().get(), jane.get(), "copy must point to jane");
+
+  // remove holders from the middle, the front and the back
+  copies.erase(copies.begin() + 5);
+  copies.erase(copies.begin());
+  copies.pop_back();
+
+  object_ptr<person> moved(std::move(copies.back()));
+  copies.pop_back();
+  UNIT_ASSERT_EQUAL(moved.get(), george.get(), "moved pointer must point to george");
+
+  moved = jane;
+  UNIT_ASSERT_EQUAL(moved.get(), jane.get(), "reassigned pointer must point to jane");
+
+  {
+    // temporary proxies are deleted with their last holder
+    object_ptr<person> tmp(new person("otto", matador::date(7, 2, 1972), 190));
+    object_ptr<person> tmp_copy(tmp);
+    tmp = object_ptr<person>();
+    UNIT_ASSERT_EQUAL(tmp_copy->name(), std::string("otto"), "temporary copy must be valid");
+  }
+
+  ostore_.remove(george);
+
+  UNIT_ASSERT_TRUE(george.ptr() == nullptr, "removed object must be reset");
+  for (auto &copy : copies) {
+    UNIT_ASSERT_TRUE(copy.ptr() == nullptr, "copy of removed object must be reset");
+  }
+  UNIT_ASSERT_EQUAL(moved.get(), jane.get(), "pointer must still point to jane");
+}
+
+void ObjectStoreTestUnit::test_slab_allocation()
+{
+  auto node = ostore_.attach<person>("person", slab_allocation(4));
+
+  UNIT_ASSERT_TRUE(node->has_slab_allocation(), "node must have slab allocation");
+
+  detail::object_pool *objects = node->object_allocator();
+  detail::object_pool *proxies = node->proxy_allocator();
+
+  std::vector<object_ptr<person>> persons;
+  for (int i = 0; i < 10; ++i) {
+    auto *p = node->create<person>();
+    p->name("person " + std::to_string(i));
+    persons.push_back(ostore_.insert(p));
+  }
+
+  UNIT_ASSERT_EQUAL(objects->size(), 10UL, "expected ten pooled objects");
+  UNIT_ASSERT_EQUAL(objects->slab_count(), 3UL, "expected three object slabs");
+  UNIT_ASSERT_EQUAL(proxies->size(), 10UL, "expected ten pooled proxies");
+  UNIT_ASSERT_TRUE(objects->owns(persons.front().get()), "object must be pooled");
+  UNIT_ASSERT_TRUE(objects->owns(persons.back().get()), "object must be pooled");
+
+  // objects of one slab are placed contiguously
+  auto *first = reinterpret_cast<char*>(persons[0].get());
+  auto *second = reinterpret_cast<char*>(persons[1].get());
+  UNIT_ASSERT_EQUAL((std::size_t)(second - first), objects->element_size(), "objects must be contiguous");
+
+  // objects not created by the node are allocated on the heap
+  auto george = ostore_.insert(new person("george", matador::date(12, 3, 1980), 180));
+  UNIT_ASSERT_FALSE(objects->owns(george.get()), "object must not be pooled");
+  UNIT_ASSERT_EQUAL(proxies->size(), 11UL, "expected eleven pooled proxies");
+
+  ostore_.remove(persons[3]);
+  ostore_.remove(george);
+
+  UNIT_ASSERT_EQUAL(objects->size(), 9UL, "expected nine pooled objects");
+  UNIT_ASSERT_EQUAL(proxies->size(), 9UL, "expected nine pooled proxies");
+
+  // freed elements are reused
+  auto *p = node->create<person>();
+  UNIT_ASSERT_EQUAL(objects->slab_count(), 3UL, "expected three object slabs");
+  ostore_.insert(p);
+
+  // pooled objects can't be handed to the caller
+  detail::object_proxy_accessor accessor;
+  object_proxy *pooled = accessor.proxy(persons[0]);
+  UNIT_ASSERT_EXCEPTION(pooled->release<person>(), object_exception, "object is allocated from slabs and can't be released", "pooled object must not be released");
+  UNIT_ASSERT_NOT_NULL(pooled->obj(), "pooled object must be kept");
+
+  // objects not created by the node stay on the heap
+  auto *heap = new person("otto", matador::date(1, 1, 1990), 175);
+  auto otto = ostore_.insert(heap);
+  UNIT_ASSERT_NULL(accessor.proxy(otto)->object_allocator(), "heap object must not be pooled");
+  UNIT_ASSERT_EQUAL(objects->size(), 10UL, "expected ten pooled objects");
+
+  UNIT_ASSERT_EXCEPTION(node->enable_slab_allocation(sizeof(person), 4), object_exception, "prototype node person isn't empty", "node with objects must not change its allocation");
+
+  persons.clear();
+  ostore_.clear();
+
+  UNIT_ASSERT_EQUAL(objects->size(), 0UL, "expected no pooled objects");
+  UNIT_ASSERT_EQUAL(objects->slab_count(), 0UL, "expected object slabs to be freed");
+  UNIT_ASSERT_EQUAL(proxies->slab_count(), 0UL, "expected proxy slabs to be freed");
+}
+
+void ObjectStoreTestUnit::test_object_id_map()
+{
+  detail::object_id_map id_map;
+
+  std::vector<std::unique_ptr<object_proxy>> proxies;
+  for (unsigned long i = 1; i <= 10000; ++i) {
+    proxies.emplace_back(new object_proxy);
+    UNIT_ASSERT_EQUAL(id_map.insert(i, proxies.back().get()), proxies.back().get(), "expected inserted proxy");
+  }
+
+  UNIT_ASSERT_EQUAL(id_map.size(), 10000UL, "expected 10000 proxies");
+  UNIT_ASSERT_EQUAL(id_map.page_count(), 3UL, "expected three pages");
+  UNIT_ASSERT_EQUAL(id_map.find(1), proxies[0].get(), "expected first proxy");
+  UNIT_ASSERT_EQUAL(id_map.find(5000), proxies[4999].get(), "expected proxy 5000");
+  UNIT_ASSERT_NULL(id_map.find(10001), "expected no proxy");
+
+  // existing ids keep their proxy
+  object_proxy other;
+  UNIT_ASSERT_EQUAL(id_map.insert(1, &other), proxies[0].get(), "expected first proxy");
+  UNIT_ASSERT_EQUAL(id_map.size(), 10000UL, "expected 10000 proxies");
+
+  // empty pages are freed
+  for (unsigned long i = 1; i < detail::object_id_map::PAGE_SIZE; ++i) {
+    UNIT_ASSERT_EQUAL(id_map.erase(i), 1UL, "expected one erased proxy");
+  }
+  UNIT_ASSERT_EQUAL(id_map.erase(1), 0UL, "expected no erased proxy");
+  UNIT_ASSERT_EQUAL(id_map.page_count(), 2UL, "expected two pages");
+  UNIT_ASSERT_NULL(id_map.find(1), "expected no proxy");
+
+  // ids far beyond the used pages go to the overflow
+  object_proxy far;
+  UNIT_ASSERT_EQUAL(id_map.insert(1UL << 40, &far), &far, "expected far proxy");
+  UNIT_ASSERT_EQUAL(id_map.page_count(), 2UL, "expected two pages");
+  UNIT_ASSERT_EQUAL(id_map.find(1UL << 40), &far, "expected far proxy");
+  UNIT_ASSERT_EQUAL(id_map.erase(1UL << 40), 1UL, "expected one erased proxy");
+  UNIT_ASSERT_NULL(id_map.find(1UL << 40), "expected no proxy");
+
+  id_map.clear();
+  UNIT_ASSERT_TRUE(id_map.empty(), "id map must be empty");
+  UNIT_ASSERT_EQUAL(id_map.page_count(), 0UL, "expected no pages");
+
+  // object store lookups
+  ostore_.attach<Item>("item");
+
+  std::vector<object_ptr<Item>> items;
+  for (int i = 0; i < 100; ++i) {
+    items.push_back(ostore_.insert(new Item("item", i)));
+  }
+  unsigned long id = items[50].id();
+  object_proxy *proxy = ostore_.find_proxy(id);
+  UNIT_ASSERT_NOT_NULL(proxy, "expected proxy");
+  UNIT_ASSERT_EQUAL(proxy->obj(), (void*)items[50].get(), "expected item 50");
+  UNIT_ASSERT_NULL(ostore_.find_proxy(items.back().id() + 1), "expected no proxy");
+}
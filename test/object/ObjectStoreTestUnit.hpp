@@ -45,6 +45,11 @@ public:
   void test_belongs_to_many();
   void test_observer();
   void test_attach_has_many();
+  void test_secondary_index();
+  void test_object_count();
+  void test_holder_list();
+  void test_slab_allocation();
+  void test_object_id_map();
 
 private:
   matador::object_store ostore_;
@@ -23,6 +23,8 @@ ObjectTransactiontestUnit::ObjectTransactiontestUnit()
   add_test("nested_rollback", std::bind(&ObjectTransactiontestUnit::test_nested_rollback, this), "test nested transaction rollback");
   add_test("foreign", std::bind(&ObjectTransactiontestUnit::test_foreign, this), "test transaction foreign object");
   add_test("foreign_rollback", std::bind(&ObjectTransactiontestUnit::test_foreign_rollback, this), "test transaction foreign object rollback");
+  add_test("bulk_rollback", std::bind(&ObjectTransactiontestUnit::test_bulk_rollback, this), "test transaction rollback of many actions");
+  add_test("new_reference_rollback", std::bind(&ObjectTransactiontestUnit::test_new_reference_rollback, this), "test transaction rollback of a reference to a new object");
 }
 
 
@@ -374,3 +376,77 @@ void ObjectTransactiontestUnit::test_foreign_rollback()
   UNIT_ASSERT_FALSE(mview.empty(), "view must be empty");
 
 }
+
+void ObjectTransactiontestUnit::test_bulk_rollback()
+{
+  matador::object_store store;
+  store.attach<person>("person");
+
+  std::vector<matador::object_ptr<person>> persons;
+  for (unsigned int i = 0; i < 10000; ++i) {
+    persons.push_back(store.insert(new person("person " + std::to_string(i), matador::date(12, 3, 1980), i)));
+  }
+
+  matador::transaction tr(store);
+
+  try {
+    tr.begin();
+
+    for (auto &p : persons) {
+      p->height(p->height() + 1000);
+    }
+    for (unsigned int i = 0; i < 100; ++i) {
+      store.insert(new person("new person " + std::to_string(i), matador::date(1, 1, 2000), 200));
+    }
+    for (std::size_t i = 0; i < persons.size(); i += 2) {
+      store.remove(persons[i]);
+    }
+
+    UNIT_ASSERT_EQUAL(persons[1]->height(), 1001U, "height must be changed");
+
+    tr.rollback();
+  } catch (std::exception &) {
+    UNIT_FAIL("shouldn't come here");
+  }
+
+  matador::object_view<person> pview(store);
+
+  UNIT_ASSERT_EQUAL(pview.size(), 10000UL, "expected 10000 persons");
+
+  // restored objects may change their position in the view
+  for (auto p : pview) {
+    UNIT_ASSERT_EQUAL(p->name(), "person " + std::to_string(p->height()), "height must be restored");
+  }
+}
+
+void ObjectTransactiontestUnit::test_new_reference_rollback()
+{
+  matador::object_store store;
+  store.attach<child>("child");
+  store.attach<master>("master");
+
+  auto m1 = store.insert(new master("m1"));
+
+  matador::transaction tr(store);
+
+  try {
+    tr.begin();
+
+    // the master refers to a child inserted
+    // within the transaction
+    auto ch1 = store.insert(new child("child 1"));
+    m1->children = ch1;
+
+    UNIT_ASSERT_EQUAL(m1->children->name, "child 1", "name must be valid");
+
+    tr.rollback();
+  } catch (std::exception &) {
+    UNIT_FAIL("shouldn't come here");
+  }
+
+  matador::object_view<child> cview(store);
+
+  UNIT_ASSERT_TRUE(cview.empty(), "child view must be empty");
+  UNIT_ASSERT_TRUE(m1->children.ptr() == nullptr, "child must be reset");
+  UNIT_ASSERT_EQUAL(m1->name, "m1", "name must be restored");
+}
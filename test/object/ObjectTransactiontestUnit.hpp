@@ -24,6 +24,8 @@ public:
   void test_nested_rollback();
   void test_foreign();
   void test_foreign_rollback();
+  void test_bulk_rollback();
+  void test_new_reference_rollback();
 };
 
 #endif //OOS_OBJECTTRANSACTIONTESTUNIT_HPP
@@ -6,13 +6,19 @@
 
 #include "matador/utils/identifier.hpp"
 
+#include "matador/object/identifier_proxy_map.hpp"
+#include "matador/object/object_proxy.hpp"
+#include "matador/object/object_exception.hpp"
+
 #include <memory>
+#include <vector>
 
 PrimaryKeyUnitTest::PrimaryKeyUnitTest()
   : unit_test("pk", "Primary Key Unit Test")
 {
   add_test("create", std::bind(&PrimaryKeyUnitTest::test_create, this), "test create");
   add_test("share", std::bind(&PrimaryKeyUnitTest::test_share, this), "test share");
+  add_test("proxy_map", std::bind(&PrimaryKeyUnitTest::test_identifier_proxy_map, this), "test identifier proxy map");
 }
 
 void PrimaryKeyUnitTest::test_create()
@@ -48,3 +54,93 @@ void PrimaryKeyUnitTest::test_share()
   UNIT_ASSERT_EQUAL(gollum, email.value(), "invalid identifier value");
   UNIT_ASSERT_EQUAL(gollum, shared_email.value(), "invalid identifier value");
 }
+
+void PrimaryKeyUnitTest::test_identifier_proxy_map()
+{
+  std::vector<matador::object_proxy> proxies(1000);
+
+  matador::detail::identifier_proxy_map id_map;
+
+  UNIT_ASSERT_TRUE(id_map.empty(), "map must be empty");
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<unsigned long>(1)) == id_map.end(), "key must not be found");
+
+  for (unsigned long i = 0; i < proxies.size(); ++i) {
+    auto result = id_map.insert(std::make_pair(std::make_shared<matador::identifier<unsigned long>>(i + 1), &proxies[i]));
+    UNIT_ASSERT_TRUE(result.second, "key must be inserted");
+  }
+
+  UNIT_ASSERT_EQUAL(id_map.size(), proxies.size(), "invalid map size");
+  UNIT_ASSERT_FALSE(id_map.insert(std::make_pair(std::make_shared<matador::identifier<unsigned long>>(7UL), &proxies[0])).second, "key must not be inserted twice");
+
+  auto i = id_map.find(matador::identifier<unsigned long>(7));
+  UNIT_ASSERT_TRUE(i != id_map.end(), "key must be found");
+  UNIT_ASSERT_TRUE(i->second == &proxies[6], "invalid proxy");
+  UNIT_ASSERT_TRUE(id_map.find_proxy(std::uint64_t(1000)) == &proxies[999], "invalid proxy");
+  // integral keys of another type don't match
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<unsigned long>(42)) != id_map.end(), "key must be found");
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<int>(42)) == id_map.end(), "key of other type must not be found");
+  UNIT_ASSERT_TRUE(id_map.find_proxy(matador::detail::identifier_key::of(matador::identifier<long>(42))) == nullptr, "key of other type must not be found");
+  UNIT_ASSERT_EXCEPTION(id_map.insert(std::make_pair(std::make_shared<matador::identifier<short>>(2000), &proxies[0])), matador::object_exception, "not the same type", "mixed integral key types must not be inserted");
+
+  // the typed key matches the key read through the serializer
+  matador::identifier<unsigned long> id7(7);
+  matador::detail::identifier_key key = matador::detail::identifier_key::of(id7);
+  UNIT_ASSERT_TRUE(key.type == matador::detail::identifier_key::of(static_cast<const matador::basic_identifier&>(id7)).type, "invalid key type");
+  UNIT_ASSERT_EQUAL(key.value, matador::detail::identifier_key::of(static_cast<const matador::basic_identifier&>(id7)).value, "invalid key value");
+  UNIT_ASSERT_TRUE(id_map.find_proxy(key) == &proxies[6], "invalid proxy");
+  UNIT_ASSERT_TRUE(id_map.find(key) == i, "key must be found");
+
+  for (unsigned long k = 1; k <= proxies.size(); k += 2) {
+    UNIT_ASSERT_EQUAL(id_map.erase(matador::identifier<unsigned long>(k)), 1UL, "key must be erased");
+  }
+  UNIT_ASSERT_EQUAL(id_map.size(), proxies.size() / 2, "invalid map size");
+  UNIT_ASSERT_EQUAL(id_map.erase(matador::identifier<unsigned long>(1)), 0UL, "key must not be erased twice");
+
+  for (unsigned long k = 1; k <= proxies.size(); ++k) {
+    matador::object_proxy *proxy = id_map.find_proxy(std::uint64_t(k));
+    if (k % 2 == 1) {
+      UNIT_ASSERT_TRUE(proxy == nullptr, "erased key must not be found");
+    } else {
+      UNIT_ASSERT_TRUE(proxy == &proxies[k - 1], "remaining key must be found");
+    }
+  }
+
+  std::size_t count = 0;
+  for (auto &entry : id_map) {
+    UNIT_ASSERT_TRUE(entry.second != nullptr, "entry must have a proxy");
+    ++count;
+  }
+  UNIT_ASSERT_EQUAL(count, id_map.size(), "iteration must visit all entries");
+
+  // erased slots are reused and erasing keeps other entries in place
+  auto i2 = id_map.find(matador::identifier<unsigned long>(2));
+  auto i4 = id_map.find(matador::identifier<unsigned long>(4));
+  id_map.erase(i2);
+  UNIT_ASSERT_TRUE(i4->second == &proxies[3], "iterator of other entry must stay valid");
+  UNIT_ASSERT_TRUE(id_map.insert(std::make_pair(std::make_shared<matador::identifier<unsigned long>>(2UL), &proxies[1])).second, "erased key must be inserted again");
+  UNIT_ASSERT_EQUAL(id_map.size(), proxies.size() / 2, "invalid map size");
+
+  // an entry without proxy is still an entry
+  UNIT_ASSERT_TRUE(id_map.insert(std::make_pair(std::make_shared<matador::identifier<unsigned long>>(1UL), nullptr)).second, "key must be inserted");
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<unsigned long>(1)) != id_map.end(), "key without proxy must be found");
+  UNIT_ASSERT_FALSE(id_map.insert(std::make_pair(std::make_shared<matador::identifier<unsigned long>>(1UL), &proxies[0])).second, "key without proxy must not be inserted twice");
+  UNIT_ASSERT_EQUAL(id_map.erase(matador::identifier<unsigned long>(1)), 1UL, "key without proxy must be erased");
+
+  UNIT_ASSERT_EXCEPTION(id_map.insert(std::make_pair(std::make_shared<matador::identifier<std::string>>("key"), &proxies[0])), matador::object_exception, "not the same type", "mixed key types must not be inserted");
+
+  id_map.clear();
+
+  UNIT_ASSERT_TRUE(id_map.empty(), "map must be empty");
+
+  std::vector<std::string> emails({ "max@mustermann.de", "gollum@mittelerde.to", "frodo@auenland.to" });
+  for (std::size_t k = 0; k < emails.size(); ++k) {
+    id_map.insert(std::make_pair(std::make_shared<matador::identifier<std::string>>(emails[k]), &proxies[k]));
+  }
+
+  UNIT_ASSERT_TRUE(id_map.find_proxy(std::string("gollum@mittelerde.to")) == &proxies[1], "invalid proxy");
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<std::string>("frodo@auenland.to"))->second == &proxies[2], "invalid proxy");
+  UNIT_ASSERT_TRUE(id_map.find_proxy(std::string("sam@auenland.to")) == nullptr, "unknown key must not be found");
+  matador::identifier<std::string> frodo("frodo@auenland.to");
+  UNIT_ASSERT_TRUE(id_map.find_proxy(matador::detail::identifier_key::of(frodo)) == &proxies[2], "invalid proxy");
+  UNIT_ASSERT_TRUE(id_map.find(matador::identifier<unsigned long>(1)) == id_map.end(), "key of other type must not be found");
+}
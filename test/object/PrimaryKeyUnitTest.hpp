@@ -15,6 +15,7 @@ public:
 
   void test_create();
   void test_share();
+  void test_identifier_proxy_map();
 };
 
 
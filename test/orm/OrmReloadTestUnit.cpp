@@ -8,6 +8,8 @@
 
 #include "matador/object/object_view.hpp"
 
+#include <algorithm>
+
 using namespace hasmanylist;
 
 OrmReloadTestUnit::OrmReloadTestUnit(const std::string &prefix, const std::string &dns)
@@ -16,6 +18,16 @@ OrmReloadTestUnit::OrmReloadTestUnit(const std::string &prefix, const std::strin
 {
   add_test("load", std::bind(&OrmReloadTestUnit::test_load, this), "test load from table");
   add_test("load_has_one", std::bind(&OrmReloadTestUnit::test_load_has_one, this), "test load has one relation from table");
+  add_test("load_lazy", std::bind(&OrmReloadTestUnit::test_load_lazy, this), "test load objects on demand by primary key");
+  add_test("load_eager", std::bind(&OrmReloadTestUnit::test_load_eager, this), "test load objects with joined relations");
+  add_test("load_eager_has_many", std::bind(&OrmReloadTestUnit::test_load_eager_has_many, this), "test load objects with has many items by owner");
+  add_test("load_lazy_has_many", std::bind(&OrmReloadTestUnit::test_load_lazy_has_many, this), "test load objects on demand with has many items");
+  add_test("load_filtered", std::bind(&OrmReloadTestUnit::test_load_filtered, this), "test load objects matching a condition");
+  add_test("load_chunked", std::bind(&OrmReloadTestUnit::test_load_chunked, this), "test load table in chunks");
+  add_test("load_chunked_loaded", std::bind(&OrmReloadTestUnit::test_load_chunked_loaded, this), "test load already loaded table in chunks");
+  add_test("load_parallel", std::bind(&OrmReloadTestUnit::test_load_parallel, this), "test load tables with several connections");
+  add_test("load_parallel_exhausted", std::bind(&OrmReloadTestUnit::test_load_parallel_exhausted, this), "test load tables in parallel with an exhausted connection pool");
+  add_test("load_slab", std::bind(&OrmReloadTestUnit::test_load_slab, this), "test load table into slab allocated objects");
   add_test("load_has_many", std::bind(&OrmReloadTestUnit::test_load_has_many, this), "test load has many from table");
   add_test("load_has_many_to_many", std::bind(&OrmReloadTestUnit::test_load_has_many_to_many, this), "test load has many to many from table");
 //  add_test("load_has_many_to_many_remove", std::bind(&OrmReloadTestUnit::test_load_has_many_to_many_remove, this), "test load has many to many from table with remove");
@@ -121,6 +133,685 @@ void OrmReloadTestUnit::test_load_has_one()
   p.drop();
 }
 
+void OrmReloadTestUnit::test_load_lazy()
+{
+  matador::persistence p(dns_);
+
+  p.attach<master>("master");
+  p.attach<child>("child");
+
+  p.create();
+
+  unsigned long master_id = 0;
+  unsigned long child_id = 0;
+  {
+    matador::session s(p);
+
+    auto c = s.insert(new child("child 1"));
+    auto m = s.insert(new master("master 1", c));
+
+    master_id = m->id;
+    child_id = c->id;
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<master> t_master_view;
+    typedef matador::object_view<child> t_child_view;
+
+    UNIT_ASSERT_TRUE(t_master_view(s.store()).empty(), "master view must be empty");
+
+    auto mptr = s.get<master>(master_id);
+
+    UNIT_ASSERT_TRUE(mptr.is_loaded(), "master must be loaded");
+    UNIT_ASSERT_EQUAL(mptr->name, "master 1", "invalid master name");
+    UNIT_ASSERT_EQUAL(t_master_view(s.store()).size(), 1UL, "their must be 1 master");
+    UNIT_ASSERT_TRUE(t_child_view(s.store()).empty(), "child view must be empty");
+    UNIT_ASSERT_FALSE(mptr->children.is_loaded(), "child must not be loaded");
+
+    // lazy loading is disabled by default
+    UNIT_ASSERT_FALSE(p.lazy_loading(), "lazy loading must be disabled");
+    UNIT_ASSERT_NULL(mptr->children.get(), "child must not be loaded on demand");
+    UNIT_ASSERT_TRUE(t_child_view(s.store()).empty(), "child view must be empty");
+
+    p.lazy_loading(true);
+
+    // dereference loads the child
+    UNIT_ASSERT_EQUAL(mptr->children->name, "child 1", "invalid child name");
+    UNIT_ASSERT_TRUE(mptr->children.is_loaded(), "child must be loaded");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 1UL, "their must be 1 child");
+
+    auto chptr = s.get<child>(child_id);
+    UNIT_ASSERT_TRUE(chptr == mptr->children, "objects must be the same");
+
+    auto unknown = s.get<master>(master_id + 100);
+    UNIT_ASSERT_NULL(unknown.get(), "master must not be found");
+
+    // full load must not duplicate loaded objects
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_master_view(s.store()).size(), 1UL, "their must be 1 master");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 1UL, "their must be 1 child");
+  }
+
+  // the child of the master is deleted behind the back of the store
+  p.conn().execute("DELETE FROM child WHERE id = " + std::to_string(child_id));
+  p.clear();
+
+  {
+    matador::session s(p, p.pool().acquire());
+
+    auto mptr = s.get<master>(master_id);
+    UNIT_ASSERT_TRUE(mptr.is_loaded(), "master must be loaded");
+
+    // objects are loaded on demand with the connection of the session,
+    // so the child statements are prepared for the leased connection
+    std::size_t misses = s.conn().prepared_cache_misses();
+
+    UNIT_ASSERT_NULL(mptr->children.get(), "dangling child must not be found");
+    UNIT_EXPECT_GREATER(s.conn().prepared_cache_misses(), misses, "child must be loaded with the leased connection");
+
+    s.conn().execute("INSERT INTO child (id, name) VALUES (" + std::to_string(child_id) + ", 'child 1')");
+
+    // the miss is remembered, the child isn't selected again
+    UNIT_ASSERT_NULL(mptr->children.get(), "missed child must not be selected again");
+
+    // a rollback forgets the misses
+    auto tr = s.begin();
+    tr.rollback();
+
+    UNIT_ASSERT_NOT_NULL(mptr->children.get(), "inserted child must be found");
+  }
+
+  // the child of the master is deleted again
+  p.conn().execute("DELETE FROM child WHERE id = " + std::to_string(child_id));
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    auto mptr = s.get<master>(master_id);
+
+    UNIT_ASSERT_NULL(mptr->children.get(), "dangling child must not be found");
+
+    s.conn().execute("INSERT INTO child (id, name) VALUES (" + std::to_string(child_id) + ", 'child 1')");
+
+    UNIT_ASSERT_NULL(mptr->children.get(), "missed child must not be selected again");
+
+    // an insert forgets the misses
+    s.insert(new child("child 2"));
+
+    UNIT_ASSERT_NOT_NULL(mptr->children.get(), "inserted child must be found");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_eager()
+{
+  matador::persistence p(dns_);
+
+  p.attach<child>("child");
+  p.attach<master>("master");
+
+  p.create();
+
+  unsigned long master_id = 0;
+  unsigned long single_id = 0;
+  unsigned long child_id = 0;
+  {
+    matador::session s(p);
+
+    auto c = s.insert(new child("child 1"));
+    auto m = s.insert(new master("master 1", c));
+    auto single = s.insert(new master("master 2"));
+
+    master_id = m->id;
+    single_id = single->id;
+    child_id = c->id;
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<master> t_master_view;
+    typedef matador::object_view<child> t_child_view;
+
+    auto mptr = s.get<master>(master_id, matador::fetch_type::EAGER);
+
+    UNIT_ASSERT_TRUE(mptr.is_loaded(), "master must be loaded");
+    UNIT_ASSERT_EQUAL(mptr->name, "master 1", "invalid master name");
+    UNIT_ASSERT_TRUE(mptr->children.is_loaded(), "child must be loaded with master");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 1UL, "their must be 1 child");
+    UNIT_ASSERT_EQUAL(mptr->children->name, "child 1", "invalid child name");
+    UNIT_ASSERT_EQUAL(mptr->children->id.value(), child_id, "invalid child id");
+
+    auto chptr = s.get<child>(child_id);
+    UNIT_ASSERT_TRUE(chptr == mptr->children, "objects must be the same");
+
+    auto single = s.get<master>(single_id, matador::fetch_type::EAGER);
+
+    UNIT_ASSERT_TRUE(single.is_loaded(), "master must be loaded");
+    UNIT_ASSERT_EQUAL(single->name, "master 2", "invalid master name");
+    UNIT_ASSERT_NULL(single->children.get(), "child must be null");
+    UNIT_ASSERT_EQUAL(t_master_view(s.store()).size(), 2UL, "their must be 2 masters");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 1UL, "their must be 1 child");
+
+    auto unknown = s.get<master>(master_id + 100, matador::fetch_type::EAGER);
+    UNIT_ASSERT_NULL(unknown.get(), "master must not be found");
+
+    // full load must not duplicate eager loaded objects
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_master_view(s.store()).size(), 2UL, "their must be 2 masters");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 1UL, "their must be 1 child");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_filtered()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  unsigned long tall_id = 0;
+  {
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (unsigned int i = 0; i < 10; ++i) {
+      auto pptr = s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 170 + i * 5));
+      if (i == 9) {
+        tall_id = pptr->id();
+      }
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<person> t_person_view;
+
+    auto tallest = s.get<person>(tall_id);
+    UNIT_ASSERT_TRUE(tallest.is_loaded(), "person must be loaded");
+
+    auto tall = s.find<person>(matador::column("height") > 200);
+
+    UNIT_ASSERT_EQUAL(tall.size(), 3UL, "there must be 3 tall persons");
+    for (const auto &pptr : tall) {
+      UNIT_ASSERT_TRUE(pptr.is_loaded(), "person must be loaded");
+      UNIT_EXPECT_GREATER(pptr->height(), 200U, "person must be taller than 200");
+    }
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 3UL, "only tall persons must be loaded");
+
+    auto i = std::find(tall.begin(), tall.end(), tallest);
+    UNIT_ASSERT_TRUE(i != tall.end(), "loaded person must be reused");
+
+    auto named = s.find<person>(matador::column("name") == "person 2" || matador::column("height") == 175);
+
+    UNIT_ASSERT_EQUAL(named.size(), 2UL, "there must be 2 persons");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 5UL, "their must be 5 persons");
+
+    auto ranged = s.find<person>(matador::between(matador::column("height"), 170, 180));
+    UNIT_ASSERT_EQUAL(ranged.size(), 3UL, "there must be 3 persons");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 6UL, "their must be 6 persons");
+
+    // the values of the subquery must be part of the prepared statement
+    auto sub = matador::select({matador::column("id")}).from("person").where(matador::column("height") >= 210);
+    auto tallest_two = s.find<person>(matador::in(matador::column("id"), sub));
+    UNIT_ASSERT_EQUAL(tallest_two.size(), 2UL, "there must be 2 persons");
+    for (const auto &pptr : tallest_two) {
+      UNIT_EXPECT_GREATER(pptr->height(), 205U, "person must be taller than 205");
+    }
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 6UL, "their must be 6 persons");
+
+    auto none = s.find<person>(matador::column("height") > 1000);
+    UNIT_ASSERT_TRUE(none.empty(), "no person must be found");
+
+    // full load must not duplicate loaded objects
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 10UL, "their must be 10 persons");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_eager_has_many()
+{
+  matador::persistence p(dns_);
+
+  p.attach<child>("child");
+  p.attach<children_list>("children_list");
+
+  p.create();
+
+  unsigned long list_id = 0;
+  unsigned long other_id = 0;
+  {
+    matador::session s(p);
+
+    auto children = s.insert(new children_list("children list 1"));
+    auto other = s.insert(new children_list("children list 2"));
+
+    auto kid1 = s.insert(new child("kid 1"));
+    auto kid2 = s.insert(new child("kid 2"));
+    auto kid3 = s.insert(new child("kid 3"));
+
+    s.push_back(children->children, kid1);
+    s.push_back(children->children, kid2);
+    s.push_back(other->children, kid3);
+
+    list_id = children->id;
+    other_id = other->id;
+  }
+
+  p.clear();
+
+  // the kids of the lists are loaded on demand
+  p.lazy_loading(true);
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<children_list> t_children_list_view;
+
+    auto clptr = s.get<children_list>(list_id, matador::fetch_type::EAGER);
+
+    UNIT_ASSERT_TRUE(clptr.is_loaded(), "children list must be loaded");
+    UNIT_ASSERT_EQUAL(clptr->name, "children list 1", "invalid children list name");
+    UNIT_ASSERT_EQUAL(t_children_list_view(s.store()).size(), 1UL, "their must be 1 children list");
+    UNIT_ASSERT_EQUAL(clptr->children.size(), 2UL, "invalid children list size");
+
+    std::vector<std::string> result_names({ "kid 1", "kid 2"});
+    for (auto kid : clptr->children) {
+      auto it = std::find(result_names.begin(), result_names.end(), kid->name);
+      UNIT_EXPECT_FALSE(it == result_names.end(), "kid must be found");
+    }
+
+    auto other = s.get<children_list>(other_id, matador::fetch_type::EAGER);
+
+    UNIT_ASSERT_TRUE(other.is_loaded(), "children list must be loaded");
+    UNIT_ASSERT_EQUAL(other->children.size(), 1UL, "invalid children list size");
+    UNIT_ASSERT_EQUAL(other->children.front()->name, "kid 3", "invalid child name");
+
+    // full load must not duplicate the items
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_children_list_view(s.store()).size(), 2UL, "their must be 2 children lists");
+    UNIT_ASSERT_EQUAL(clptr->children.size(), 2UL, "invalid children list size");
+    UNIT_ASSERT_EQUAL(other->children.size(), 1UL, "invalid children list size");
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    auto clptr = s.get<children_list>(list_id, matador::fetch_type::EAGER);
+    UNIT_ASSERT_EQUAL(clptr->children.size(), 2UL, "invalid children list size");
+
+    s.load();
+
+    typedef matador::object_view<children_list> t_children_list_view;
+    t_children_list_view children_lists(s.store());
+
+    UNIT_ASSERT_EQUAL(children_lists.size(), 2UL, "their must be 2 children lists");
+    for (auto children : children_lists) {
+      UNIT_ASSERT_EQUAL(children->children.size(), children->id == list_id ? 2UL : 1UL, "invalid children list size");
+    }
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_lazy_has_many()
+{
+  matador::persistence p(dns_);
+
+  p.attach<child>("child");
+  p.attach<children_list>("children_list");
+
+  p.create();
+
+  unsigned long list_id = 0;
+  {
+    matador::session s(p);
+
+    auto children = s.insert(new children_list("children list 1"));
+    auto other = s.insert(new children_list("children list 2"));
+
+    auto kid1 = s.insert(new child("kid 1"));
+    auto kid2 = s.insert(new child("kid 2"));
+    auto kid3 = s.insert(new child("kid 3"));
+
+    s.push_back(children->children, kid1);
+    s.push_back(children->children, kid2);
+    s.push_back(other->children, kid3);
+
+    list_id = children->id;
+  }
+
+  p.clear();
+  p.lazy_loading(true);
+
+  {
+    matador::session s(p);
+
+    auto clptr = s.get<children_list>(list_id);
+
+    UNIT_ASSERT_TRUE(clptr.is_loaded(), "children list must be loaded");
+    UNIT_ASSERT_EQUAL(clptr->children.size(), 2UL, "invalid children list size");
+
+    for (auto kid : clptr->children) {
+      UNIT_EXPECT_TRUE(kid->name == "kid 1" || kid->name == "kid 2", "invalid child name");
+    }
+
+    // full load must not duplicate the items
+    s.load();
+
+    UNIT_ASSERT_EQUAL(clptr->children.size(), 2UL, "invalid children list size");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_chunked()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  {
+    // insert some persons
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (int i = 0; i < 25; ++i) {
+      s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 180));
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<person> t_person_view;
+
+    auto cursor = s.cursor<person>();
+
+    UNIT_ASSERT_TRUE(s.load(cursor, 10), "there must be more rows");
+    UNIT_ASSERT_EQUAL(cursor.rows(), 10UL, "their must be 10 rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 10UL, "their must be 10 persons");
+
+    // stop after the next chunk
+    bool finished = s.load(cursor, 10, [](const matador::load_cursor &) {
+      return false;
+    });
+
+    UNIT_ASSERT_FALSE(finished, "load must not be finished");
+    UNIT_ASSERT_EQUAL(cursor.rows(), 20UL, "their must be 20 rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 20UL, "their must be 20 persons");
+
+    // resume
+    std::size_t calls = 0;
+    finished = s.load(cursor, 10, [&calls](const matador::load_cursor &) {
+      ++calls;
+      return true;
+    });
+
+    UNIT_ASSERT_TRUE(finished, "load must be finished");
+    UNIT_ASSERT_TRUE(cursor.finished(), "cursor must be finished");
+    UNIT_ASSERT_EQUAL(calls, 1UL, "progress must be called once");
+    UNIT_ASSERT_EQUAL(cursor.rows(), 25UL, "their must be 25 rows");
+    UNIT_ASSERT_EQUAL(cursor.chunks(), 3UL, "their must be 3 chunks");
+    UNIT_ASSERT_FALSE(s.load(cursor, 10), "there must be no more rows");
+
+    t_person_view persons(s.store());
+    UNIT_ASSERT_EQUAL(persons.size(), 25UL, "their must be 25 persons");
+
+    // full load must not duplicate loaded objects
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_chunked_loaded()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  {
+    // insert some persons
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (int i = 0; i < 25; ++i) {
+      s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 180));
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    typedef matador::object_view<person> t_person_view;
+
+    s.load();
+
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+
+    // chunks of an already loaded table must not duplicate objects
+    auto cursor = s.cursor<person>();
+
+    UNIT_ASSERT_TRUE(s.load(cursor, 10, [](const matador::load_cursor &) { return true; }), "load must be finished");
+    UNIT_ASSERT_EQUAL(cursor.rows(), 25UL, "their must be 25 rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+
+    // read the table again from the beginning
+    cursor.reset();
+
+    UNIT_ASSERT_TRUE(s.load(cursor, 10), "there must be more rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+    UNIT_ASSERT_TRUE(s.load(cursor, 10, [](const matador::load_cursor &) { return true; }), "load must be finished");
+    UNIT_ASSERT_EQUAL(cursor.rows(), 25UL, "their must be 25 rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+
+    // a second cursor on the same table
+    auto other = s.cursor<person>();
+
+    UNIT_ASSERT_TRUE(s.load(other, 7, [](const matador::load_cursor &) { return true; }), "load must be finished");
+    UNIT_ASSERT_EQUAL(other.rows(), 25UL, "their must be 25 rows");
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 25UL, "their must be 25 persons");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_parallel()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+  p.attach<child>("child");
+  p.attach<master>("master");
+
+  p.create();
+
+  {
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (int i = 0; i < 20; ++i) {
+      s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 180));
+      auto c = s.insert(new child("child " + std::to_string(i)));
+      s.insert(new master("master " + std::to_string(i), c));
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    s.load_parallel(3);
+
+    typedef matador::object_view<person> t_person_view;
+    typedef matador::object_view<child> t_child_view;
+    typedef matador::object_view<master> t_master_view;
+
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 20UL, "their must be 20 persons");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 20UL, "their must be 20 children");
+
+    t_master_view masters(s.store());
+    UNIT_ASSERT_EQUAL(masters.size(), 20UL, "their must be 20 masters");
+
+    for (auto mptr : masters) {
+      UNIT_ASSERT_TRUE(mptr->children.is_loaded(), "child must be loaded");
+      std::string suffix = mptr->name.substr(std::string("master ").size());
+      UNIT_EXPECT_EQUAL(mptr->children->name, "child " + suffix, "invalid child");
+    }
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_parallel_exhausted()
+{
+  // the session holds the only pooled connection
+  matador::persistence p(dns_, 0, 1);
+
+  p.attach<person>("person");
+  p.attach<child>("child");
+  p.attach<master>("master");
+
+  p.create();
+
+  {
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (int i = 0; i < 20; ++i) {
+      s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 180));
+      auto c = s.insert(new child("child " + std::to_string(i)));
+      s.insert(new master("master " + std::to_string(i), c));
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    UNIT_ASSERT_EQUAL(p.pool().idle(), 0UL, "pool must not hold an idle connection");
+
+    // falls back to a sequential load
+    s.load_parallel(3);
+
+    typedef matador::object_view<person> t_person_view;
+    typedef matador::object_view<child> t_child_view;
+    typedef matador::object_view<master> t_master_view;
+
+    UNIT_ASSERT_EQUAL(t_person_view(s.store()).size(), 20UL, "their must be 20 persons");
+    UNIT_ASSERT_EQUAL(t_child_view(s.store()).size(), 20UL, "their must be 20 children");
+
+    t_master_view masters(s.store());
+    UNIT_ASSERT_EQUAL(masters.size(), 20UL, "their must be 20 masters");
+
+    for (auto mptr : masters) {
+      UNIT_ASSERT_TRUE(mptr->children.is_loaded(), "child must be loaded");
+    }
+    UNIT_ASSERT_EQUAL(p.pool().size(), 1UL, "pool must hold one connection");
+  }
+
+  p.drop();
+}
+
+void OrmReloadTestUnit::test_load_slab()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person", matador::slab_allocation(8));
+  p.attach<child>("child", matador::slab_allocation(8));
+  p.attach<master>("master", matador::slab_allocation(8));
+
+  p.create();
+
+  {
+    matador::session s(p);
+
+    auto tr = s.begin();
+    for (int i = 0; i < 20; ++i) {
+      s.insert(new person("person " + std::to_string(i), matador::date(18, 5, 1980), 180));
+      auto c = s.insert(new child("child " + std::to_string(i)));
+      s.insert(new master("master " + std::to_string(i), c));
+    }
+    tr.commit();
+  }
+
+  p.clear();
+
+  {
+    matador::session s(p);
+
+    s.load();
+
+    auto node = s.store().find<person>();
+    UNIT_ASSERT_EQUAL(node->object_allocator()->size(), 20UL, "their must be 20 pooled persons");
+    UNIT_ASSERT_EQUAL(node->object_allocator()->slab_count(), 3UL, "their must be 3 person slabs");
+    UNIT_ASSERT_EQUAL(node->proxy_allocator()->size(), 20UL, "their must be 20 pooled person proxies");
+
+    typedef matador::object_view<person> t_person_view;
+    t_person_view persons(s.store());
+    UNIT_ASSERT_EQUAL(persons.size(), 20UL, "their must be 20 persons");
+    for (auto pptr : persons) {
+      UNIT_ASSERT_TRUE(node->object_allocator()->owns(pptr.get()), "person must be pooled");
+    }
+
+    typedef matador::object_view<master> t_master_view;
+    t_master_view masters(s.store());
+    UNIT_ASSERT_EQUAL(masters.size(), 20UL, "their must be 20 masters");
+
+    for (auto mptr : masters) {
+      std::string suffix = mptr->name.substr(std::string("master ").size());
+      UNIT_EXPECT_EQUAL(mptr->children->name, "child " + suffix, "invalid child");
+    }
+
+    p.clear();
+
+    UNIT_ASSERT_EQUAL(node->object_allocator()->slab_count(), 0UL, "person slabs must be freed");
+    UNIT_ASSERT_EQUAL(node->proxy_allocator()->slab_count(), 0UL, "person proxy slabs must be freed");
+  }
+
+  p.drop();
+}
+
 void OrmReloadTestUnit::test_load_has_many()
 {
   matador::persistence p(dns_);
@@ -10,6 +10,16 @@ public:
 
   void test_load();
   void test_load_has_one();
+  void test_load_lazy();
+  void test_load_eager();
+  void test_load_eager_has_many();
+  void test_load_lazy_has_many();
+  void test_load_filtered();
+  void test_load_chunked();
+  void test_load_chunked_loaded();
+  void test_load_parallel();
+  void test_load_parallel_exhausted();
+  void test_load_slab();
   void test_load_has_many();
   void test_load_has_many_to_many();
   void test_load_has_many_to_many_remove();
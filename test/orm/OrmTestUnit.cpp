@@ -10,8 +10,13 @@
 #include "matador/orm/persistence.hpp"
 #include "matador/orm/session.hpp"
 
+#include "matador/object/object_exception.hpp"
 #include "matador/object/object_view.hpp"
 
+#include <atomic>
+#include <limits>
+#include <thread>
+
 using namespace hasmanylist;
 
 OrmTestUnit::OrmTestUnit(const std::string &prefix, const std::string &dns)
@@ -20,6 +25,11 @@ OrmTestUnit::OrmTestUnit(const std::string &prefix, const std::string &dns)
 {
   add_test("create", std::bind(&OrmTestUnit::test_create, this), "test create table");
   add_test("insert", std::bind(&OrmTestUnit::test_insert, this), "test insert into table");
+  add_test("insert_batch", std::bind(&OrmTestUnit::test_insert_batch, this), "test batched insert into table");
+  add_test("insert_batch_bind_limit", std::bind(&OrmTestUnit::test_insert_batch_bind_limit, this), "test batched insert limited by the bind count");
+  add_test("insert_leased", std::bind(&OrmTestUnit::test_insert_leased, this), "test insert with leased connection");
+  add_test("prepare_concurrent", std::bind(&OrmTestUnit::test_prepare_concurrent, this), "test prepare statements for concurrently leased connections");
+  add_test("session_threads", std::bind(&OrmTestUnit::test_session_threads, this), "test object store confinement to the thread of its sessions");
   add_test("select", std::bind(&OrmTestUnit::test_select, this), "test select a table");
   add_test("update", std::bind(&OrmTestUnit::test_update, this), "test update on table");
   add_test("delete", std::bind(&OrmTestUnit::test_delete, this), "test delete from table");
@@ -79,6 +89,233 @@ bool contains(const C &container, const T &value)
   return std::find(std::begin(container), std::end(container), value) != std::end(container);
 }
 
+void OrmTestUnit::test_insert_batch()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  auto i = p.find_table("person");
+  UNIT_ASSERT_TRUE(i != p.end(), "table must be found");
+
+  i->second->batch_size(3);
+
+  UNIT_EXPECT_EQUAL(3UL, i->second->batch_size(), "batch size must be 3");
+
+  matador::session s(p);
+
+  std::vector<std::string> names({ "hans", "otto", "georg", "hilde", "ute", "manfred", "jane", "tim", "ole", "sue" });
+
+  matador::transaction tr = s.begin();
+  try {
+    for (const std::string &name : names) {
+      s.insert(new person(name, matador::date(18, 5, 1980), 180));
+    }
+    tr.commit();
+  } catch (std::exception &ex) {
+    tr.rollback();
+    UNIT_FAIL(ex.what());
+  }
+
+  matador::query<person> q("person");
+  auto res = q.select().execute(p.conn());
+
+  std::vector<std::string> result_names;
+  for (auto &&item : res) {
+    result_names.push_back(item->name());
+  }
+
+  UNIT_ASSERT_EQUAL(result_names.size(), names.size(), "unexpected size");
+
+  for (const std::string &name : names) {
+    UNIT_EXPECT_TRUE(contains(result_names, name), "name must be in result");
+  }
+
+  p.drop();
+}
+
+void OrmTestUnit::test_insert_batch_bind_limit()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  // a full batch of persons has more host values than
+  // sqlite allows, so the rows are split into statements
+  auto i = p.find_table("person");
+  i->second->batch_size(300);
+
+  std::size_t max_binds = p.conn().dialect()->max_bind_count();
+  if (p.conn().type() == "sqlite") {
+    UNIT_ASSERT_EQUAL(999UL, max_binds, "invalid maximum bind count");
+  } else {
+    UNIT_ASSERT_EQUAL(std::numeric_limits<size_t>::max(), max_binds, "bind count must be unlimited by default");
+  }
+
+  matador::session s(p);
+
+  auto insert_persons = [&s](std::size_t first, std::size_t count) {
+    matador::transaction tr = s.begin();
+    for (std::size_t n = first; n < first + count; ++n) {
+      s.insert(new person("person " + std::to_string(n), matador::date(18, 5, 1980), 180));
+    }
+    tr.commit();
+  };
+
+  insert_persons(0, 600);
+
+  std::size_t prepared = s.conn().prepared_cache_hits() + s.conn().prepared_cache_misses();
+
+  // the statements for the full batch and the remainder are reused
+  insert_persons(600, 600);
+
+  UNIT_EXPECT_EQUAL(prepared, s.conn().prepared_cache_hits() + s.conn().prepared_cache_misses(), "insert statements must not be prepared again");
+
+  matador::query<person> q("person");
+  auto res = q.select().execute(p.conn());
+
+  std::size_t count = 0;
+  for (auto first = res.begin(); first != res.end(); ++first) {
+    ++count;
+  }
+
+  UNIT_ASSERT_EQUAL(1200UL, count, "unexpected count of persons");
+
+  p.drop();
+}
+
+void OrmTestUnit::test_insert_leased()
+{
+  matador::persistence p(dns_, 0, 2);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  {
+    matador::session s(p, p.pool().acquire());
+
+    UNIT_ASSERT_TRUE(&s.conn() != &p.conn(), "session must use leased connection");
+    UNIT_ASSERT_EQUAL(p.pool().idle(), 0UL, "pool must not hold an idle connection");
+
+    auto hans = s.insert(new person("hans", matador::date(18, 5, 1980), 180));
+
+    UNIT_EXPECT_GREATER(hans->id(), 0UL, "id must be greater zero");
+  }
+
+  UNIT_ASSERT_EQUAL(p.pool().idle(), 1UL, "leased connection must be given back");
+
+  matador::query<person> q("person");
+  auto res = q.select().where(matador::column("name") == "hans").execute(p.conn());
+
+  auto first = res.begin();
+
+  UNIT_ASSERT_TRUE(first != res.end(), "first must not end");
+
+  std::unique_ptr<person> p1(first.release());
+
+  UNIT_EXPECT_EQUAL("hans", p1->name(), "invalid name");
+
+  ++first;
+
+  p.drop();
+}
+
+void OrmTestUnit::test_prepare_concurrent()
+{
+  matador::persistence p(dns_, 2, 2);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  auto i = p.find_table("person");
+  UNIT_ASSERT_TRUE(i != p.end(), "table must be found");
+  auto tbl = i->second;
+
+  // each thread prepares and releases the statements of
+  // its own leased connection while the other one does
+  // the same with its connection
+  std::atomic<std::size_t> failures(0);
+  auto prepare_and_release = [&p, &tbl, &failures]() {
+    try {
+      matador::connection_lease lease = p.pool().acquire();
+      for (int n = 0; n < 50; ++n) {
+        tbl->prepare(*lease);
+        tbl->release(*lease);
+      }
+      tbl->prepare(*lease);
+    } catch (std::exception &) {
+      ++failures;
+    }
+  };
+
+  std::thread first(prepare_and_release);
+  std::thread second(prepare_and_release);
+  first.join();
+  second.join();
+
+  UNIT_ASSERT_EQUAL(failures.load(), 0UL, "prepare must not fail");
+  UNIT_ASSERT_EQUAL(p.pool().idle(), 2UL, "leased connections must be given back");
+
+  {
+    matador::session s(p, p.pool().acquire());
+    auto hans = s.insert(new person("hans", matador::date(18, 5, 1980), 180));
+    UNIT_EXPECT_GREATER(hans->id(), 0UL, "id must be greater zero");
+  }
+
+  p.drop();
+}
+
+void OrmTestUnit::test_session_threads()
+{
+  matador::persistence p(dns_, 0, 2);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  {
+    matador::session s(p, p.pool().acquire());
+    s.insert(new person("hans", matador::date(18, 5, 1980), 180));
+
+    // the store is confined to this thread, a session
+    // of another thread fails instead of waiting
+    bool rejected = false;
+    std::thread other([&p, &rejected]() {
+      try {
+        matador::session os(p, p.pool().acquire());
+      } catch (matador::object_exception &) {
+        rejected = true;
+      }
+    });
+    other.join();
+
+    UNIT_EXPECT_TRUE(rejected, "session of other thread must be rejected");
+    UNIT_EXPECT_EQUAL(p.pool().idle(), 1UL, "lease of rejected session must be given back");
+
+    // further sessions of this thread are fine
+    matador::session s2(p);
+    s2.insert(new person("georg", matador::date(1, 1, 1990), 175));
+  }
+
+  // once the sessions are gone another thread may use the store
+  std::thread other([&p]() {
+    matador::session os(p, p.pool().acquire());
+    os.insert(new person("otto", matador::date(12, 3, 1975), 185));
+  });
+  other.join();
+
+  matador::object_view<person> persons(p.store());
+  UNIT_ASSERT_EQUAL(persons.size(), 3UL, "there must be 3 persons");
+
+  p.drop();
+}
+
 void OrmTestUnit::test_select()
 {
   matador::persistence p(dns_);
@@ -14,6 +14,11 @@ public:
 
   void test_create();
   void test_insert();
+  void test_insert_batch();
+  void test_insert_batch_bind_limit();
+  void test_insert_leased();
+  void test_prepare_concurrent();
+  void test_session_threads();
   void test_select();
   void test_update();
   void test_delete();
@@ -22,6 +22,8 @@ TransactionTestUnit::TransactionTestUnit(const std::string &name, const std::str
   add_test("list_rollback", std::bind(&TransactionTestUnit::test_has_many_list_rollback, this), "object with object list transaction rollback test");
   add_test("list", std::bind(&TransactionTestUnit::test_has_many_list, this), "object with object list transaction test");
   add_test("vector", std::bind(&TransactionTestUnit::test_has_many_vector, this), "object with object vector transaction test");
+  add_test("partial_update", std::bind(&TransactionTestUnit::test_partial_update, this), "update only changed columns transaction test");
+  add_test("update_after_change", std::bind(&TransactionTestUnit::test_update_after_change, this), "update after change transaction test");
 //  add_test("vector", std::bind(&TransactionTestUnit::test_with_vector, this), "serializable with serializable vector sql test");
 }
 
@@ -510,3 +512,101 @@ std::string TransactionTestUnit::connection_string()
   return dns_;
 }
 
+
+void TransactionTestUnit::test_partial_update()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  matador::session s(p);
+
+  auto hans = s.insert(new person("hans", matador::date(21, 12, 1980), 180));
+
+  // change the name behind the back of the session
+  matador::query<person> q("person");
+  q.update({{"name", "otto"}}).where(matador::column("name") == "hans").execute(p.conn());
+
+  transaction tr = s.begin();
+  try {
+    hans->height(183);
+
+    tr.commit();
+  } catch (sql_exception &) {
+    tr.rollback();
+    UNIT_FAIL("transaction failed");
+  }
+
+  // only the height is written
+  auto res = q.select().where(matador::column("height") == 183).execute(p.conn());
+
+  auto first = res.begin();
+
+  UNIT_ASSERT_TRUE(first != res.end(), "first must not end");
+
+  std::unique_ptr<person> p1((first++).release());
+
+  UNIT_ASSERT_EQUAL("otto", p1->name(), "name must not be overwritten");
+  UNIT_ASSERT_EQUAL(183U, p1->height(), "height must be 183");
+
+  // an update after the change writes the whole row
+  hans->height(185);
+  s.update(hans);
+
+  res = q.select().where(matador::column("height") == 185).execute(p.conn());
+
+  first = res.begin();
+
+  UNIT_ASSERT_TRUE(first != res.end(), "first must not end");
+
+  p1.reset((first++).release());
+
+  UNIT_ASSERT_EQUAL("hans", p1->name(), "name must be written");
+
+  p.drop();
+}
+
+void TransactionTestUnit::test_update_after_change()
+{
+  matador::persistence p(dns_);
+
+  p.attach<person>("person");
+
+  p.create();
+
+  matador::session s(p);
+
+  auto hans = s.insert(new person("hans", matador::date(21, 12, 1980), 180));
+
+  transaction tr = s.begin();
+  try {
+    // changes through a const object_ptr aren't backed up
+    const matador::object_ptr<person> &chans = hans;
+    chans->name("otto");
+    // the backup is taken after the name was changed
+    s.update(hans);
+    // the object is already backed up
+    hans->height(183);
+
+    tr.commit();
+  } catch (sql_exception &) {
+    tr.rollback();
+    UNIT_FAIL("transaction failed");
+  }
+
+  matador::query<person> q("person");
+  auto res = q.select().where(matador::column("height") == 183).execute(p.conn());
+
+  auto first = res.begin();
+
+  UNIT_ASSERT_TRUE(first != res.end(), "first must not end");
+
+  std::unique_ptr<person> p1((first++).release());
+
+  UNIT_ASSERT_EQUAL("otto", p1->name(), "name must be written");
+  UNIT_ASSERT_EQUAL(183U, p1->height(), "height must be 183");
+
+  p.drop();
+}
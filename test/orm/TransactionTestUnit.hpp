@@ -39,6 +39,8 @@ public:
   void test_has_many_list_rollback();
   void test_has_many_list();
   void test_has_many_vector();
+  void test_partial_update();
+  void test_update_after_change();
 
 protected:
   std::string connection_string();
@@ -18,6 +18,8 @@
 #include "ConnectionTestUnit.hpp"
 
 #include "matador/sql/connection.hpp"
+#include "matador/sql/connection_pool.hpp"
+#include "matador/sql/query.hpp"
 
 #include <fstream>
 
@@ -30,6 +32,10 @@ ConnectionTestUnit::ConnectionTestUnit(const std::string &name, const std::strin
 {
   add_test("open_close", std::bind(&ConnectionTestUnit::test_open_close, this), "open sql test");
   add_test("reopen", std::bind(&ConnectionTestUnit::test_reopen, this), "reopen sql test");
+  add_test("pool_acquire_release", std::bind(&ConnectionTestUnit::test_pool_acquire_release, this), "connection pool acquire and release test");
+  add_test("pool_reopen_broken", std::bind(&ConnectionTestUnit::test_pool_reopen_broken, this), "connection pool reopen broken connection test");
+  add_test("pool_schema_cache", std::bind(&ConnectionTestUnit::test_pool_keeps_schema_cache, this), "connection pool keeps schema cache on checkout test");
+  add_test("pool_schema_generation", std::bind(&ConnectionTestUnit::test_pool_shares_schema_generation, this), "connection pool shares schema generation test");
 }
 
 ConnectionTestUnit::~ConnectionTestUnit()
@@ -71,6 +77,133 @@ void ConnectionTestUnit::test_reopen()
   UNIT_ASSERT_FALSE(conn.is_open(), "couldn't close sql sql");
 }
 
+void ConnectionTestUnit::test_pool_acquire_release()
+{
+  matador::connection_pool pool(connection_string(), 1, 2);
+
+  UNIT_ASSERT_EQUAL(pool.size(), 1UL, "pool must hold one connection");
+  UNIT_ASSERT_EQUAL(pool.idle(), 1UL, "pool must hold one idle connection");
+
+  {
+    matador::connection_lease first = pool.acquire();
+
+    UNIT_ASSERT_TRUE(static_cast<bool>(first), "lease must hold a connection");
+    UNIT_ASSERT_TRUE(first->is_open(), "leased connection must be open");
+    UNIT_ASSERT_EQUAL(pool.idle(), 0UL, "pool must not hold an idle connection");
+
+    matador::connection_lease second = pool.acquire();
+
+    UNIT_ASSERT_TRUE(second->is_open(), "leased connection must be open");
+    UNIT_ASSERT_TRUE(first.get() != second.get(), "leased connections must differ");
+    UNIT_ASSERT_TRUE(first->dialect() != second->dialect(), "leased connections must have their own dialect");
+    UNIT_ASSERT_EQUAL(pool.size(), 2UL, "pool must hold two connections");
+
+    // the pool is exhausted
+    matador::connection_lease none = pool.try_acquire();
+
+    UNIT_ASSERT_FALSE(static_cast<bool>(none), "lease of exhausted pool must be empty");
+    UNIT_ASSERT_EQUAL(pool.size(), 2UL, "pool must hold two connections");
+
+    second.release();
+
+    none = pool.try_acquire();
+
+    UNIT_ASSERT_TRUE(static_cast<bool>(none), "lease must hold a connection");
+    UNIT_ASSERT_EQUAL(pool.idle(), 0UL, "pool must not hold an idle connection");
+
+    none.release();
+
+    UNIT_ASSERT_FALSE(static_cast<bool>(second), "released lease must be empty");
+    UNIT_ASSERT_EQUAL(pool.idle(), 1UL, "pool must hold one idle connection");
+
+    matador::connection_lease third = std::move(first);
+
+    UNIT_ASSERT_FALSE(static_cast<bool>(first), "moved lease must be empty");
+    UNIT_ASSERT_TRUE(static_cast<bool>(third), "lease must hold a connection");
+  }
+
+  UNIT_ASSERT_EQUAL(pool.idle(), 2UL, "pool must hold two idle connections");
+}
+
+void ConnectionTestUnit::test_pool_reopen_broken()
+{
+  matador::connection_pool pool(connection_string(), 1, 1);
+
+  size_t closed = 0;
+  pool.on_close([&closed](matador::connection &) { ++closed; });
+
+  matador::connection *conn = nullptr;
+  {
+    matador::connection_lease lease = pool.acquire();
+    conn = lease.get();
+    lease->close();
+  }
+
+  matador::connection_lease lease = pool.acquire();
+
+  UNIT_ASSERT_EQUAL(lease.get(), conn, "pool must reuse connection");
+  UNIT_ASSERT_TRUE(lease->is_open(), "broken connection must be reopened");
+  UNIT_ASSERT_EQUAL(closed, 1UL, "close callback must be called once");
+}
+
+void ConnectionTestUnit::test_pool_keeps_schema_cache()
+{
+  matador::connection_pool pool(connection_string(), 1, 1);
+
+  {
+    matador::connection_lease lease = pool.acquire();
+    lease->execute("CREATE TABLE pool_item (id INTEGER, name VARCHAR(64))");
+    UNIT_ASSERT_EQUAL(lease->schema_cache_size(), 0UL, "schema cache must be empty");
+
+    matador::query<> q("pool_item");
+    q.select({"id", "name"}).from("pool_item").execute(*lease);
+    UNIT_ASSERT_EQUAL(lease->schema_cache_size(), 1UL, "description of pool_item must be cached");
+  }
+
+  {
+    // the health check on checkout must not drop the cache
+    matador::connection_lease lease = pool.acquire();
+    UNIT_ASSERT_EQUAL(lease->schema_cache_size(), 1UL, "description of pool_item must survive checkout");
+
+    lease->execute("DROP TABLE pool_item");
+    UNIT_ASSERT_EQUAL(lease->schema_cache_size(), 0UL, "schema cache must be empty");
+  }
+}
+
+void ConnectionTestUnit::test_pool_shares_schema_generation()
+{
+  matador::connection_pool pool(connection_string(), 2, 2);
+
+  matador::connection_lease first = pool.acquire();
+  matador::connection_lease second = pool.acquire();
+
+  first->execute("CREATE TABLE pool_item (id INTEGER, name VARCHAR(64))");
+
+  matador::query<> q("pool_item");
+  q.select({"id", "name"}).from("pool_item").execute(*first);
+  UNIT_ASSERT_EQUAL(first->schema_cache_size(), 1UL, "description of pool_item must be cached");
+
+  // a schema change of another pooled connection drops the cache
+  second->execute("DROP TABLE pool_item");
+  UNIT_ASSERT_EQUAL(first->schema_cache_size(), 0UL, "schema cache of first connection must be outdated");
+
+  second->execute("CREATE TABLE pool_item (id INTEGER, name VARCHAR(64), age INTEGER)");
+
+  matador::query<> q2("pool_item");
+  auto res = q2.select({"id", "name", "age"}).from("pool_item").execute(*first);
+  UNIT_ASSERT_EQUAL(first->schema_cache_size(), 1UL, "description of pool_item must be cached again");
+
+  // a connection outside the pool keeps its cache
+  matador::connection conn(connection_string());
+  conn.open();
+  q.select({"id", "name"}).from("pool_item").execute(conn);
+  UNIT_ASSERT_EQUAL(conn.schema_cache_size(), 1UL, "description of pool_item must be cached");
+
+  second->execute("DROP TABLE pool_item");
+  UNIT_ASSERT_EQUAL(conn.schema_cache_size(), 1UL, "schema cache of foreign connection must be kept");
+  conn.close();
+}
+
 std::string ConnectionTestUnit::connection_string()
 {
   return dns_;
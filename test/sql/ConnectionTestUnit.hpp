@@ -34,6 +34,10 @@ public:
 
   void test_open_close();
   void test_reopen();
+  void test_pool_acquire_release();
+  void test_pool_reopen_broken();
+  void test_pool_keeps_schema_cache();
+  void test_pool_shares_schema_generation();
 
 protected:
   std::string connection_string();
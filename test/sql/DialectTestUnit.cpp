@@ -21,16 +21,19 @@ DialectTestUnit::DialectTestUnit()
   add_test("drop", std::bind(&DialectTestUnit::test_drop_query, this), "test drop dialect");
   add_test("insert", std::bind(&DialectTestUnit::test_insert_query, this), "test insert dialect");
   add_test("insert_prepare", std::bind(&DialectTestUnit::test_insert_prepare_query, this), "test prepared insert dialect");
+  add_test("insert_rows_prepare", std::bind(&DialectTestUnit::test_insert_rows_prepare_query, this), "test prepared multi row insert dialect");
   add_test("select_all", std::bind(&DialectTestUnit::test_select_all_query, this), "test select all dialect");
   add_test("select_distinct", std::bind(&DialectTestUnit::test_select_distinct_query, this), "test select distinct dialect");
   add_test("select_limit", std::bind(&DialectTestUnit::test_select_limit_query, this), "test select limit dialect");
   add_test("select_ordered", std::bind(&DialectTestUnit::test_select_ordered_query, this), "test select ordered dialect");
   add_test("select_grouped", std::bind(&DialectTestUnit::test_select_grouped_query, this), "test select grouped dialect");
   add_test("select_where", std::bind(&DialectTestUnit::test_select_where_query, this), "test select where dialect");
+  add_test("select_join", std::bind(&DialectTestUnit::test_select_join_query, this), "test select join dialect");
   add_test("update", std::bind(&DialectTestUnit::test_update_query, this), "test update dialect");
   add_test("update_where", std::bind(&DialectTestUnit::test_update_where_query, this), "test update where dialect");
   add_test("update_prepare", std::bind(&DialectTestUnit::test_update_prepare_query, this), "test prepared update dialect");
   add_test("update_where_prepare", std::bind(&DialectTestUnit::test_update_where_prepare_query, this), "test prepared update where dialect");
+  add_test("prepare_cached", std::bind(&DialectTestUnit::test_prepare_cached_query, this), "test cached prepared dialect");
   add_test("delete", std::bind(&DialectTestUnit::test_delete_query, this), "test delete dialect");
   add_test("delete_where", std::bind(&DialectTestUnit::test_delete_where_query, this), "test delete where dialect");
 }
@@ -142,6 +145,36 @@ void DialectTestUnit::test_insert_prepare_query()
   UNIT_ASSERT_EQUAL("INSERT INTO \"person\" (\"id\", \"name\", \"age\") VALUES (?, ?, ?) ", result, "insert statement isn't as expected");
 }
 
+void DialectTestUnit::test_insert_rows_prepare_query()
+{
+  sql s;
+
+  s.append(new detail::insert("person"));
+
+  std::unique_ptr<matador::columns> cols(new columns(columns::WITH_BRACKETS));
+
+  cols->push_back(std::make_shared<column>("id"));
+  cols->push_back(std::make_shared<column>("name"));
+
+  s.append(cols.release());
+
+  std::unique_ptr<matador::detail::values> vals(new detail::values);
+
+  unsigned long id(8);
+  std::string name("hans");
+
+  vals->push_back(std::make_shared<value<unsigned long>>(id));
+  vals->push_back(std::make_shared<value<std::string>>(name));
+  vals->rows = 3;
+
+  s.append(vals.release());
+
+  TestDialect dialect;
+  std::string result = dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("INSERT INTO \"person\" (\"id\", \"name\") VALUES (?, ?), (?, ?), (?, ?) ", result, "insert statement isn't as expected");
+}
+
 void DialectTestUnit::test_select_all_query()
 {
   sql s;
@@ -302,6 +335,38 @@ void DialectTestUnit::test_select_where_query()
   UNIT_ASSERT_EQUAL("SELECT \"id\", \"name\", \"age\" FROM \"person\" WHERE (\"name\" <> 'Hans' AND \"name\" <> 'Dieter') ", result, "select isn't as expected");
 }
 
+void DialectTestUnit::test_select_join_query()
+{
+  sql s;
+
+  s.append(new detail::select);
+
+  std::unique_ptr<matador::columns> cols(new columns(columns::WITHOUT_BRACKETS));
+
+  cols->push_back(std::make_shared<column>("person.id"));
+  cols->push_back(std::make_shared<column>("person.name"));
+  cols->push_back(std::make_shared<column>("address.street"));
+
+  s.append(cols.release());
+
+  s.append(new detail::from("person"));
+
+  s.append(new detail::join("address", detail::token::LEFT_JOIN));
+  s.append(new detail::on(column("address.citizen") == column("person.id")));
+
+  matador::column id("person.id");
+  s.append(new detail::where(id == 7));
+
+  TestDialect dialect;
+  std::string result = dialect.direct(s);
+
+  UNIT_ASSERT_EQUAL("SELECT \"person\".\"id\", \"person\".\"name\", \"address\".\"street\" FROM \"person\" LEFT JOIN \"address\" ON \"address\".\"citizen\" = \"person\".\"id\" WHERE \"person\".\"id\" = 7 ", result, "select isn't as expected");
+
+  result = dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("SELECT \"person\".\"id\", \"person\".\"name\", \"address\".\"street\" FROM \"person\" LEFT JOIN \"address\" ON \"address\".\"citizen\" = \"person\".\"id\" WHERE \"person\".\"id\" = ? ", result, "select isn't as expected");
+}
+
 void DialectTestUnit::test_update_query()
 {
   sql s;
@@ -403,6 +468,111 @@ void DialectTestUnit::test_update_where_prepare_query()
 
 }
 
+void DialectTestUnit::test_prepare_cached_query()
+{
+  sql s;
+
+  s.append(new detail::update);
+  s.append(new detail::tablename("person"));
+  s.append(new detail::set);
+
+  std::unique_ptr<matador::columns> cols(new columns(columns::WITHOUT_BRACKETS));
+
+  std::string dieter("Dieter");
+  unsigned int age54(54);
+  cols->push_back(std::make_shared<detail::value_column<std::string>>("name", dieter));
+  cols->push_back(std::make_shared<detail::value_column<unsigned int>>("age", age54));
+
+  s.append(cols.release());
+
+  TestDialect dialect;
+  std::string result = dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? ", result, "update isn't as expected");
+  UNIT_ASSERT_EQUAL(2UL, dialect.bind_count(), "bind count must be two");
+
+  sql other;
+  other.append(new detail::remove());
+  other.append(new detail::from("person"));
+
+  result = dialect.prepare(other);
+
+  UNIT_ASSERT_EQUAL("DELETE FROM \"person\" ", result, "delete isn't as expected");
+  UNIT_ASSERT_EQUAL(0UL, dialect.bind_count(), "bind count must be zero");
+
+  UNIT_ASSERT_EQUAL(2UL, dialect.prepared_count(), "two statements must be cached");
+
+  // cached statement restores the bind count
+  result = dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? ", result, "update isn't as expected");
+  UNIT_ASSERT_EQUAL(2UL, dialect.bind_count(), "bind count must be two");
+
+  // a fresh sql object with the same structure
+  // but other values hits the cache
+  sql same;
+  same.append(new detail::update);
+  same.append(new detail::tablename("person"));
+  same.append(new detail::set);
+
+  std::unique_ptr<matador::columns> same_cols(new columns(columns::WITHOUT_BRACKETS));
+
+  std::string hans("Hans");
+  unsigned int age23(23);
+  same_cols->push_back(std::make_shared<detail::value_column<std::string>>("name", hans));
+  same_cols->push_back(std::make_shared<detail::value_column<unsigned int>>("age", age23));
+
+  same.append(same_cols.release());
+
+  result = dialect.prepare(same);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? ", result, "update isn't as expected");
+  UNIT_ASSERT_EQUAL(2UL, dialect.bind_count(), "bind count must be two");
+  UNIT_ASSERT_EQUAL(2UL, dialect.prepared_count(), "statement must be served from cache");
+
+  // direct statements aren't cached
+  result = dialect.direct(s);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"='Dieter', \"age\"=54 ", result, "update isn't as expected");
+  UNIT_ASSERT_EQUAL(2UL, dialect.prepared_count(), "direct statement must not be cached");
+
+  // a changed statement is built again
+  matador::column name("name");
+  s.append(new detail::where(name != "Hans"));
+
+  result = dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? WHERE \"name\" <> ? ", result, "update where isn't as expected");
+  UNIT_ASSERT_EQUAL(3UL, dialect.bind_count(), "bind count must be three");
+
+  // conditions differing in their values share the statement,
+  // conditions differing in their columns don't
+  same.append(new detail::where(name != "Otto"));
+
+  result = dialect.prepare(same);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? WHERE \"name\" <> ? ", result, "update where isn't as expected");
+  UNIT_ASSERT_EQUAL(3UL, dialect.prepared_count(), "statement must be served from cache");
+
+  sql other_where;
+  other_where.append(new detail::remove());
+  other_where.append(new detail::from("person"));
+  other_where.append(new detail::where(matador::in(matador::column("id"), {1, 2})));
+
+  result = dialect.prepare(other_where);
+
+  UNIT_ASSERT_EQUAL("DELETE FROM \"person\" WHERE \"id\" IN (?,?) ", result, "delete where isn't as expected");
+  UNIT_ASSERT_EQUAL(2UL, dialect.bind_count(), "bind count must be two");
+  UNIT_ASSERT_EQUAL(4UL, dialect.prepared_count(), "four statements must be cached");
+
+  // another dialect builds its own statement
+  TestDialect other_dialect;
+  result = other_dialect.prepare(s);
+
+  UNIT_ASSERT_EQUAL("UPDATE \"person\" SET \"name\"=?, \"age\"=? WHERE \"name\" <> ? ", result, "update where isn't as expected");
+  UNIT_ASSERT_EQUAL(3UL, other_dialect.bind_count(), "bind count must be three");
+}
+
 void DialectTestUnit::test_delete_query()
 {
   sql s;
@@ -18,16 +18,19 @@ public:
   void test_drop_query();
   void test_insert_query();
   void test_insert_prepare_query();
+  void test_insert_rows_prepare_query();
   void test_select_all_query();
   void test_select_distinct_query();
   void test_select_limit_query();
   void test_select_ordered_query();
   void test_select_grouped_query();
   void test_select_where_query();
+  void test_select_join_query();
   void test_update_query();
   void test_update_where_query();
   void test_update_prepare_query();
   void test_update_where_prepare_query();
+  void test_prepare_cached_query();
   void test_delete_query();
   void test_delete_where_query();
 };
@@ -7,6 +7,9 @@
 #include "../Item.hpp"
 
 #include "matador/sql/query.hpp"
+#include "matador/sql/sql_exception.hpp"
+
+#include <algorithm>
 
 using namespace matador;
 
@@ -34,13 +37,22 @@ QueryTestUnit::QueryTestUnit(const std::string &name, const std::string &msg, co
   add_test("foreign_query", std::bind(&QueryTestUnit::test_foreign_query, this), "test query with foreign key");
   add_test("query", std::bind(&QueryTestUnit::test_query, this), "test query");
   add_test("result_range", std::bind(&QueryTestUnit::test_query_range_loop, this), "test result range loop");
+  add_test("result_stream", std::bind(&QueryTestUnit::test_query_result_stream, this), "test streaming a large result");
   add_test("select", std::bind(&QueryTestUnit::test_query_select, this), "test query select");
   add_test("select_count", std::bind(&QueryTestUnit::test_query_select_count, this), "test query select count");
   add_test("select_columns", std::bind(&QueryTestUnit::test_query_select_columns, this), "test query select columns");
   add_test("select_limit", std::bind(&QueryTestUnit::test_select_limit, this), "test query select limit");
   add_test("update_limit", std::bind(&QueryTestUnit::test_update_limit, this), "test query update limit");
   add_test("prepare", std::bind(&QueryTestUnit::test_prepared_statement, this), "test query prepared statement");
+  add_test("prepared_cache", std::bind(&QueryTestUnit::test_prepared_statement_cache, this), "test prepared statement cache");
   add_test("rows", std::bind(&QueryTestUnit::test_rows, this), "test row value serialization");
+  add_test("schema_cache", std::bind(&QueryTestUnit::test_schema_cache, this), "test table description cache");
+  add_test("result_for_each", std::bind(&QueryTestUnit::test_result_for_each, this), "test result for each with reused objects");
+  add_test("result_for_each_null", std::bind(&QueryTestUnit::test_result_for_each_null, this), "test result for each resets null values");
+  add_test("join", std::bind(&QueryTestUnit::test_join, this), "test query with joined tables");
+  add_test("stream_results", std::bind(&QueryTestUnit::test_stream_results, this), "test reading streamed results");
+  add_test("stream_results_error", std::bind(&QueryTestUnit::test_stream_results_error, this), "test error while reading streamed results");
+  add_test("step_error", std::bind(&QueryTestUnit::test_step_error, this), "test error while stepping through the rows");
 }
 
 template < class C, class T >
@@ -806,6 +818,44 @@ void QueryTestUnit::test_query_range_loop()
 
 }
 
+void QueryTestUnit::test_query_result_stream()
+{
+  connection_.open();
+
+  query<person> q("person");
+
+  // create item table and insert items
+  result<person> res(q.create().execute(connection_));
+
+  const unsigned long count = 500;
+
+  connection_.begin();
+  for (unsigned long i = 1; i <= count; ++i) {
+    person p(i, "person " + std::to_string(i), matador::date(1, 1, 1970), 150 + (unsigned)(i % 50));
+    res = q.insert(p).execute(connection_);
+  }
+  connection_.commit();
+
+  query<> cols;
+
+  auto rowres = cols.select({"id", "name"}).from("person").execute(connection_);
+
+  unsigned long size = 0;
+  long sum = 0;
+  for (auto first = rowres.begin(); first != rowres.end(); ++first) {
+    ++size;
+    std::unique_ptr<row> item(first.release());
+    long id = item->at<long>("id");
+    sum += id;
+    UNIT_EXPECT_EQUAL("person " + std::to_string(id), item->at<std::string>("name"), "invalid value");
+  }
+
+  UNIT_ASSERT_EQUAL(size, count, "result size must be 500");
+  UNIT_ASSERT_EQUAL(sum, (long)(count * (count + 1) / 2), "invalid sum of ids");
+
+  q.drop().execute(connection_);
+}
+
 void QueryTestUnit::test_query_select()
 {
   connection_.open();
@@ -1094,6 +1144,72 @@ void QueryTestUnit::test_prepared_statement()
   q.drop().execute();
 }
 
+void QueryTestUnit::test_prepared_statement_cache()
+{
+  connection_.open();
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  std::size_t hits = connection_.prepared_cache_hits();
+  std::size_t misses = connection_.prepared_cache_misses();
+
+  person p("hans", matador::date(12, 3, 1980), 180);
+  for (unsigned long id = 1; id <= 3; ++id) {
+    p.id(id);
+    statement<person> stmt(q.insert(p).prepare(connection_));
+    stmt.bind(0, &p);
+    stmt.execute();
+  }
+
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_misses(), misses + 1, "insert must be prepared once");
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_hits(), hits + 2, "insert must be reused twice");
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_size(), 1UL, "one statement must be cached");
+
+  {
+    // an acquired statement is never shared
+    statement<person> first_stmt(q.select().prepare(connection_));
+    statement<person> second_stmt(q.select().prepare(connection_));
+
+    UNIT_EXPECT_EQUAL(connection_.prepared_cache_misses(), misses + 3, "both selects must be prepared");
+
+    unsigned long count = 0;
+    auto res = first_stmt.execute();
+    for (auto first = res.begin(); first != res.end(); ++first) {
+      ++count;
+    }
+    UNIT_EXPECT_EQUAL(count, 3UL, "expected three persons");
+  }
+
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_size(), 3UL, "three statements must be cached");
+
+  {
+    statement<person> stmt(q.select().prepare(connection_));
+
+    UNIT_EXPECT_EQUAL(connection_.prepared_cache_hits(), hits + 3, "select must be reused");
+
+    unsigned long count = 0;
+    auto res = stmt.execute();
+    for (auto first = res.begin(); first != res.end(); ++first) {
+      ++count;
+    }
+    UNIT_EXPECT_EQUAL(count, 3UL, "expected three persons");
+  }
+
+  connection_.prepared_cache_capacity(1);
+
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_size(), 1UL, "cache must be shrunk to one statement");
+
+  connection_.prepared_cache_capacity(0);
+
+  UNIT_EXPECT_EQUAL(connection_.prepared_cache_size(), 0UL, "cache must be empty");
+
+  q.drop().execute(connection_);
+
+  connection_.prepared_cache_capacity(32);
+}
+
 void QueryTestUnit::test_rows()
 {
   connection_.open();
@@ -1146,6 +1262,234 @@ void QueryTestUnit::test_rows()
 
 }
 
+void QueryTestUnit::test_schema_cache()
+{
+  connection_.open();
+
+  query<> q("item");
+
+  q.create({
+             make_typed_id_column<long>("id"),
+             make_typed_column<std::string>("name"),
+           }).execute(connection_);
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 0UL, "schema cache must be empty");
+
+  q.insert({"id", "name"}).values({1, "hans"}).execute(connection_);
+  q.insert({"id", "name"}).values({2, "georg"}).execute(connection_);
+
+  for (int i = 0; i < 2; ++i) {
+    auto res = q.select({"id", "name"}).from("item").execute(connection_);
+
+    UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 1UL, "description of item must be cached once");
+
+    unsigned long count = 0;
+    for (auto item : res) {
+      ++count;
+      std::string name = item->at<long>("id") == 1 ? "hans" : "georg";
+      UNIT_EXPECT_EQUAL(name, item->at<std::string>("name"), "invalid value");
+    }
+    UNIT_EXPECT_EQUAL(count, 2UL, "expected two items");
+  }
+
+  connection_.refresh_schema("item");
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 0UL, "schema cache must be empty");
+
+  {
+    statement<row> stmt(q.select({"id", "name"}).from("item").prepare(connection_));
+
+    UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 1UL, "description of item must be cached");
+  }
+
+  // a schema change from a plain sql string drops the cache
+  connection_.execute("ALTER TABLE item ADD age INTEGER");
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 0UL, "schema cache must be empty");
+
+  q.update({{"age", 41}}).execute(connection_);
+
+  auto res = q.select({"id", "age"}).from("item").execute(connection_);
+  for (auto item : res) {
+    UNIT_EXPECT_EQUAL(41, item->at<int>("age"), "invalid value");
+  }
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 1UL, "description of item must be cached");
+
+  // a keyword after a quoted semicolon doesn't start a statement
+  connection_.execute("UPDATE item SET name = '; DROP' WHERE id = 1");
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 1UL, "description of item must be cached");
+
+  if (connection_.type() == "sqlite") {
+    // each statement of a multi statement string is classified
+    connection_.execute("UPDATE item SET age = 42; ALTER TABLE item ADD height INTEGER");
+
+    UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 0UL, "schema cache must be empty");
+  }
+
+  q.drop("item").execute(connection_);
+
+  UNIT_ASSERT_EQUAL(connection_.schema_cache_size(), 0UL, "schema cache must be empty");
+}
+
+void QueryTestUnit::test_result_for_each()
+{
+  connection_.open();
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  std::vector<std::string> names = {"hans", "otto", "georg", "hilde", "trude"};
+
+  unsigned long id = 0;
+  for (const auto &name : names) {
+    ++id;
+    person p(id, name, matador::date(12, 3, 1980), 170 + (unsigned)id);
+    q.insert(p).execute(connection_);
+  }
+
+  auto res = q.select().execute(connection_);
+
+  const person *current = nullptr;
+  unsigned int height = 0;
+  std::size_t count = res.for_each([&](const person &p) {
+    if (current == nullptr) {
+      current = &p;
+    }
+    UNIT_EXPECT_EQUAL(current, &p, "person must be reused");
+    UNIT_EXPECT_TRUE(contains(names, p.name()), "unknown person");
+    height += p.height();
+  });
+
+  UNIT_ASSERT_EQUAL(count, 5UL, "expected five persons");
+  UNIT_ASSERT_EQUAL(height, 865U, "invalid sum of heights");
+
+  res = q.select().execute(connection_);
+
+  std::vector<std::size_t> sizes;
+  const person *first = nullptr;
+  height = 0;
+  count = res.for_each_batch(2, [&](const std::vector<person> &batch) {
+    if (first == nullptr) {
+      first = batch.data();
+    }
+    UNIT_EXPECT_EQUAL(first, batch.data(), "batch must be reused");
+    sizes.push_back(batch.size());
+    for (const auto &p : batch) {
+      height += p.height();
+    }
+  });
+
+  UNIT_ASSERT_EQUAL(count, 5UL, "expected five persons");
+  UNIT_ASSERT_EQUAL(sizes.size(), 3UL, "expected three batches");
+  UNIT_EXPECT_EQUAL(sizes[0], 2UL, "invalid batch size");
+  UNIT_EXPECT_EQUAL(sizes[1], 2UL, "invalid batch size");
+  UNIT_EXPECT_EQUAL(sizes[2], 1UL, "invalid batch size");
+  UNIT_ASSERT_EQUAL(height, 865U, "invalid sum of heights");
+
+  query<> rq("person");
+  auto rows = rq.select({"id", "name", "height"}).from("person").execute(connection_);
+
+  height = 0;
+  count = rows.for_each_batch(3, [&](const std::vector<row> &batch) {
+    for (const auto &r : batch) {
+      height += (unsigned int)r.at<long>("height");
+    }
+  });
+
+  UNIT_ASSERT_EQUAL(count, 5UL, "expected five rows");
+  UNIT_ASSERT_EQUAL(height, 865U, "invalid sum of heights");
+
+  q.drop().execute(connection_);
+}
+
+void QueryTestUnit::test_result_for_each_null()
+{
+  connection_.open();
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  person hans(1, "hans", matador::date(12, 3, 1980), 180);
+  q.insert(hans).execute(connection_);
+
+  query<> rq(connection_, "person");
+  // second row has an empty name and no birthdate,
+  // third row has neither a name nor a birthdate
+  rq.insert({"id", "name", "height"}).values({2, "", 170}).execute();
+  rq.insert({"id", "height"}).values({3, 160}).execute();
+
+  auto res = q.select().order_by("id").asc().execute(connection_);
+
+  std::vector<std::string> names;
+  std::vector<matador::date> birthdates;
+  std::size_t count = res.for_each([&](const person &p) {
+    names.emplace_back(p.name());
+    birthdates.push_back(p.birthdate());
+  });
+
+  UNIT_ASSERT_EQUAL(count, 3UL, "expected three persons");
+  UNIT_EXPECT_EQUAL(names[0], "hans", "invalid name");
+  UNIT_EXPECT_EQUAL(birthdates[0], hans.birthdate(), "invalid birthdate");
+  UNIT_EXPECT_TRUE(names[1].empty(), "name of previous row must not leak");
+  UNIT_ASSERT_NOT_EQUAL(birthdates[1], hans.birthdate(), "birthdate of previous row must not leak");
+  UNIT_EXPECT_TRUE(names[2].empty(), "name of previous row must not leak");
+  UNIT_ASSERT_NOT_EQUAL(birthdates[2], hans.birthdate(), "birthdate of previous row must not leak");
+
+  q.drop().execute(connection_);
+}
+
+void QueryTestUnit::test_join()
+{
+  connection_.open();
+
+  query<> owners(connection_, "owner");
+  query<> pets(connection_, "pet");
+
+  owners.create({
+    make_typed_id_column<long>("id"),
+    make_typed_varchar_column<64>("name")
+  }).execute(connection_);
+  pets.create({
+    make_typed_id_column<long>("id"),
+    make_typed_varchar_column<64>("name"),
+    make_typed_column<long>("owner")
+  }).execute(connection_);
+
+  owners.insert({"id", "name"}).values({1, "hans"}).execute(connection_);
+  owners.insert({"id", "name"}).values({2, "georg"}).execute(connection_);
+  pets.insert({"id", "name", "owner"}).values({1, "bello", 1}).execute(connection_);
+  pets.insert({"id", "name", "owner"}).values({2, "minka", 1}).execute(connection_);
+  pets.insert({"id", "name", "owner"}).values({3, "rex", 2}).execute(connection_);
+
+  query<> q;
+  auto res = q.select({"owner.name", "pet.name", "pet.id"})
+    .from("owner")
+    .join("pet").on(column("pet.owner") == column("owner.id"))
+    .where(column("owner.id") == 1)
+    .execute(connection_);
+
+  std::vector<std::string> names;
+  for (auto r : res) {
+    UNIT_EXPECT_EQUAL("hans", r->at<std::string>("owner.name"), "invalid owner name");
+    UNIT_EXPECT_TRUE(r->at<long>("pet.id") < 3L, "invalid pet id");
+    names.push_back(r->at<std::string>("pet.name"));
+  }
+  std::sort(names.begin(), names.end());
+
+  UNIT_ASSERT_EQUAL(names.size(), 2UL, "expected two pets");
+  UNIT_EXPECT_EQUAL("bello", names[0], "invalid pet name");
+  UNIT_EXPECT_EQUAL("minka", names[1], "invalid pet name");
+
+  UNIT_ASSERT_EXCEPTION(q.select({"owner.name"}).from("owner").on(column("pet.owner") == column("owner.id")), std::logic_error, "invalid next state: [on] (current: from)", "on without join must throw");
+
+  pets.drop().execute(connection_);
+  owners.drop().execute(connection_);
+}
+
 connection QueryTestUnit::create_connection()
 {
   return connection(db_);
@@ -1154,3 +1498,179 @@ connection QueryTestUnit::create_connection()
 std::string QueryTestUnit::db() const {
   return db_;
 }
+
+void QueryTestUnit::test_stream_results()
+{
+  connection_.open();
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  std::vector<std::string> names = {"hans", "otto", "georg", "hilde", "trude"};
+
+  unsigned long id = 0;
+  for (const auto &name : names) {
+    ++id;
+    person p(id, name, matador::date(12, 3, 1980), 170 + (unsigned)id);
+    q.insert(p).execute(connection_);
+  }
+
+  connection_.stream_results(true);
+  UNIT_ASSERT_TRUE(connection_.streams_results(), "connection must stream results");
+
+  unsigned int min_height = 171;
+  auto stmt = q.select().where(matador::column("height") > min_height).prepare(connection_);
+  stmt.bind(0, min_height);
+
+  unsigned int height = 0;
+  std::size_t count = 0;
+  auto res = stmt.execute();
+  for (auto p : res) {
+    UNIT_EXPECT_TRUE(contains(names, p->name()), "unknown person");
+    height += p->height();
+    ++count;
+  }
+
+  UNIT_ASSERT_EQUAL(count, 4UL, "expected four persons");
+  UNIT_ASSERT_EQUAL(height, 694U, "invalid sum of heights");
+
+  // the connection is usable again once all rows are read
+  res = q.select().execute(connection_);
+  count = res.for_each([](const person &) {});
+
+  UNIT_ASSERT_EQUAL(count, 5UL, "expected five persons");
+
+  // a statement may buffer its result anyway
+  stmt = q.select().prepare(connection_);
+  stmt.stream_results(false);
+  res = stmt.execute();
+  count = res.for_each([](const person &) {});
+
+  UNIT_ASSERT_EQUAL(count, 5UL, "expected five persons");
+
+  connection_.stream_results(false);
+  UNIT_ASSERT_FALSE(connection_.streams_results(), "connection must buffer results");
+
+  q.drop().execute(connection_);
+}
+
+void QueryTestUnit::test_stream_results_error()
+{
+  connection_.open();
+
+  // the error is raised by the mysql server while it sends the rows
+  if (connection_.type() != "mysql") {
+    return;
+  }
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  for (unsigned long id = 1; id <= 5; ++id) {
+    person p(id, "person " + std::to_string(id), matador::date(12, 3, 1980), 170 + (unsigned)id);
+    q.insert(p).execute(connection_);
+  }
+
+  // the height of the third person on raises a
+  // "subquery returns more than one row" error
+  connection_.execute("CREATE VIEW failing_person AS SELECT id, name, birthdate, "
+                        "IF(id < 3, height, (SELECT 1 UNION SELECT 2)) AS height FROM person");
+
+  connection_.stream_results(true);
+
+  query<person> failing("failing_person");
+
+  std::size_t count = 0;
+  bool failed = false;
+  try {
+    auto res = failing.select().execute(connection_);
+    count = res.for_each([](const person &) {});
+  } catch (sql_exception &) {
+    failed = true;
+  }
+
+  UNIT_ASSERT_TRUE(failed, "direct streamed result must fail");
+  UNIT_EXPECT_EQUAL(count, 0UL, "count must not be set");
+
+  failed = false;
+  try {
+    auto stmt = failing.select().prepare(connection_);
+    auto res = stmt.execute();
+    count = res.for_each([](const person &) {});
+  } catch (sql_exception &) {
+    failed = true;
+  }
+
+  UNIT_ASSERT_TRUE(failed, "prepared streamed result must fail");
+  UNIT_EXPECT_EQUAL(count, 0UL, "count must not be set");
+
+  connection_.stream_results(false);
+
+  connection_.execute("DROP VIEW failing_person");
+  q.drop().execute(connection_);
+}
+
+void QueryTestUnit::test_step_error()
+{
+  connection_.open();
+
+  // the error is raised by sqlite while it steps to the next row
+  if (connection_.type() != "sqlite") {
+    return;
+  }
+
+  query<person> q("person");
+
+  q.create().execute(connection_);
+
+  for (unsigned long id = 1; id <= 5; ++id) {
+    person p(id, "person " + std::to_string(id), matador::date(12, 3, 1980), 170 + (unsigned)id);
+    q.insert(p).execute(connection_);
+  }
+
+  // the height of the third person on raises an
+  // "integer overflow" error
+  connection_.execute("CREATE VIEW failing_person AS SELECT id, name, birthdate, "
+                        "CASE WHEN id < 3 THEN height ELSE abs(id - id - 9223372036854775807 - 1) END AS height FROM person");
+
+  query<person> failing("failing_person");
+
+  std::size_t count = 0;
+  bool failed = false;
+  try {
+    auto res = failing.select().execute(connection_);
+    count = res.for_each([](const person &) {});
+  } catch (sql_exception &) {
+    failed = true;
+  }
+
+  UNIT_ASSERT_TRUE(failed, "direct result must fail");
+  UNIT_EXPECT_EQUAL(count, 0UL, "count must not be set");
+
+  failed = false;
+  try {
+    auto stmt = failing.select().prepare(connection_);
+    auto res = stmt.execute();
+    count = res.for_each([](const person &) {});
+  } catch (sql_exception &) {
+    failed = true;
+  }
+
+  UNIT_ASSERT_TRUE(failed, "prepared result must fail");
+  UNIT_EXPECT_EQUAL(count, 0UL, "count must not be set");
+
+  // a failing statement followed by another one
+  failed = false;
+  try {
+    connection_.execute("SELECT height FROM failing_person; SELECT id FROM person");
+  } catch (sql_exception &) {
+    failed = true;
+  }
+
+  UNIT_ASSERT_TRUE(failed, "multiple statements must fail");
+
+  connection_.execute("DROP VIEW failing_person");
+  q.drop().execute(connection_);
+}
@@ -40,13 +40,22 @@ public:
   void test_foreign_query();
   void test_query();
   void test_query_range_loop();
+  void test_query_result_stream();
   void test_query_select();
   void test_query_select_count();
   void test_query_select_columns();
   void test_select_limit();
   void test_update_limit();
   void test_prepared_statement();
+  void test_prepared_statement_cache();
   void test_rows();
+  void test_schema_cache();
+  void test_result_for_each();
+  void test_result_for_each_null();
+  void test_join();
+  void test_stream_results();
+  void test_stream_results_error();
+  void test_step_error();
 
 protected:
   matador::connection create_connection();
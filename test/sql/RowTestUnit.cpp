@@ -0,0 +1,121 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include "RowTestUnit.hpp"
+
+#include "matador/sql/row.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+
+using namespace matador;
+
+// growing the values of a row must move them
+static_assert(std::is_nothrow_move_constructible<detail::row_value>::value, "row value must be nothrow move constructible");
+static_assert(std::is_nothrow_move_assignable<detail::row_value>::value, "row value must be nothrow move assignable");
+
+RowTestUnit::RowTestUnit() : unit_test("row", "row test unit")
+{
+  add_test("columns", std::bind(&RowTestUnit::test_columns, this), "test row columns");
+  add_test("values", std::bind(&RowTestUnit::test_values, this), "test row values");
+  add_test("copy", std::bind(&RowTestUnit::test_copy, this), "test copy rows");
+}
+
+void RowTestUnit::test_columns()
+{
+  row r;
+
+  UNIT_ASSERT_TRUE(r.add_column("id"), "column must be added");
+  UNIT_ASSERT_TRUE(r.add_column("name"), "column must be added");
+  UNIT_ASSERT_FALSE(r.add_column("id"), "column must not be added twice");
+
+  UNIT_ASSERT_EQUAL(r.size(), 2UL, "expected two columns");
+  UNIT_ASSERT_TRUE(r.has_column("name"), "row must have column name");
+  UNIT_ASSERT_FALSE(r.has_column("age"), "row must not have column age");
+  UNIT_ASSERT_EQUAL(r.index_of("id"), 0UL, "invalid index");
+  UNIT_ASSERT_EQUAL(r.index_of("name"), 1UL, "invalid index");
+
+  bool caught = false;
+  try {
+    r.index_of("age");
+  } catch (std::out_of_range &) {
+    caught = true;
+  }
+  UNIT_ASSERT_TRUE(caught, "unknown column must throw");
+
+  r.clear();
+
+  UNIT_ASSERT_EQUAL(r.size(), 0UL, "expected no columns");
+  UNIT_ASSERT_FALSE(r.has_column("id"), "row must not have column id");
+}
+
+void RowTestUnit::test_values()
+{
+  row r;
+
+  r.add_column("id");
+  r.add_column("name", std::make_shared<value<std::string>>("hans"));
+  r.add_column("height");
+  r.add_column("birthday");
+
+  UNIT_ASSERT_EQUAL(r.str("id"), "NULL", "value must be null");
+  UNIT_ASSERT_EQUAL(r.at<std::string>("name"), "hans", "invalid value");
+
+  r.set("id", 7L);
+  r.set(2, 1.87);
+  r.set("birthday", matador::date(12, 3, 1980));
+
+  UNIT_ASSERT_EQUAL(r.at<long>(0), 7L, "invalid value");
+  UNIT_ASSERT_EQUAL(r.at<double>("height"), 1.87, "invalid value");
+  UNIT_ASSERT_EQUAL(r.at<matador::date>("birthday"), matador::date(12, 3, 1980), "invalid value");
+  UNIT_ASSERT_EQUAL(r.str("name"), "'hans'", "invalid string");
+
+  // text may be read as varchar
+  UNIT_ASSERT_EQUAL(r.at<varchar<32>>("name"), "hans", "invalid value");
+
+  bool caught = false;
+  try {
+    r.at<int>("id");
+  } catch (std::bad_cast &) {
+    caught = true;
+  }
+  UNIT_ASSERT_TRUE(caught, "reading another type must throw");
+
+  r.set("name", std::shared_ptr<detail::basic_value>(new value<int>(4711)));
+  UNIT_ASSERT_EQUAL(r.at<int>("name"), 4711, "invalid value");
+  r.set("name", std::shared_ptr<detail::basic_value>(new null_value));
+  UNIT_ASSERT_EQUAL(r.str("name"), "NULL", "value must be null");
+}
+
+void RowTestUnit::test_copy()
+{
+  row prototype;
+
+  prototype.add_column("id");
+  prototype.add_column("name");
+  prototype.set("id", 0L);
+
+  row first(prototype);
+  row second(prototype);
+
+  first.set("id", 1L);
+  first.set("name", std::string("hans"));
+  second.set("id", 2L);
+  second.set("name", std::string("otto"));
+
+  // copies don't share their values
+  UNIT_ASSERT_EQUAL(prototype.at<long>("id"), 0L, "invalid value");
+  UNIT_ASSERT_EQUAL(first.at<long>("id"), 1L, "invalid value");
+  UNIT_ASSERT_EQUAL(second.at<long>("id"), 2L, "invalid value");
+  UNIT_ASSERT_EQUAL(first.at<std::string>("name"), "hans", "invalid value");
+  UNIT_ASSERT_EQUAL(second.at<std::string>("name"), "otto", "invalid value");
+
+  // adding a column doesn't change the shared columns
+  UNIT_ASSERT_TRUE(first.add_column("age"), "column must be added");
+  UNIT_ASSERT_TRUE(first.has_column("age"), "row must have column age");
+  UNIT_ASSERT_FALSE(second.has_column("age"), "row must not have column age");
+  UNIT_ASSERT_FALSE(prototype.has_column("age"), "row must not have column age");
+  UNIT_ASSERT_EQUAL(second.size(), 2UL, "expected two columns");
+}
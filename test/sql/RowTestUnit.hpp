@@ -0,0 +1,22 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_ROWTESTUNIT_HPP
+#define OOS_ROWTESTUNIT_HPP
+
+
+#include "matador/unit/unit_test.hpp"
+
+class RowTestUnit : public matador::unit_test
+{
+public:
+  RowTestUnit();
+
+  void test_columns();
+  void test_values();
+  void test_copy();
+};
+
+
+#endif //OOS_ROWTESTUNIT_HPP
@@ -6,9 +6,14 @@
 
 #include "connections.hpp"
 
+#include "../Item.hpp"
+
 #include "matador/sql/connection.hpp"
 #include "matador/sql/column.hpp"
 #include "matador/sql/dialect_token.hpp"
+#include "matador/sql/query.hpp"
+
+#include "matador/db/sqlite/sqlite_dialect.hpp"
 
 using namespace matador;
 
@@ -17,6 +22,9 @@ SQLiteDialectTestUnit::SQLiteDialectTestUnit()
 {
   add_test("update_limit", std::bind(&SQLiteDialectTestUnit::test_update_with_limit, this), "test sqlite update limit compile");
   add_test("delete_limit", std::bind(&SQLiteDialectTestUnit::test_delete_with_limit, this), "test sqlite delete limit compile");
+  add_test("max_bind_count", std::bind(&SQLiteDialectTestUnit::test_max_bind_count, this), "test sqlite maximum bind count");
+  add_test("binary_date_time", std::bind(&SQLiteDialectTestUnit::test_binary_date_time, this), "test sqlite binary date and time storage");
+  add_test("convert_date_time", std::bind(&SQLiteDialectTestUnit::test_convert_date_time, this), "test sqlite date and time storage conversion");
 }
 
 void SQLiteDialectTestUnit::test_update_with_limit()
@@ -66,3 +74,120 @@ void SQLiteDialectTestUnit::test_delete_with_limit()
 
   UNIT_ASSERT_EQUAL("DELETE FROM \"person\" WHERE \"rowid\" IN (SELECT \"rowid\" FROM \"person\" WHERE \"name\" <> 'Hans' LIMIT 1 ) ", result, "delete where isn't as expected");
 }
+
+namespace {
+
+std::size_t count_items(matador::connection &conn, const std::string &name, long value)
+{
+  query<> q(conn, "item");
+  auto res = q.select({"id"}).from("item").where(matador::column(name) == value).execute();
+  return res.for_each([](const row &) {});
+}
+
+}
+
+void SQLiteDialectTestUnit::test_max_bind_count()
+{
+  matador::connection conn(::connection::sqlite);
+
+  UNIT_ASSERT_EQUAL(999UL, conn.dialect()->max_bind_count(), "invalid maximum bind count");
+}
+
+void SQLiteDialectTestUnit::test_binary_date_time()
+{
+  matador::connection conn(::connection::sqlite);
+  conn.open();
+
+  auto *dialect = static_cast<sqlite::sqlite_dialect*>(conn.dialect());
+  dialect->store_binary_date_time(true);
+
+  query<Item> q("item");
+  q.create().execute(conn);
+
+  matador::date birthday(15, 3, 2015);
+  matador::time stamp(2015, 3, 15, 13, 56, 23, 5);
+
+  Item hans("Hans", 4711);
+  hans.id(1UL);
+  hans.set_date(birthday);
+  hans.set_time(stamp);
+  q.insert(hans).execute(conn);
+
+  Item georg("Georg", 4712);
+  georg.id(2UL);
+  georg.set_date(birthday);
+  georg.set_time(stamp);
+  auto stmt = q.insert(georg).prepare(conn);
+  stmt.bind(0, &georg);
+  stmt.execute();
+
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_date", birthday.julian_date()), 2UL, "dates must be stored as julian day");
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_time", (long)sqlite::sqlite_dialect::epoch_micro_seconds(stamp)), 2UL, "times must be stored as microseconds");
+
+  long julian_date = birthday.julian_date();
+  stmt = q.select().where(matador::column("val_date") == julian_date).prepare(conn);
+  stmt.bind(0, julian_date);
+  auto res = stmt.execute();
+
+  std::size_t count = 0;
+  for (auto item : res) {
+    UNIT_EXPECT_EQUAL(item->get_date(), birthday, "invalid date");
+    UNIT_EXPECT_EQUAL(item->get_time(), stamp, "invalid time");
+    ++count;
+  }
+  UNIT_ASSERT_EQUAL(count, 2UL, "expected two items");
+
+  q.drop().execute(conn);
+}
+
+void SQLiteDialectTestUnit::test_convert_date_time()
+{
+  matador::connection conn(::connection::sqlite);
+  conn.open();
+
+  auto *dialect = static_cast<sqlite::sqlite_dialect*>(conn.dialect());
+
+  query<Item> q("item");
+  q.create().execute(conn);
+
+  matador::date birthday(31, 12, 2016);
+  matador::time stamp(2016, 7, 1, 23, 5, 42, 5);
+
+  Item hans("Hans", 4711);
+  hans.id(1UL);
+  hans.set_date(birthday);
+  hans.set_time(stamp);
+  q.insert(hans).execute(conn);
+
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_date", birthday.julian_date()), 0UL, "date must be stored as text");
+
+  dialect->store_binary_date_time(true);
+  conn.execute(dialect->convert_date_time("item", "val_date", data_type::type_date));
+  conn.execute(dialect->convert_date_time("item", "val_time", data_type::type_time));
+
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_date", birthday.julian_date()), 1UL, "date must be stored as julian day");
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_time", (long)sqlite::sqlite_dialect::epoch_micro_seconds(stamp)), 1UL, "time must be stored as microseconds");
+
+  auto res = q.select().execute(conn);
+  for (auto item : res) {
+    UNIT_EXPECT_EQUAL(item->get_date(), birthday, "invalid date");
+    UNIT_EXPECT_EQUAL(item->get_time(), stamp, "invalid time");
+  }
+
+  dialect->store_binary_date_time(false);
+  conn.execute(dialect->convert_date_time("item", "val_date", data_type::type_date));
+  conn.execute(dialect->convert_date_time("item", "val_time", data_type::type_time));
+
+  UNIT_ASSERT_EQUAL(count_items(conn, "val_date", birthday.julian_date()), 0UL, "date must be stored as text");
+
+  res = q.select().where(matador::column("val_date") == matador::to_string(birthday)).execute(conn);
+  std::size_t count = 0;
+  for (auto item : res) {
+    UNIT_EXPECT_EQUAL(item->get_date(), birthday, "invalid date");
+    UNIT_EXPECT_EQUAL(item->get_time(), stamp, "invalid time");
+    ++count;
+  }
+  UNIT_ASSERT_EQUAL(count, 1UL, "expected one item");
+
+  q.drop().execute(conn);
+}
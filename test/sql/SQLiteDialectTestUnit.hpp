@@ -15,6 +15,9 @@ public:
 
   void test_update_with_limit();
   void test_delete_with_limit();
+  void test_max_bind_count();
+  void test_binary_date_time();
+  void test_convert_date_time();
 };
 
 
@@ -27,6 +27,7 @@
 #include "utils/FactoryTestUnit.hpp"
 #include "utils/StringTestUnit.hpp"
 #include "utils/SequencerTestUnit.hpp"
+#include "utils/ByteBufferTestUnit.hpp"
 
 #include "object/ObjectStoreTestUnit.hpp"
 #include "object/ObjectPrototypeTestUnit.hpp"
@@ -47,6 +48,7 @@
 #include "sql/DialectTestUnit.hpp"
 #include "sql/QueryTestUnit.hpp"
 #include "sql/ConditionUnitTest.hpp"
+#include "sql/RowTestUnit.hpp"
 #include "sql/MSSQLDialectTestUnit.hpp"
 #include "sql/SQLiteDialectTestUnit.hpp"
 
@@ -90,6 +92,7 @@ int main(int argc, char *argv[])
   suite.register_unit(new FactoryTestUnit);
   suite.register_unit(new StringTestUnit);
   suite.register_unit(new SequencerTestUnit);
+  suite.register_unit(new ByteBufferTestUnit);
 
   suite.register_unit(new PrimaryKeyUnitTest);
   suite.register_unit(new PrototypeTreeTestUnit);
@@ -101,6 +104,7 @@ int main(int argc, char *argv[])
   suite.register_unit(new RelationTestUnit);
 
   suite.register_unit(new ConditionUnitTest);
+  suite.register_unit(new RowTestUnit);
   suite.register_unit(new DialectTestUnit);
 
 #if defined(MATADOR_MYSQL) && defined(MATADOR_MYSQL_TEST)
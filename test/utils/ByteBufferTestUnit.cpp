@@ -0,0 +1,130 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#include <matador/utils/byte_buffer.hpp>
+#include "ByteBufferTestUnit.hpp"
+
+#include <stdexcept>
+#include <string>
+
+ByteBufferTestUnit::ByteBufferTestUnit() : unit_test("byte_buffer", "byte buffer test unit")
+{
+  add_test("append_release", std::bind(&ByteBufferTestUnit::test_append_release, this), "append and release bytes");
+  add_test("view", std::bind(&ByteBufferTestUnit::test_view, this), "release bytes without copying");
+  add_test("grow", std::bind(&ByteBufferTestUnit::test_grow, this), "grow byte buffer");
+  add_test("clear", std::bind(&ByteBufferTestUnit::test_clear, this), "clear byte buffer");
+  add_test("rewind", std::bind(&ByteBufferTestUnit::test_rewind, this), "read byte ranges again");
+}
+
+ByteBufferTestUnit::~ByteBufferTestUnit() {}
+
+void ByteBufferTestUnit::test_append_release()
+{
+  matador::byte_buffer buffer;
+
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+
+  int i = 4711;
+  double d = 3.1415;
+  buffer.append(&i, sizeof(i));
+  buffer.append(&d, sizeof(d));
+
+  UNIT_ASSERT_EQUAL(buffer.size(), sizeof(i) + sizeof(d), "invalid size");
+
+  int ri = 0;
+  double rd = 0.0;
+  buffer.release(&ri, sizeof(ri));
+  UNIT_ASSERT_EQUAL(buffer.size(), sizeof(d), "invalid size");
+  buffer.release(&rd, sizeof(rd));
+
+  UNIT_ASSERT_EQUAL(ri, 4711, "invalid value");
+  UNIT_ASSERT_EQUAL(rd, 3.1415, "invalid value");
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+
+  UNIT_ASSERT_EXCEPTION(buffer.release(&ri, sizeof(ri)), std::out_of_range, "byte_buffer: can't release 4 of 0 bytes", "release must fail");
+}
+
+void ByteBufferTestUnit::test_view()
+{
+  matador::byte_buffer buffer;
+
+  std::string str("hello world");
+  buffer.append(str.c_str(), str.size());
+
+  const char *hello = buffer.view(5);
+  UNIT_ASSERT_EQUAL(std::string(hello, 5), "hello", "invalid view");
+  UNIT_ASSERT_EQUAL(buffer.size(), 6UL, "invalid size");
+
+  const char *world = buffer.view(6);
+  UNIT_ASSERT_EQUAL(std::string(world, 6), " world", "invalid view");
+  UNIT_ASSERT_EQUAL(hello + 5, world, "views must be contiguous");
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+}
+
+void ByteBufferTestUnit::test_grow()
+{
+  matador::byte_buffer buffer;
+
+  for (unsigned long i = 0; i < 10000; ++i) {
+    buffer.append(&i, sizeof(i));
+  }
+  UNIT_ASSERT_EQUAL(buffer.size(), 10000 * sizeof(unsigned long), "invalid size");
+  UNIT_ASSERT_TRUE(buffer.capacity() >= buffer.size(), "capacity must cover size");
+
+  // release half of the values and append them again
+  unsigned long val = 0;
+  for (unsigned long i = 0; i < 5000; ++i) {
+    buffer.release(&val, sizeof(val));
+    UNIT_ASSERT_EQUAL(val, i, "invalid value");
+  }
+  for (unsigned long i = 10000; i < 20000; ++i) {
+    buffer.append(&i, sizeof(i));
+  }
+  for (unsigned long i = 5000; i < 20000; ++i) {
+    buffer.release(&val, sizeof(val));
+    UNIT_ASSERT_EQUAL(val, i, "invalid value");
+  }
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+}
+
+void ByteBufferTestUnit::test_clear()
+{
+  matador::byte_buffer buffer;
+
+  buffer.reserve(4096);
+  UNIT_ASSERT_TRUE(buffer.capacity() >= 4096, "capacity must be reserved");
+
+  std::string str(1000, 'x');
+  buffer.append(str.c_str(), str.size());
+  const char *first = buffer.view(10);
+
+  buffer.clear();
+
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+  UNIT_ASSERT_TRUE(buffer.capacity() >= 4096, "capacity must be retained");
+
+  // the memory is reused
+  buffer.append(str.c_str(), str.size());
+  UNIT_ASSERT_EQUAL(buffer.view(10), first, "memory must be reused");
+}
+
+void ByteBufferTestUnit::test_rewind()
+{
+  matador::byte_buffer buffer;
+
+  std::string str("hello world");
+  buffer.append(str.c_str(), str.size());
+
+  // read the ranges from back to front
+  buffer.rewind(6, 11);
+  UNIT_ASSERT_EQUAL(std::string(buffer.view(5), 5), "world", "invalid view");
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+
+  buffer.rewind(0, 5);
+  UNIT_ASSERT_EQUAL(buffer.size(), 5UL, "invalid size");
+  UNIT_ASSERT_EQUAL(std::string(buffer.view(5), 5), "hello", "invalid view");
+  UNIT_ASSERT_TRUE(buffer.empty(), "buffer must be empty");
+
+  UNIT_ASSERT_EXCEPTION(buffer.rewind(5, 0), std::out_of_range, "byte_buffer: can't rewind to bytes 5 to 0 of 1024 bytes", "rewind must fail");
+}
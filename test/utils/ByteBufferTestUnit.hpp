@@ -0,0 +1,25 @@
+//
+// Created by sascha on 10/18/26.
+//
+
+#ifndef OOS_BYTEBUFFERTESTUNIT_HPP
+#define OOS_BYTEBUFFERTESTUNIT_HPP
+
+
+#include "matador/unit/unit_test.hpp"
+
+class ByteBufferTestUnit : public matador::unit_test
+{
+public:
+  ByteBufferTestUnit();
+  virtual ~ByteBufferTestUnit();
+
+  void test_append_release();
+  void test_view();
+  void test_grow();
+  void test_clear();
+  void test_rewind();
+};
+
+
+#endif //OOS_BYTEBUFFERTESTUNIT_HPP
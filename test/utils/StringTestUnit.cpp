@@ -5,12 +5,19 @@
 #include "StringTestUnit.hpp"
 
 #include "matador/utils/string.hpp"
+#include "matador/utils/date.hpp"
+#include "matador/utils/time.hpp"
+
+#include <cstring>
+#include <stdexcept>
 
 StringTestUnit::StringTestUnit()
   : unit_test("string", "string test unit")
 {
   add_test("split", std::bind(&StringTestUnit::test_split, this), "test split");
   add_test("trim", std::bind(&StringTestUnit::test_trim, this), "test trim");
+  add_test("iso8601_date", std::bind(&StringTestUnit::test_iso8601_date, this), "test iso 8601 date conversion");
+  add_test("iso8601_time", std::bind(&StringTestUnit::test_iso8601_time, this), "test iso 8601 time conversion");
 }
 
 void StringTestUnit::test_split()
@@ -37,3 +44,69 @@ void StringTestUnit::test_trim()
 
   UNIT_ASSERT_EQUAL(result, str, "expect string must be '" + str + "'");
 }
+
+void StringTestUnit::test_iso8601_date()
+{
+  matador::date d(5, 3, 2015);
+
+  char buffer[matador::iso8601::DATE_SIZE];
+  std::size_t len = matador::to_iso8601(d, buffer);
+
+  UNIT_ASSERT_EQUAL(len, 10UL, "expected length must be 10");
+  UNIT_ASSERT_EQUAL(std::string(buffer), "2015-03-05", "invalid date string");
+  UNIT_ASSERT_EQUAL(std::string(buffer), matador::to_string(d), "date string must match to_string");
+
+  matador::date result;
+  matador::from_iso8601(buffer, len, result);
+
+  UNIT_ASSERT_EQUAL(result, d, "dates must be equal");
+
+  const char *datetime = "2016-12-31T10:11:12";
+  matador::from_iso8601(datetime, strlen(datetime), result);
+
+  UNIT_ASSERT_EQUAL(result, matador::date(31, 12, 2016), "time part must be ignored");
+
+  UNIT_ASSERT_EXCEPTION(matador::from_iso8601("2015-3-05", 9, result), std::logic_error, "error parsing date", "short date must throw");
+  UNIT_ASSERT_EXCEPTION(matador::from_iso8601("2015/03/05", 10, result), std::logic_error, "error parsing date", "invalid separator must throw");
+}
+
+void StringTestUnit::test_iso8601_time()
+{
+  matador::time t(2015, 3, 15, 13, 6, 2, 5);
+
+  char buffer[matador::iso8601::TIME_SIZE];
+  std::size_t len = matador::to_iso8601(t, buffer);
+
+  UNIT_ASSERT_EQUAL(len, 23UL, "expected length must be 23");
+  UNIT_ASSERT_EQUAL(std::string(buffer), "2015-03-15T13:06:02.005", "invalid time string");
+
+  matador::time result;
+  matador::from_iso8601(buffer, len, result);
+
+  UNIT_ASSERT_EQUAL(result, t, "times must be equal");
+
+  len = matador::to_iso8601(t, buffer, ' ', false);
+
+  UNIT_ASSERT_EQUAL(len, 19UL, "expected length must be 19");
+  UNIT_ASSERT_EQUAL(std::string(buffer), "2015-03-15 13:06:02", "invalid time string");
+  UNIT_ASSERT_EQUAL(std::string(buffer), matador::to_string(t, "%F %T"), "time string must match to_string");
+
+  matador::from_iso8601(buffer, len, result);
+
+  UNIT_ASSERT_EQUAL(result, matador::time(2015, 3, 15, 13, 6, 2), "times must be equal");
+
+  // the fraction is scaled by its number of digits
+  const char *fraction = "2015-03-15 13:06:02.5";
+  matador::from_iso8601(fraction, strlen(fraction), result);
+
+  UNIT_ASSERT_EQUAL(result.milli_second(), 500, "expected milliseconds must be 500");
+  UNIT_ASSERT_EQUAL(result, matador::time::parse(fraction, "%Y-%m-%d %T.%f"), "time must match parsed time");
+
+  fraction = "2015-03-15T13:06:02.000123";
+  matador::from_iso8601(fraction, strlen(fraction), result);
+
+  UNIT_ASSERT_EQUAL(result.get_timeval().tv_usec, 123L, "expected microseconds must be 123");
+
+  UNIT_ASSERT_EXCEPTION(matador::from_iso8601("2015-03-15X13:06:02", 19, result), std::logic_error, "error parsing time", "invalid separator must throw");
+  UNIT_ASSERT_EXCEPTION(matador::from_iso8601("2015-03-15T13:06", 16, result), std::logic_error, "error parsing time", "short time must throw");
+}
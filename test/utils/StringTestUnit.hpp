@@ -10,6 +10,8 @@ public:
 
   void test_split();
   void test_trim();
+  void test_iso8601_date();
+  void test_iso8601_time();
 };
 
 
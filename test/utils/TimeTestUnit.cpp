@@ -3,10 +3,51 @@
 #include "matador/utils/time.hpp"
 #include "matador/utils/string.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <stdexcept>
+#include <string>
 
 using namespace matador;
 
+namespace {
+
+#ifndef _MSC_VER
+// sets the local time zone of the process
+// and restores the previous one on exit
+class time_zone_guard
+{
+public:
+  explicit time_zone_guard(const char *tz)
+  {
+    const char *current = getenv("TZ");
+    if (current != nullptr) {
+      has_previous_ = true;
+      previous_ = current;
+    }
+    setenv("TZ", tz, 1);
+    tzset();
+  }
+
+  ~time_zone_guard()
+  {
+    if (has_previous_) {
+      setenv("TZ", previous_.c_str(), 1);
+    } else {
+      unsetenv("TZ");
+    }
+    tzset();
+  }
+
+private:
+  bool has_previous_ = false;
+  std::string previous_;
+};
+#endif
+
+}
+
 TimeTestUnit::TimeTestUnit()
   : unit_test("time", "time test unit")
 {
@@ -19,6 +60,8 @@ TimeTestUnit::TimeTestUnit()
   add_test("modify", std::bind(&TimeTestUnit::test_modify, this), "modify time");
   add_test("parse", std::bind(&TimeTestUnit::test_parse, this), "parse time");
   add_test("format", std::bind(&TimeTestUnit::test_format, this), "format time");
+  add_test("time_zone", std::bind(&TimeTestUnit::test_time_zone, this), "time in local time zone");
+  add_test("daylight_saving_switch", std::bind(&TimeTestUnit::test_daylight_saving_switch, this), "time at a daylight saving time switch");
 }
 
 void TimeTestUnit::test_create()
@@ -283,3 +326,110 @@ void TimeTestUnit::test_format()
 
   UNIT_ASSERT_EQUAL(tstr, "11:35:07.123 31.01.2015", "invalid time string [" + tstr + "]");
 }
+
+void TimeTestUnit::test_time_zone()
+{
+#ifndef _MSC_VER
+  // the time zones are given as posix rules,
+  // so no time zone database is needed
+  {
+    // no daylight saving time at all
+    time_zone_guard tz("UTC0");
+
+    matador::time t(2016, 7, 1, 12, 0, 0);
+    UNIT_ASSERT_EQUAL(t.get_timeval().tv_sec, 1467374400L, "summer time must not be shifted in UTC");
+    UNIT_ASSERT_FALSE(t.is_daylight_saving(), "UTC has no daylight saving time");
+  }
+  {
+    time_zone_guard tz("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    matador::time summer(2016, 7, 1, 12, 0, 0);
+    UNIT_ASSERT_EQUAL(summer.get_timeval().tv_sec, 1467367200L, "summer time must be UTC+2");
+    UNIT_ASSERT_TRUE(summer.is_daylight_saving(), "summer time must be daylight saving");
+
+    matador::time winter(2016, 1, 15, 12, 0, 0);
+    UNIT_ASSERT_EQUAL(winter.get_timeval().tv_sec, 1452855600L, "winter time must be UTC+1");
+    UNIT_ASSERT_FALSE(winter.is_daylight_saving(), "winter time must not be daylight saving");
+  }
+  {
+    // daylight saving time starts two weeks
+    // earlier than in europe
+    time_zone_guard tz("EST5EDT,M3.2.0,M11.1.0");
+
+    matador::time t(2016, 3, 20, 12, 0, 0);
+    UNIT_ASSERT_EQUAL(t.get_timeval().tv_sec, 1458489600L, "time must be UTC-4");
+    UNIT_ASSERT_TRUE(t.is_daylight_saving(), "time must be daylight saving");
+
+    matador::time parsed = matador::time::parse("2016-03-20 12:00:00", "%Y-%m-%d %H:%M:%S");
+    UNIT_ASSERT_EQUAL(parsed.get_timeval().tv_sec, 1458489600L, "parsed time must be UTC-4");
+
+    matador::time iso;
+    const char *str = "2016-03-20T12:00:00.000";
+    from_iso8601(str, strlen(str), iso);
+    UNIT_ASSERT_EQUAL(iso.get_timeval().tv_sec, 1458489600L, "ISO 8601 time must be UTC-4");
+    UNIT_ASSERT_EQUAL(iso.hour(), 12, "hour must be kept");
+  }
+#endif
+}
+
+void TimeTestUnit::test_daylight_saving_switch()
+{
+#ifndef _MSC_VER
+  {
+    time_zone_guard tz("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    // 02:00 to 03:00 is skipped on march 29th
+    matador::time gap(2015, 3, 29, 2, 30, 0);
+    UNIT_ASSERT_EQUAL(gap.get_timeval().tv_sec, 1427592600L, "time in gap must be read as UTC+1");
+    UNIT_ASSERT_EQUAL(gap.hour(), 3, "time in gap must be moved forward");
+    UNIT_ASSERT_EQUAL(gap.minute(), 30, "minute must be kept");
+    UNIT_ASSERT_TRUE(gap.is_daylight_saving(), "time in gap must be daylight saving");
+
+    // 02:00 to 03:00 is repeated on october 25th
+    matador::time overlap(2015, 10, 25, 2, 30, 0);
+    UNIT_ASSERT_EQUAL(overlap.get_timeval().tv_sec, 1445733000L, "time in overlap must be the earlier one");
+    UNIT_ASSERT_EQUAL(overlap.hour(), 2, "hour must be kept");
+    UNIT_ASSERT_TRUE(overlap.is_daylight_saving(), "time in overlap must be daylight saving");
+
+    matador::time parsed = matador::time::parse("2015-10-25 02:30:00", "%Y-%m-%d %H:%M:%S");
+    UNIT_ASSERT_EQUAL(parsed.get_timeval().tv_sec, 1445733000L, "parsed time in overlap must be the earlier one");
+
+    matador::time iso;
+    const char *str = "2015-03-29T02:30:00.000";
+    from_iso8601(str, strlen(str), iso);
+    UNIT_ASSERT_EQUAL(iso.get_timeval().tv_sec, 1427592600L, "ISO 8601 time in gap must be read as UTC+1");
+
+    // one hour after the first 02:30 the clock shows 02:30 again
+    matador::time later(overlap.get_timeval().tv_sec + 3600);
+    UNIT_ASSERT_EQUAL(later.hour(), 2, "hour must be repeated");
+    UNIT_ASSERT_EQUAL(later.minute(), 30, "minute must be repeated");
+    UNIT_ASSERT_FALSE(later.is_daylight_saving(), "repeated time must not be daylight saving");
+  }
+  {
+    time_zone_guard tz("EST5EDT,M3.2.0,M11.1.0");
+
+    // 02:00 to 03:00 is skipped on march 8th
+    matador::time gap(2015, 3, 8, 2, 30, 0);
+    UNIT_ASSERT_EQUAL(gap.get_timeval().tv_sec, 1425799800L, "time in gap must be read as UTC-5");
+    UNIT_ASSERT_EQUAL(gap.hour(), 3, "time in gap must be moved forward");
+    UNIT_ASSERT_TRUE(gap.is_daylight_saving(), "time in gap must be daylight saving");
+
+    // 01:00 to 02:00 is repeated on november 1st
+    matador::time overlap(2015, 11, 1, 1, 30, 0);
+    UNIT_ASSERT_EQUAL(overlap.get_timeval().tv_sec, 1446355800L, "time in overlap must be the earlier one");
+    UNIT_ASSERT_EQUAL(overlap.hour(), 1, "hour must be kept");
+    UNIT_ASSERT_TRUE(overlap.is_daylight_saving(), "time in overlap must be daylight saving");
+
+    matador::time iso;
+    const char *str = "2015-11-01T01:30:00.000";
+    from_iso8601(str, strlen(str), iso);
+    UNIT_ASSERT_EQUAL(iso.get_timeval().tv_sec, 1446355800L, "ISO 8601 time in overlap must be the earlier one");
+
+    // the hours around the switch are not affected
+    matador::time before(2015, 11, 1, 0, 30, 0);
+    UNIT_ASSERT_EQUAL(before.get_timeval().tv_sec, 1446352200L, "time before overlap must be UTC-4");
+    matador::time after(2015, 11, 1, 2, 30, 0);
+    UNIT_ASSERT_EQUAL(after.get_timeval().tv_sec, 1446363000L, "time after overlap must be UTC-5");
+  }
+#endif
+}
@@ -17,6 +17,8 @@ public:
   void test_modify();
   void test_parse();
   void test_format();
+  void test_time_zone();
+  void test_daylight_saving_switch();
 };
 
 #endif /* TIMETESTUNIT_HPP */